@@ -0,0 +1,77 @@
+/*
+ * AdaptiveRKCK.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef CORE_INC_ADAPTIVERKCK_HPP_
+#define CORE_INC_ADAPTIVERKCK_HPP_
+
+#include <functional>
+#include "StateMacros.hpp"
+
+/** \brief Embedded Runge-Kutta-Cash-Karp (4)5 pair with step size control & dense output
+ *  \details Unlike ssc::solver::RKCK (which is used as a fixed-step stepper), this class
+ *           uses the difference between the 4th & 5th order solutions to accept or reject
+ *           each step & to choose the next step size. Outputs between two accepted steps
+ *           are obtained by cubic Hermite interpolation (using the states & their derivatives
+ *           at both ends of the step), so observers can still sample a regular grid.
+ *           The class does not know about Sim: adaptive_quicksolve (solver.hpp) takes care of
+ *           forced states & of the states histories.
+ *  \addtogroup core
+ *  \ingroup core
+ *  \section ex1 Example
+ *  \snippet core/unit_tests/src/AdaptiveRKCKTest.cpp AdaptiveRKCKTest example
+ */
+class AdaptiveRKCK
+{
+    public:
+        struct Parameters
+        {
+            Parameters();
+            double absolute_tolerance; //!< Error tolerated on states close to zero
+            double relative_tolerance; //!< Error tolerated relatively to the magnitude of each state
+            double dt_min;             //!< If the step size has to be reduced below this value, the integration fails
+            double dt_max;             //!< Upper bound on the step size (no limit if zero)
+        };
+
+        typedef std::function<void(const StateType& x, StateType& dx_dt, const double t)> RHS;
+
+        AdaptiveRKCK(const Parameters& parameters, //!< Tolerances & bounds on the step size
+                     const size_t nb_of_states     //!< Used to allocate all work buffers once
+                    );
+
+        /**  \brief Computes the 5th & 4th order solutions at t+dt
+          *  \details dx_dt is f(x,t) (first stage), which the caller usually already knows (from the previous step)
+          */
+        void do_step(const RHS& f, const StateType& x, const StateType& dx_dt, const double t, const double dt,
+                     StateType& x_high, //!< 5th order solution (used to continue the integration)
+                     StateType& x_low   //!< 4th order solution (only used to estimate the error)
+                     );
+
+        /**  \brief Scaled error between the two solutions computed by do_step
+          *  \returns Max over all states of |x_high-x_low|/(atol + rtol*max(|x|,|x_high|)): the step is accepted if it is lower than 1
+          */
+        double error(const StateType& x, const StateType& x_high, const StateType& x_low) const;
+
+        /**  \brief Step size for the next attempt
+          *  \details Standard controller (factor 0.9*err^(-1/5) bounded by [0.2,5]): the step size is never increased after a rejected step.
+          *           Throws a NumericalErrorException if the step has to be reduced below dt_min.
+          */
+        double next_dt(const double dt, const double err, const double t) const;
+
+        /**  \brief Cubic Hermite interpolation between two accepted steps
+          */
+        static void interpolate(const StateType& x0, const StateType& dx0_dt, const double t0,
+                                const StateType& x1, const StateType& dx1_dt, const double t1,
+                                const double t, StateType& x);
+
+    private:
+        AdaptiveRKCK();
+        Parameters parameters;
+        StateType k2, k3, k4, k5, k6; //!< Derivatives at each stage
+        StateType y;                  //!< Stage states
+};
+
+#endif /* CORE_INC_ADAPTIVERKCK_HPP_ */
@@ -10,6 +10,7 @@
 
 #include "BlockedDOF.hpp"
 #include "BodyStates.hpp"
+#include "DataAddressing.hpp"
 #include "StateMacros.hpp"
 
 #include <ssc/kinematics.hpp>
@@ -28,7 +29,9 @@ class Body
         Body(const size_t idx, const BlockedDOF& blocked_states);
         Body(const BodyStates& states, const size_t idx, const BlockedDOF& blocked_states);
 
-        BodyStates get_states() const;
+        /**  \brief States of the body, for the force models (no copy: the reference stays valid as long as the body)
+         */
+        const BodyStates& get_states() const;
 
         /** \brief Use SurfaceElevation to compute wave height & update accordingly
          */
@@ -45,8 +48,8 @@ class Body
         /**  \brief Update Body structure taking the new coordinates & wave heights into account
          */
         void update(const EnvironmentAndFrames& env, const StateType& x, const double t);
-        void update_kinematics(StateType x, const ssc::kinematics::KinematicsPtr& k) const;
-        void update_body_states(StateType x, const double t);
+        void update_kinematics(const StateType& x, const ssc::kinematics::KinematicsPtr& k) const;
+        void update_body_states(const StateType& x, const double t);
         void force_states(StateType& x, const double t) const;
         StateType block_states_if_necessary(StateType x, const double t) const;
 
@@ -72,15 +75,24 @@ class Body
         BlockedDOF::Vector get_delta_F(const StateType& dx_dt, const ssc::kinematics::Wrench& sum_of_other_forces) const;
 
         void set_states_history(const AbstractStates<History>& states);
+        /**  \brief Records all samples of 'new_states' in the history (the previous samples are kept)
+          *  \details The first new sample overwrites the latest recorded one if they have the same date.
+          */
+        void append_states_history(const AbstractStates<History>& new_states);
+        void save_states_history_checkpoint(); //!< Cf. History::save_checkpoint
+        void rewind_states_history_to_checkpoint(); //!< Cf. History::rewind_to_checkpoint
         void reset_history();
     protected:
         BodyStates states;
 
     private:
         Body();
+        static std::vector<DataAddressing> get_states_addressing(const std::string& body_name);
 
         size_t idx; //!< Index of the first state
         BlockedDOF blocked_states;
+        std::vector<DataAddressing> states_addressing; //!< Built once, so feed does no string manipulation
+        StateType x_with_forced_states;                //!< Work buffer for update_body_states (allocated once)
 };
 
 typedef TR1(shared_ptr)<Body> BodyPtr;
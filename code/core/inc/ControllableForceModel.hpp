@@ -15,6 +15,7 @@
 #include <ssc/kinematics.hpp>
 
 #include "yaml-cpp/exceptions.h"
+#include "DataAddressing.hpp"
 #include "InvalidInputException.hpp"
 #include "YamlBody.hpp"
 
@@ -48,6 +49,17 @@ class ControllableForceModel
         virtual ~ControllableForceModel();
         ssc::kinematics::Wrench operator()(const BodyStates& states, const double t, ssc::data_source::DataSource& command_listener, const ssc::kinematics::KinematicsPtr& k, const ssc::kinematics::Point& G);
         virtual ssc::kinematics::Vector6d get_force(const BodyStates& states, const double t, const std::map<std::string,double>& commands) const = 0;
+
+        /**  \brief Lets the model start computing its force, before operator() is called with the same states & instant
+          *  \details Sim calls it for the models of all bodies before summing the forces, so that the models computing
+          *           their force asynchronously (eg. distant models) do so concurrently: the evaluation then lasts
+          *           as long as the slowest of them instead of the sum of their durations. Does nothing for the other models.
+          */
+        void start_computing_force(const BodyStates& states, const double t, ssc::data_source::DataSource& command_listener);
+
+        /**  \brief Does the model override start_force? False by default.
+          */
+        virtual bool computes_force_asynchronously() const;
         std::string get_name() const;
         virtual double get_Tmax() const; // Can be overloaded if model needs access to History (not a problem, just has to say how much history to keep)
         std::string get_body_name() const;
@@ -86,6 +98,10 @@ class ControllableForceModel
 
     protected:
         virtual void extra_observations(Observer& observer) const;
+
+        /**  \brief Called by start_computing_force: the next call to get_force with the same instant should return the result
+          */
+        virtual void start_force(const BodyStates& states, const double t, const std::map<std::string,double>& commands);
         EnvironmentAndFrames env;
         std::vector<std::string> commands;
 
@@ -100,6 +116,10 @@ class ControllableForceModel
         YamlPosition position_of_frame;
         ssc::kinematics::Wrench latest_force_in_body_frame;
         ssc::kinematics::Transform from_internal_frame_to_a_known_frame;
+        WrenchAddressing body_frame_addressing;     //!< Built once, so feed does no string manipulation
+        WrenchAddressing internal_frame_addressing;
+        WrenchAddressing ned_frame_addressing;
+        size_t body_to_internal_frame;              //!< Handle of the transform from the body frame to the internal frame (in env.transforms)
 };
 
 #endif /* CONTROLLABLEFORCEMODEL_HPP_ */
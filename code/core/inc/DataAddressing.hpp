@@ -0,0 +1,33 @@
+/*
+ * DataAddressing.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef DATAADDRESSING_HPP_
+#define DATAADDRESSING_HPP_
+
+#include <array>
+#include <string>
+#include <vector>
+
+struct DataAddressing
+{
+    std::string name;
+    std::vector<std::string> address;
+    DataAddressing():name(),address(){};
+    DataAddressing(
+            const std::vector<std::string>& address_,
+            const std::string& name_):
+        name(name_),address(address_){};
+};
+
+typedef std::array<DataAddressing,6> WrenchAddressing; //!< Fx, Fy, Fz, Mx, My, Mz
+
+/**  \brief Addresses of the six components of a wrench, eg. Fx(force_name,body_name,frame)
+  *  \details Meant to be built once (eg. in the constructor of a force model) and reused at each time step.
+  */
+WrenchAddressing get_wrench_addressing(const std::string& force_name, const std::string& body_name, const std::string& frame);
+
+#endif  /* DATAADDRESSING_HPP_ */
@@ -12,6 +12,7 @@
 #include "Body.hpp"
 #include "StateMacros.hpp"
 #include "SurfaceElevationInterface.hpp"
+#include "TransformCache.hpp"
 #include <ssc/kinematics.hpp>
 
 class Observer;
@@ -22,6 +23,7 @@ struct EnvironmentAndFrames
     void feed(Observer& observer, double t, const std::vector<BodyPtr>& bodies, const StateType& state) const;
     SurfaceElevationPtr w;
     ssc::kinematics::KinematicsPtr k;
+    TransformCachePtr transforms; //!< Shared by all copies (eg. those of the force models) so the transforms are computed once per time step
     double rho;
     double nu;
     double g;
@@ -19,6 +19,7 @@
 #include <ssc/macros.hpp>
 #include TR1INC(memory)
 
+#include "DataAddressing.hpp"
 #include "InvalidInputException.hpp"
 #include "YamlBody.hpp"
 
@@ -107,14 +108,18 @@ class ForceModel
 
     protected:
         virtual void extra_observations(Observer& observer) const;
+        mutable std::vector<DataAddressing> extra_observations_addressing; //!< Can be filled by the first call to extra_observations so the following ones do no string manipulation
 
     private:
         ForceModel(); // Disabled
+        void build_addressing();
 
         std::string force_name;
         std::string body_name;
         ssc::kinematics::Wrench force_in_body_frame;
         ssc::kinematics::Wrench force_in_ned_frame;
+        WrenchAddressing body_frame_addressing; //!< Built once, so feed does no string manipulation
+        WrenchAddressing ned_frame_addressing;
 };
 
 typedef std::vector<ForcePtr> ListOfForces;
@@ -0,0 +1,64 @@
+/*
+ * InputCache.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef CORE_INC_INPUTCACHE_HPP_
+#define CORE_INC_INPUTCACHE_HPP_
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <ssc/macros/tr1_macros.hpp>
+#include TR1INC(memory)
+
+#include "GeometricTypes3d.hpp"
+
+class HDBParser;
+
+/** \brief Read-only data shared by several simulations running in the same process
+ *  \details Parsing HDB & STL files and computing the retardation functions of the radiation
+ *           damping model (cos transforms) can take longer than the simulation itself when running
+ *           many short cases (parameter sweeps, Monte-Carlo sea states). When the cache is enabled
+ *           (by xdyn-batch), each input is computed once & shared by all simulations: the first
+ *           thread to ask for a given key builds it, the others wait for the result.
+ *           When the cache is disabled (default), all functions just parse/compute their input, so
+ *           xdyn, xdyn-for-cs & xdyn-for-me are not affected.
+ *           Everything returned here is immutable: mutable (per-run) state such as interpolators,
+ *           meshes transformed in the body frame or wave models is still built by each Sim.
+ *  \addtogroup core
+ *  \ingroup core
+ *  \section ex1 Example
+ *  \snippet core/unit_tests/src/InputCacheTest.cpp InputCacheTest example
+ */
+class InputCache
+{
+    public:
+        static void enable();
+        static void disable(); //!< Also empties the cache
+        static bool is_enabled();
+
+        /**  \brief Parsed contents of an HDB file
+          */
+        static TR1(shared_ptr)<const HDBParser> hdb(const std::string& filename);
+
+        /**  \brief Facets read from an STL file
+          */
+        static TR1(shared_ptr)<const VectorOfVectorOfPoints> stl(const std::string& filename);
+
+        /**  \brief Tables computed from the inputs (eg. retardation functions evaluated at each tau)
+          *  \details 'compute' is only called if the key is not already in the cache (or if the cache is disabled)
+          */
+        static TR1(shared_ptr)<const std::vector<std::vector<double> > > tables(const std::string& key,
+                                                                                 const std::function<std::vector<std::vector<double> >()>& compute);
+
+    private:
+        InputCache();
+        class Impl;
+        static Impl& get_impl();
+};
+
+#endif /* CORE_INC_INPUTCACHE_HPP_ */
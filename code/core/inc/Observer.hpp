@@ -15,30 +15,35 @@
 #include <ssc/macros.hpp>
 #include TR1INC(memory)
 
+#include "DataAddressing.hpp"
 #include "DiscreteDirectionalWaveSpectrum.hpp"
+#include "ObserverWriter.hpp"
 
 class Sim;
 class SurfaceElevationGrid;
 
-struct DataAddressing
-{
-    std::string name;
-    std::vector<std::string> address;
-    DataAddressing():name(),address(){};
-    DataAddressing(
-            const std::vector<std::string>& address_,
-            const std::string& name_):
-        name(name_),address(address_){};
-};
-
 class Observer
 {
     public:
         Observer(const std::vector<std::string>& data);
         virtual void observe(const Sim& sys, const double t); // Only what was requested by the user in the YAML file
-        void observe_everything(const Sim& sys, const double t); // Everything (not just what the user asked). Used for co-simulation
+        /**  \brief Everything (not just what the user asked). Used for co-simulation
+          *  \details Scalars written for the first time after the first row (eg. extra observations of a
+          *           distant force model) are appended to the row (cf. add_columns).
+          */
+        void observe_everything(const Sim& sys, const double t);
         virtual ~Observer();
 
+        /**  \brief Stores a scalar in the current row
+          *  \details The first time a variable is written it is given a slot in the row (using its name).
+          *           Afterwards, the n-th call of each time step is expected to write the same variable as the
+          *           n-th call of the previous time step: this is confirmed by comparing the names (no map
+          *           lookup nor allocation) & the slot is searched by name if they differ (eg. if the order
+          *           of the calls changed). Producers should keep their DataAddressing alive (eg. as class
+          *           members) rather than building temporaries at each call (which still works, but allocates).
+          */
+        void write(const double val, const DataAddressing& address);
+
         template <typename T> void write(
                 const T& val,
                 const DataAddressing& address)
@@ -49,10 +54,26 @@ class Observer
 
         virtual void write_before_simulation(const std::vector<FlatDiscreteDirectionalWaveSpectrum>& val, const DataAddressing& address);
 
+        /**  \brief Rows will be written by the I/O thread of 'writer' instead of the thread calling 'observe'
+          *  \details Must be called before the first call to 'observe'. The values can no longer be read from
+          *           the observer (eg. MapObserver::get) until ObserverWriter::flush has been called.
+          */
+        void write_asynchronously(const ObserverWriterPtr& writer);
+
     protected:
 
-        virtual std::function<void()> get_serializer(const double val, const DataAddressing& address) = 0;
-        virtual std::function<void()> get_initializer(const double val, const DataAddressing& address) = 0;
+        /**  \brief Called once (before the first call to write_row) with the addresses of the scalars to serialize
+          */
+        virtual void initialize_row(const std::vector<DataAddressing>& columns) = 0;
+
+        /**  \brief Called at each time step with the values of the scalars to serialize (in the order given to initialize_row)
+          */
+        virtual void write_row(const std::vector<double>& values) = 0;
+
+        /**  \brief Called by observe_everything (before write_row) when scalars appeared after the first row: they are appended to the row
+          *  \details Throws an InternalErrorException by default (the observers writing files only use 'observe').
+          */
+        virtual void add_columns(const std::vector<DataAddressing>& new_columns);
 
         virtual std::function<void()> get_serializer(const SurfaceElevationGrid& val, const DataAddressing& address);
         virtual std::function<void()> get_initializer(const SurfaceElevationGrid& val, const DataAddressing& address);
@@ -60,19 +81,39 @@ class Observer
         virtual void flush_after_initialization() = 0;
         virtual void before_write();
         virtual void flush_after_write() = 0;
-        virtual void flush_value_during_write() = 0;
-        virtual void flush_value_during_initialization();
 
     private:
+        friend class ObserverWriter;
         Observer(); // Disabled
 
+        void push_row_to_writer();
+        void start_new_row(const double t);
+        size_t register_scalar(const DataAddressing& address);
+        void write_unmatched_scalar(const double val, const DataAddressing& address, const size_t call);
+        void serialize_new_scalars();
+        std::vector<std::string> all_variables() const;
         void initialize_serialization_of_requested_variables(const std::vector<std::string>& variables_to_serialize);
-        void serialize_requested_variables(const std::vector<std::string>& variables_to_serialize);
+        void serialize_requested_variables();
 
         bool initialized;
         std::vector<std::string> requested_serializations;
         std::map<std::string, std::function<void()> > serialize;
         std::map<std::string, std::function<void()> > initialize;
+
+        DataAddressing t_address;
+        std::vector<double> row;                           //!< Latest value of each scalar (one slot per scalar written since the beginning of the simulation)
+        std::vector<DataAddressing> columns;               //!< Address of each slot in row
+        std::map<std::string, size_t> slot_of_name;        //!< Only used when a write cannot be matched by its call number
+        std::vector<size_t> slot_of_call;                  //!< Slot written by the n-th call to write during the previous time step
+        size_t nb_of_calls;                                //!< Number of calls to write during the current time step
+        std::vector<size_t> requested_slots;               //!< Slots of the scalars to serialize
+        std::vector<std::string> requested_non_scalars;    //!< Variables serialized using the serialize & initialize maps (eg. wave fields)
+        std::vector<double> values_to_serialize;           //!< Work buffer for write_row
+        std::vector<DataAddressing> requested_columns;     //!< Addresses given to initialize_row (& add_columns)
+        size_t nb_of_observed_slots;                       //!< observe_everything: slots already in requested_slots (the following ones are new)
+        ObserverWriterPtr writer;                          //!< Null if the rows are written by the thread calling 'observe'
+        bool first_row_was_pushed;
+        size_t nb_of_columns_pushed;                       //!< Number of requested_columns already handed to the writer
 };
 
 typedef TR1(shared_ptr)<Observer> ObserverPtr;
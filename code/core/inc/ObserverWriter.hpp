@@ -0,0 +1,82 @@
+/*
+ * ObserverWriter.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef CORE_INC_OBSERVERWRITER_HPP_
+#define CORE_INC_OBSERVERWRITER_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include <ssc/macros/tr1_macros.hpp>
+#include TR1INC(memory)
+
+#include "DataAddressing.hpp"
+
+class Observer;
+
+/** \brief Everything an observer needs to write one row (filled by the simulation thread)
+ */
+struct ObserverRow
+{
+    ObserverRow();
+    ObserverRow(const ObserverRow& rhs);
+    ObserverRow& operator=(const ObserverRow& rhs);
+    Observer* observer;                                //!< Not owned by the row
+    bool initialize;                                   //!< First row of 'observer': the output is initialized before the row is written
+    std::vector<DataAddressing> columns;               //!< Columns given to initialize_row (first row) or to add_columns (columns that appeared since the previous row)
+    std::vector<double> values;                        //!< Scalars to serialize (cf. Observer::write_row)
+    std::vector<std::function<void()> > initializers;  //!< Initializers of the non-scalar outputs (only for the first row)
+    std::vector<std::function<void()> > serializers;   //!< Serializers of the non-scalar outputs (eg. wave fields)
+};
+
+/** \brief Writes the rows of several observers in a dedicated thread (I/O thread)
+ *  \details The simulation thread computes the rows (Observer::observe) & hands them to the I/O thread through a
+ *           bounded lock-free single-producer single-consumer ring of rows. The I/O thread calls the write
+ *           functions of the observers (formatting, files, network), in the order of the rows. When the ring is
+ *           empty, the I/O thread blocks on a condition variable until 'push' wakes it up. When the ring is
+ *           full, the simulation thread waits (back-pressure). The slots of the ring are reused, so no memory is
+ *           allocated once each slot has been used. Only one thread may push rows.
+ *           If an observer throws in the I/O thread, the following rows are dropped & the exception is rethrown
+ *           in the simulation thread by the next call to 'next_row' or 'flush'. The destructor writes all pending
+ *           rows before stopping the I/O thread (so observers must outlive the rows they pushed).
+ *  \addtogroup core
+ *  \ingroup core
+ *  \section ex1 Example
+ *  \snippet core/unit_tests/src/ObserverWriterTest.cpp ObserverWriterTest example
+ */
+class ObserverWriter
+{
+    public:
+        ObserverWriter(const size_t nb_of_rows //!< Capacity of the ring
+                      );
+        ~ObserverWriter();
+
+        /**  \brief Slot to fill before calling 'push' (waits while the ring is full)
+          */
+        ObserverRow& next_row();
+
+        /**  \brief Hands the row returned by the last call to 'next_row' to the I/O thread
+          */
+        void push();
+
+        /**  \brief Waits until all rows pushed so far are written & rethrows the exception of the I/O thread, if any
+          */
+        void flush();
+
+    private:
+        ObserverWriter();                                  // Disabled
+        ObserverWriter(const ObserverWriter&);             // Disabled
+        ObserverWriter& operator=(const ObserverWriter&);  // Disabled
+        static void write(const ObserverRow& row);         //!< Called by the I/O thread
+        class Impl;
+        TR1(shared_ptr)<Impl> pimpl;
+};
+
+typedef TR1(shared_ptr)<ObserverWriter> ObserverWriterPtr;
+
+#endif /* CORE_INC_OBSERVERWRITER_HPP_ */
@@ -58,6 +58,16 @@ class Sim
 
         void set_bodystates(const State& state_history);
 
+        /**  \brief Sets the history of the states of all bodies
+          *  \details One history per body, in the order of get_bodies(). The current state is only
+          *           initialized if all histories hold at least one sample.
+          */
+        void set_bodystates(const std::vector<State>& states_histories);
+
+        /**  \brief Same as set_bodystates, but keeps the samples already in the history (cf. Body::append_states_history)
+          */
+        void append_bodystates(const State& new_states);
+
         std::map<std::string,std::vector<ForcePtr> > get_forces() const;
         std::vector<BodyPtr> get_bodies() const;
         EnvironmentAndFrames get_env() const;
@@ -65,6 +75,16 @@ class Sim
         void set_command_listener(const std::map<std::string, double>& new_commands);
 
         void reset_history();
+
+        /**  \brief Saves a checkpoint in the history of the states of all bodies
+          *  \details Used by adaptive_quicksolve (solver.hpp): each call to operator() records
+          *           the states at the current instant, so the histories have to be rewound
+          *           before evaluating the model at an earlier instant (eg. between two stages
+          *           of a Runge-Kutta step or after a rejected step). Nothing is copied: restoring
+          *           only undoes the records made since the checkpoint (cf. History::rewind_to_checkpoint).
+          */
+        void save_states_histories();
+        void restore_states_histories();
     private:
         ssc::kinematics::UnsafeWrench sum_of_forces(const StateType& x, const BodyPtr& body, const double t);
 
@@ -73,8 +93,9 @@ class Sim
           *  ideal because it means the model does not see the state values set
           *  by the stepper.
           */
-        StateType normalize_quaternions(const StateType& all_states
-                                       ) const;
+        void normalize_quaternions(const StateType& all_states,
+                                   StateType& normalized //!< Overwritten (no allocation once its capacity is large enough)
+                                  ) const;
 
         class Impl;
         TR1(shared_ptr)<Impl> pimpl;
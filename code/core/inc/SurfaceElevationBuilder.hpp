@@ -36,6 +36,7 @@ class SurfaceElevationBuilderInterface
         virtual ~SurfaceElevationBuilderInterface();
         static ssc::kinematics::PointMatrixPtr make_wave_mesh(const YamlWaveOutput& output);
         std::pair<std::size_t,std::size_t> get_wave_mesh_size(const YamlWaveOutput& output) const;
+        static std::pair<double,double> get_wave_mesh_step_size(const YamlWaveOutput& output);
         virtual boost::optional<TR1(shared_ptr)<SurfaceElevationInterface> > try_to_parse(const std::string& model, const std::string& yaml) const = 0;
 
     protected:
@@ -10,6 +10,8 @@
 
 #include "SurfaceElevationInterface.hpp"
 #include "WaveModel.hpp"
+#include "WaveElevationOnFixedPoints.hpp"
+#include "WaveElevationOnRegularGrid.hpp"
 #include "Observer.hpp"
 
 #include <ssc/kinematics.hpp>
@@ -42,6 +44,10 @@ class SurfaceElevationFromWaves: public SurfaceElevationInterface
         std::vector<WaveModelPtr> get_models() const {return directional_spectra;};
 
         void serialize_wave_spectra_before_simulation(ObserverPtr& observer) const;
+
+        /**  \brief Calls each wave model directly (without copying the spectra)
+          */
+        std::array<double, 6> evaluate_rao_6dof(const double x, const double y, const double t, const std::vector<CartesianRAO>& rao) const;
     private:
         SurfaceElevationFromWaves(); // Disabled
 
@@ -97,6 +103,13 @@ class SurfaceElevationFromWaves: public SurfaceElevationInterface
                                              const double t                  //!< Current time instant (in seconds)
                                              ) const;
 
+        /**  \brief Uses the FFT synthesis or the wave elevations precomputed by the constructor (if the output mesh is defined in the NED frame)
+          */
+        std::vector<double> wave_height_on_fixed_output_mesh(const double t //!< Current instant (in seconds)
+                                                            ) const;
+
         std::vector<WaveModelPtr> directional_spectra;
+        TR1(shared_ptr)<WaveElevationOnRegularGrid> elevation_on_output_grid; //!< FFT synthesis, only if the output mesh is a regular grid in the NED frame & some components are on the FFT grid
+        TR1(shared_ptr)<WaveElevationOnFixedPoints> elevation_on_output_mesh; //!< Null if the FFT synthesis is used or if the output mesh moves or is too large
 };
 #endif /* SURFACEELEVATIONFROMWAVES_HPP_ */
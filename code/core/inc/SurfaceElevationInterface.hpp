@@ -8,6 +8,7 @@
 #ifndef SURFACELEVATIONINTERFACE_HPP_
 #define SURFACELEVATIONINTERFACE_HPP_
 
+#include "CartesianRAO.hpp"
 #include "GeometricTypes3d.hpp"
 #include "SurfaceElevationGrid.hpp"
 #include "Observer.hpp"
@@ -72,6 +73,17 @@ class SurfaceElevationInterface
                             const std::vector<std::vector<double> >& rao_phase //!< Phase of the RAO
                             ) const;
 
+        /**  \brief Same as evaluate_rao, for the six degrees of freedom at once
+          *  \details The phase of each wave component is computed once (instead of once per degree of freedom) & the
+          *           RAO's phases are not used directly (cf. CartesianRAO.hpp)
+          *  \returns Force & torque (X, Y, Z, K, M, N)
+          */
+        virtual std::array<double, 6> evaluate_rao_6dof(const double x,                        //!< x-position of the RAO's calculation point in the NED frame (in meters)
+                                                        const double y,                        //!< y-position of the RAO's calculation point in the NED frame (in meters)
+                                                        const double t,                        //!< Current time instant (in seconds)
+                                                        const std::vector<CartesianRAO>& rao   //!< RAO for each directional spectrum
+                                                        ) const;
+
         /**  \brief Computes the orbital velocity at given points.
           *  \returns Velocity of the fluid at given points & instant, in m/s
           */
@@ -207,6 +219,12 @@ class SurfaceElevationInterface
                                                      const std::vector<double> &eta, //!< Wave elevations at (x,y) in the NED frame (in meters)
                                                      const double t                  //!< Current time instant (in seconds)
                                                      ) const = 0;
+        /**  \brief Wave heights on the output mesh, when it is defined in the NED frame (so its points never move)
+          *  \details Lets derived classes precompute everything which does not depend on time (cf. WaveElevationOnFixedPoints)
+          *  \returns Surface elevation for each point in output_mesh, or an empty vector if the derived class cannot do better than wave_height
+          */
+        virtual std::vector<double> wave_height_on_fixed_output_mesh(const double t //!< Current instant (in seconds)
+                                                                    ) const;
         ssc::kinematics::PointMatrixPtr get_output_mesh_in_NED_frame(const ssc::kinematics::KinematicsPtr& k //!< Object used to compute the transforms to the NED frame
                                                                     ) const;
 
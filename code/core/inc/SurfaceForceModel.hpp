@@ -8,10 +8,19 @@
 #ifndef SURFACEFORCEMODEL_HPP_
 #define SURFACEFORCEMODEL_HPP_
 
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "BodyStates.hpp"
 #include "EnvironmentAndFrames.hpp"
 #include "ForceModel.hpp"
 #include "GeometricTypes3d.hpp"
 #include "MeshIntersector.hpp"
+#include "ThreadPool.hpp"
+
+// Number of facets summed by each task (small enough for the facets & the nodes they use to stay in cache)
+#define FACETS_PER_CHUNK 256
 
 
 class ZGCalculator
@@ -37,7 +46,9 @@ class ZGCalculator
 
 
 /** \brief Models a force integrated of a surface mesh
- *  \details Implements the integration of the force in operator()
+ *  \details Implements the integration of the force in operator(). The facets are split in chunks of
+ *           FACETS_PER_CHUNK facets, which are summed in parallel by the ThreadPool. The sums of the chunks
+ *           are then added in the order of the chunks, so the result does not depend on the number of threads.
  *  \addtogroup model_wrappers
  *  \ingroup model_wrappers
  *  \section ex1 Example
@@ -61,17 +72,6 @@ class SurfaceForceModel : public ForceModel
         SurfaceForceModel(const std::string& name, const std::string& body_name_, const EnvironmentAndFrames& env);
         virtual ~SurfaceForceModel();
         ssc::kinematics::Wrench operator()(const BodyStates& states, const double t) const;
-        virtual std::function<DF(const FacetIterator &,
-                                 const size_t,
-                                 const EnvironmentAndFrames &,
-                                 const BodyStates &,
-                                 const double
-                                )> get_dF(const FacetIterator &begin_facet,
-                                          const FacetIterator &end_facet,
-                                          const EnvironmentAndFrames &env,
-                                          const BodyStates &states,
-                                          const double t
-                                         ) const = 0;
 
     /**  \brief Compute potential energy of the hydrostatic force model
       */
@@ -79,8 +79,26 @@ class SurfaceForceModel : public ForceModel
 
         bool is_a_surface_force_model() const;
 
+    protected:
+        /**  \brief Sums the elementary forces of all facets between begin_facet & end_facet, reduced at G
+          *  \details dF(that_facet, facet_index) returns a DF. Its type is a template parameter (and not a
+          *           std::function) so the compiler can inline it in the loop over the facets of each chunk.
+          */
+        template <typename ElementaryForce> ssc::kinematics::Wrench sum_over_facets(const FacetIterator& begin_facet,
+                                                                                    const FacetIterator& end_facet,
+                                                                                    const BodyStates& states,
+                                                                                    const ElementaryForce& dF) const;
+
     private:
         SurfaceForceModel();
+        /**  \brief Force integrated over the facets (called by operator())
+          *  \details Implemented by each model by calling sum_over_facets with its elementary force
+          */
+        virtual ssc::kinematics::Wrench integrate(const FacetIterator& begin_facet,
+                                                  const FacetIterator& end_facet,
+                                                  const BodyStates& states,
+                                                  const double t
+                                                 ) const = 0;
         virtual FacetIterator begin(const MeshIntersectorPtr& intersector) const = 0;
         virtual FacetIterator end(const MeshIntersectorPtr& intersector) const = 0;
         virtual double pe(const BodyStates& states, const std::vector<double>& x, const EnvironmentAndFrames& env) const = 0;
@@ -93,6 +111,58 @@ class SurfaceForceModel : public ForceModel
 
     protected:
         TR1(shared_ptr)<ZGCalculator> zg_calculator;
+        size_t ned_to_body; //!< Handle of the transform from NED to the body frame (in env.transforms)
 };
 
+template <typename ElementaryForce> ssc::kinematics::Wrench SurfaceForceModel::sum_over_facets(const FacetIterator& begin_facet,
+                                                                                                const FacetIterator& end_facet,
+                                                                                                const BodyStates& states,
+                                                                                                const ElementaryForce& dF) const
+{
+    // FacetIterator can only be incremented, so we start by locating the first facet of each chunk
+    std::vector<FacetIterator> first_facet_of_chunk;
+    size_t nb_of_facets = 0;
+    for (auto that_facet = begin_facet ; that_facet != end_facet ; ++that_facet)
+    {
+        if (nb_of_facets % FACETS_PER_CHUNK == 0) first_facet_of_chunk.push_back(that_facet);
+        ++nb_of_facets;
+    }
+    const double orientation_factor = states.intersector->mesh->orientation_factor;
+    const double xG = states.G.v(0);
+    const double yG = states.G.v(1);
+    const double zG = states.G.v(2);
+    std::vector<std::array<double,6> > sum_for_each_chunk(first_facet_of_chunk.size());
+    ThreadPool::parallel_for(first_facet_of_chunk.size(), [&](const size_t chunk)
+    {
+        std::array<double,6>& S = sum_for_each_chunk[chunk];
+        S.fill(0);
+        auto that_facet = first_facet_of_chunk[chunk];
+        const size_t last_facet_index = std::min((chunk+1)*FACETS_PER_CHUNK, nb_of_facets);
+        for (size_t facet_index = chunk*FACETS_PER_CHUNK ; facet_index < last_facet_index ; ++facet_index, ++that_facet)
+        {
+            const DF f = dF(that_facet, facet_index);
+            const double x = (f.C(0)-xG);
+            const double y = (f.C(1)-yG);
+            const double z = (f.C(2)-zG);
+            S[0] += orientation_factor*f.dF(0);
+            S[1] += orientation_factor*f.dF(1);
+            S[2] += orientation_factor*f.dF(2);
+            S[3] += orientation_factor*(y*f.dF(2)-z*f.dF(1));
+            S[4] += orientation_factor*(z*f.dF(0)-x*f.dF(2));
+            S[5] += orientation_factor*(x*f.dF(1)-y*f.dF(0));
+        }
+    });
+    ssc::kinematics::UnsafeWrench F(states.G);
+    for (const auto& S:sum_for_each_chunk)
+    {
+        F.X() += S[0];
+        F.Y() += S[1];
+        F.Z() += S[2];
+        F.K() += S[3];
+        F.M() += S[4];
+        F.N() += S[5];
+    }
+    return F;
+}
+
 #endif /* SURFACEFORCEMODEL_HPP_ */
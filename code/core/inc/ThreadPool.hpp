@@ -0,0 +1,51 @@
+/*
+ * ThreadPool.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef CORE_INC_THREADPOOL_HPP_
+#define CORE_INC_THREADPOOL_HPP_
+
+#include <cstddef>
+#include <functional>
+
+#include <ssc/macros/tr1_macros.hpp>
+#include TR1INC(memory)
+
+/** \brief Persistent worker threads shared by all the loops parallelized in the process (eg. SurfaceForceModel)
+ *  \details The workers are created the first time parallel_for is called with more than one task
+ *           & live until the end of the process (or until set_nb_of_threads is called), so no thread
+ *           is created during the simulation. The calling thread also executes tasks of its own loop:
+ *           several threads (eg. the simulations run by xdyn-batch) can therefore call parallel_for
+ *           concurrently without risking a deadlock, even if all workers are busy.
+ *           Tasks must not depend on the order in which they are run (reductions should be done by the
+ *           caller, in the order of the indices, to get results which do not depend on the number of threads).
+ *  \addtogroup core
+ *  \ingroup core
+ *  \section ex1 Example
+ *  \snippet core/unit_tests/src/ThreadPoolTest.cpp ThreadPoolTest example
+ */
+class ThreadPool
+{
+    public:
+        /**  \brief Runs task(0), ..., task(n-1) & returns when all are done
+          *  \details If a task throws, the remaining tasks are still run & the first exception is rethrown by parallel_for
+          */
+        static void parallel_for(const size_t n, const std::function<void(const size_t)>& task);
+
+        /**  \brief Total number of threads executing a loop (workers + calling thread)
+          *  \details Defaults to std::thread::hardware_concurrency(). With 1, parallel_for runs all tasks
+          *           in the calling thread. Must not be called while parallel_for is running.
+          */
+        static void set_nb_of_threads(const size_t nb_of_threads);
+        static size_t get_nb_of_threads();
+
+    private:
+        ThreadPool();
+        class Impl;
+        static TR1(shared_ptr)<Impl>& pool(); //!< Null until the first parallel loop (or after set_nb_of_threads)
+};
+
+#endif /* CORE_INC_THREADPOOL_HPP_ */
@@ -0,0 +1,67 @@
+/*
+ * TransformCache.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef CORE_INC_TRANSFORMCACHE_HPP_
+#define CORE_INC_TRANSFORMCACHE_HPP_
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ssc/kinematics.hpp>
+#include <ssc/macros/tr1_macros.hpp>
+#include TR1INC(memory)
+
+/** \brief Integer handles on the transforms queried at each time step (eg. from NED to a body frame)
+ *  \details The models register the pairs of frames they need when they are built (get_handle) & then
+ *           retrieve the transforms with that handle: the transform is only searched in the kinematics
+ *           graph (by frame name) the first time it is needed after each call to invalidate.
+ *           Body::update calls invalidate after each change of the body's pose, so the transforms are
+ *           computed at most once per evaluation of the state derivatives, however many models use them.
+ *           Transforms computed with another Kinematics object are never returned.
+ *  \addtogroup core
+ *  \ingroup core
+ *  \section ex1 Example
+ *  \snippet core/unit_tests/src/TransformCacheTest.cpp TransformCacheTest example
+ */
+class TransformCache
+{
+    public:
+        TransformCache();
+
+        /**  \brief Registers a pair of frames (if it was not already registered)
+          *  \returns Index used by 'get'. Calling get_handle twice with the same frames returns the same index.
+          */
+        size_t get_handle(const std::string& from_frame, const std::string& to_frame);
+
+        /**  \brief Same as k->get(from_frame, to_frame) for the frames of the handle, but only computed once between two calls to 'invalidate'
+          *  \details The reference stays valid until the next call to get_handle.
+          */
+        const ssc::kinematics::Transform& get(const ssc::kinematics::KinematicsPtr& k, const size_t handle);
+
+        /**  \brief Same as get(k, get_handle(from_frame, to_frame)), for frames only known at run time
+          */
+        const ssc::kinematics::Transform& get(const ssc::kinematics::KinematicsPtr& k, const std::string& from_frame, const std::string& to_frame);
+
+        /**  \brief All transforms will be recomputed the next time they are retrieved
+          */
+        void invalidate();
+
+        size_t get_nb_of_handles() const;
+
+    private:
+        std::map<std::pair<std::string,std::string>, size_t> handles;
+        std::vector<std::pair<std::string,std::string> > frames; //!< Frames of each handle
+        std::vector<ssc::kinematics::Transform> transforms;     //!< Latest transform of each handle
+        std::vector<bool> is_up_to_date;
+        ssc::kinematics::KinematicsPtr kinematics;               //!< Kinematics used to compute 'transforms'
+};
+
+typedef TR1(shared_ptr)<TransformCache> TransformCachePtr;
+
+#endif /* CORE_INC_TRANSFORMCACHE_HPP_ */
@@ -17,7 +17,9 @@
  * what is done in the SSC's solve.hpp but accounts for forced values.
  */
 
+#include <cmath>
 #include <ssc/solver.hpp>
+#include "AdaptiveRKCK.hpp"
 #include "Sim.hpp"
 
 template <typename StepperType,
@@ -47,4 +49,77 @@ void quicksolve(Sim& sys, const double t0, const double tend, double dt, Observe
     }
 }
 
+/**  \brief Integrates with the adaptive Runge-Kutta-Cash-Karp solver & observes the system every dt
+  *  \details The step size is chosen by AdaptiveRKCK (from the tolerances) & is independent
+  *           of dt, which is only the observation period: the states at each observation
+  *           instant are interpolated & the model is evaluated at those states so that all
+  *           outputs (eg. forces) are consistent. The states histories are restored before
+  *           each evaluation of the model inside a step, so they only contain accepted values
+  *           (at the end of each step & at the observation instants). Forced states are applied
+  *           to both solutions before estimating the error so they never cause a rejection.
+  */
+template <typename ObserverType,
+          typename StateForcer>
+void adaptive_quicksolve(Sim& sys, const double t0, const double tend, const double dt, ObserverType& observer, StateForcer& force_states, const AdaptiveRKCK::Parameters& parameters)
+{
+    const size_t n = sys.state.size();
+    AdaptiveRKCK stepper(parameters, n);
+    const AdaptiveRKCK::RHS f = [&sys](const StateType& x, StateType& dx_dt, const double t){sys.restore_states_histories();sys(x, dx_dt, t);};
+    StateType x = sys.state;
+    StateType dx_dt(n, 0), x_high(n, 0), x_low(n, 0), dx_dt_high(n, 0), x_obs(n, 0), dx_dt_obs(n, 0);
+    force_states(x, t0);
+    sys(x, dx_dt, t0);
+    observer.observe(sys, t0);
+    sys.save_states_histories();
+    const double eps = 1E-10*std::max(1., std::abs(tend));
+    const size_t nb_of_observations = (size_t)std::floor((tend-t0)/dt + 1E-9);
+    size_t i = 1;
+    double t = t0;
+    double h = parameters.dt_max > 0 ? std::min(dt, parameters.dt_max) : dt;
+    while (t < tend - eps)
+    {
+        const bool last_step = t + h >= tend - eps;
+        const double t1 = last_step ? tend : t + h;
+        const double h_ = t1 - t;
+        stepper.do_step(f, x, dx_dt, t, h_, x_high, x_low);
+        force_states(x_high, t1);
+        force_states(x_low, t1);
+        const double err = stepper.error(x, x_high, x_low);
+        if (err > 1)
+        {
+            h = stepper.next_dt(h_, err, t);
+            continue;
+        }
+        f(x_high, dx_dt_high, t1);
+        bool has_observations_inside_step = false;
+        for (size_t j = i ; (j <= nb_of_observations) and (t0 + (double)j*dt < t1 - eps) ; ++j)
+        {
+            const double t_obs = t0 + (double)j*dt;
+            if (not(has_observations_inside_step)) sys.restore_states_histories();
+            has_observations_inside_step = true;
+            AdaptiveRKCK::interpolate(x, dx_dt, t, x_high, dx_dt_high, t1, t_obs, x_obs);
+            force_states(x_obs, t_obs);
+            sys(x_obs, dx_dt_obs, t_obs);
+            observer.observe(sys, t_obs);
+            i = j+1;
+        }
+        if (has_observations_inside_step)
+        {
+            // Evaluate the model at the end of the step again, so it is the latest instant in the histories
+            sys(x_high, dx_dt_high, t1);
+        }
+        if ((i <= nb_of_observations) and (std::abs(t0 + (double)i*dt - t1) <= eps))
+        {
+            observer.observe(sys, t1);
+            ++i;
+        }
+        sys.save_states_histories();
+        ssc::solver::update<Sim, ssc::solver::can<Sim>::update_discrete_and_continuous_states>::if_possible(sys);
+        t = t1;
+        x.swap(x_high);
+        dx_dt.swap(dx_dt_high);
+        if (not(last_step)) h = stepper.next_dt(h_, err, t);
+    }
+}
+
 #endif /* CORE_INC_SOLVER_HPP_ */
@@ -0,0 +1,120 @@
+/*
+ * AdaptiveRKCK.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "AdaptiveRKCK.hpp"
+#include "NumericalErrorException.hpp"
+
+// Cash-Karp coefficients (cf. doc_user/solver.md)
+#define A21 (1./5.)
+#define A31 (3./40.)
+#define A32 (9./40.)
+#define A41 (3./10.)
+#define A42 (-9./10.)
+#define A43 (6./5.)
+#define A51 (-11./54.)
+#define A52 (5./2.)
+#define A53 (-70./27.)
+#define A54 (35./27.)
+#define A61 (1631./55296.)
+#define A62 (175./512.)
+#define A63 (575./13824.)
+#define A64 (44275./110592.)
+#define A65 (253./4096.)
+#define B1 (37./378.)
+#define B3 (250./621.)
+#define B4 (125./594.)
+#define B6 (512./1771.)
+#define BB1 (2825./27648.)
+#define BB3 (18575./48384.)
+#define BB4 (13525./55296.)
+#define BB5 (277./14336.)
+#define BB6 (1./4.)
+
+AdaptiveRKCK::Parameters::Parameters() : absolute_tolerance(1E-6), relative_tolerance(1E-6), dt_min(1E-9), dt_max(0)
+{
+}
+
+AdaptiveRKCK::AdaptiveRKCK(const Parameters& parameters_, const size_t nb_of_states) :
+        parameters(parameters_),
+        k2(nb_of_states, 0),
+        k3(nb_of_states, 0),
+        k4(nb_of_states, 0),
+        k5(nb_of_states, 0),
+        k6(nb_of_states, 0),
+        y(nb_of_states, 0)
+{
+}
+
+void AdaptiveRKCK::do_step(const RHS& f, const StateType& x, const StateType& k1, const double t, const double dt, StateType& x_high, StateType& x_low)
+{
+    const size_t n = x.size();
+    for (size_t i = 0 ; i < n ; ++i) y[i] = x[i] + dt*A21*k1[i];
+    f(y, k2, t + dt/5.);
+    for (size_t i = 0 ; i < n ; ++i) y[i] = x[i] + dt*(A31*k1[i] + A32*k2[i]);
+    f(y, k3, t + 3.*dt/10.);
+    for (size_t i = 0 ; i < n ; ++i) y[i] = x[i] + dt*(A41*k1[i] + A42*k2[i] + A43*k3[i]);
+    f(y, k4, t + 3.*dt/5.);
+    for (size_t i = 0 ; i < n ; ++i) y[i] = x[i] + dt*(A51*k1[i] + A52*k2[i] + A53*k3[i] + A54*k4[i]);
+    f(y, k5, t + dt);
+    for (size_t i = 0 ; i < n ; ++i) y[i] = x[i] + dt*(A61*k1[i] + A62*k2[i] + A63*k3[i] + A64*k4[i] + A65*k5[i]);
+    f(y, k6, t + 7.*dt/8.);
+    x_high.resize(n);
+    x_low.resize(n);
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        x_high[i] = x[i] + dt*(B1*k1[i] + B3*k3[i] + B4*k4[i] + B6*k6[i]);
+        x_low[i]  = x[i] + dt*(BB1*k1[i] + BB3*k3[i] + BB4*k4[i] + BB5*k5[i] + BB6*k6[i]);
+    }
+}
+
+double AdaptiveRKCK::error(const StateType& x, const StateType& x_high, const StateType& x_low) const
+{
+    double err = 0;
+    for (size_t i = 0 ; i < x.size() ; ++i)
+    {
+        const double scale = parameters.absolute_tolerance + parameters.relative_tolerance*std::max(std::abs(x[i]), std::abs(x_high[i]));
+        const double e = std::abs(x_high[i]-x_low[i])/scale;
+        if (std::isnan(e) or std::isnan(x_high[i])) return HUGE_VAL;
+        err = std::max(err, e);
+    }
+    return err;
+}
+
+double AdaptiveRKCK::next_dt(const double dt, const double err, const double t) const
+{
+    const bool rejected = err > 1;
+    double factor = err == 0 ? 5 : 0.9*std::pow(err, -0.2);
+    factor = std::max(0.2, std::min(rejected ? 1. : 5., factor));
+    double ret = dt*factor;
+    if (parameters.dt_max > 0) ret = std::min(ret, parameters.dt_max);
+    if (rejected and (ret < parameters.dt_min))
+    {
+        THROW(__PRETTY_FUNCTION__, NumericalErrorException, "At t = " << t << ", the step size of the adaptive Runge-Kutta-Cash-Karp solver would have to be reduced below "
+                << parameters.dt_min << " s to reach the requested tolerances (scaled error: " << err << ").");
+    }
+    return ret;
+}
+
+void AdaptiveRKCK::interpolate(const StateType& x0, const StateType& dx0_dt, const double t0,
+                               const StateType& x1, const StateType& dx1_dt, const double t1,
+                               const double t, StateType& x)
+{
+    const double h = t1 - t0;
+    const double s = (t - t0)/h;
+    const double h00 = (1+2*s)*(1-s)*(1-s);
+    const double h10 = s*(1-s)*(1-s);
+    const double h01 = s*s*(3-2*s);
+    const double h11 = s*s*(s-1);
+    x.resize(x0.size());
+    for (size_t i = 0 ; i < x0.size() ; ++i)
+    {
+        x[i] = h00*x0[i] + h*h10*dx0_dt[i] + h01*x1[i] + h*h11*dx1_dt[i];
+    }
+}
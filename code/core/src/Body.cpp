@@ -12,19 +12,41 @@
 #include "YamlBody.hpp"
 #include "NumericalErrorException.hpp"
 
-Body::Body(const size_t i, const BlockedDOF& blocked_states_) : states(), idx(i), blocked_states(blocked_states_)
+Body::Body(const size_t i, const BlockedDOF& blocked_states_) : states(), idx(i), blocked_states(blocked_states_), states_addressing(get_states_addressing(states.name)), x_with_forced_states()
 {
 }
 
-Body::Body(const BodyStates& s, const size_t i, const BlockedDOF& blocked_states_) : states(s), idx(i), blocked_states(blocked_states_)
+Body::Body(const BodyStates& s, const size_t i, const BlockedDOF& blocked_states_) : states(s), idx(i), blocked_states(blocked_states_), states_addressing(get_states_addressing(states.name)), x_with_forced_states()
 {
 }
 
+std::vector<DataAddressing> Body::get_states_addressing(const std::string& name)
+{
+    std::vector<DataAddressing> ret;
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",name,"X"},std::string("x(")+name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",name,"Y"},std::string("y(")+name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",name,"Z"},std::string("z(")+name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",name,"U"},std::string("u(")+name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",name,"V"},std::string("v(")+name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",name,"W"},std::string("w(")+name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",name,"P"},std::string("p(")+name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",name,"Q"},std::string("q(")+name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",name,"R"},std::string("r(")+name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",name,"Quat","Qr"},std::string("qr(")+name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",name,"Quat","Qi"},std::string("qi(")+name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",name,"Quat","Qj"},std::string("qj(")+name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",name,"Quat","Qk"},std::string("qk(")+name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",name,"PHI"},std::string("phi(")+name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",name,"THETA"},std::string("theta(")+name+")"));
+    ret.push_back(DataAddressing(std::vector<std::string>{"states",name,"PSI"},std::string("psi(")+name+")"));
+    return ret;
+}
+
 Body::~Body()
 {
 }
 
-BodyStates Body::get_states() const
+const BodyStates& Body::get_states() const
 {
     return states;
 }
@@ -61,7 +83,7 @@ ssc::kinematics::Transform Body::get_transform_from_ned_to_local_ned(const State
     return ssc::kinematics::Transform(get_origin(x), std::string("NED(") + states.name + ")");
 }
 
-void Body::update_kinematics(StateType x, const ssc::kinematics::KinematicsPtr& k) const
+void Body::update_kinematics(const StateType& x, const ssc::kinematics::KinematicsPtr& k) const
 {
     k->add(get_transform_from_ned_to_body(x));
     k->add(get_transform_from_ned_to_local_ned(x));
@@ -73,9 +95,11 @@ StateType Body::block_states_if_necessary(StateType x, const double t) const
     return x;
 }
 
-void Body::update_body_states(StateType x, const double t)
+void Body::update_body_states(const StateType& x_, const double t)
 {
-    blocked_states.force_states(x,t);
+    x_with_forced_states = x_;
+    blocked_states.force_states(x_with_forced_states,t);
+    const StateType& x = x_with_forced_states;
     states.x.record(t, *_X(x,idx));
     states.y.record(t, *_Y(x,idx));
     states.z.record(t, *_Z(x,idx));
@@ -121,6 +145,7 @@ void Body::update(const EnvironmentAndFrames& env, const StateType& x, const dou
     CHECK(*_QJ(x,idx),"QJ",t);
     CHECK(*_QK(x,idx),"QK",t);
     update_kinematics(x,env.k);
+    env.transforms->invalidate();
     update_body_states(x, t);
     update_intersection_with_free_surface(env, t);
     update_projection_of_z_in_mesh_frame(env.g, env.k);
@@ -177,23 +202,24 @@ BlockedDOF::Vector Body::get_delta_F(const StateType& dx_dt, const ssc::kinemati
 
 void Body::feed(const StateType& x, Observer& observer, const YamlRotation& c) const
 {
-    observer.write(*_X(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"X"},std::string("x(")+states.name+")"));
-    observer.write(*_Y(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"Y"},std::string("y(")+states.name+")"));
-    observer.write(*_Z(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"Z"},std::string("z(")+states.name+")"));
-    observer.write(*_U(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"U"},std::string("u(")+states.name+")"));
-    observer.write(*_V(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"V"},std::string("v(")+states.name+")"));
-    observer.write(*_W(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"W"},std::string("w(")+states.name+")"));
-    observer.write(*_P(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"P"},std::string("p(")+states.name+")"));
-    observer.write(*_Q(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"Q"},std::string("q(")+states.name+")"));
-    observer.write(*_R(x,idx), DataAddressing(std::vector<std::string>{"states",states.name,"R"},std::string("r(")+states.name+")"));
-    observer.write(*_QR(x,idx),DataAddressing(std::vector<std::string>{"states",states.name,"Quat","Qr"},std::string("qr(")+states.name+")"));
-    observer.write(*_QI(x,idx),DataAddressing(std::vector<std::string>{"states",states.name,"Quat","Qi"},std::string("qi(")+states.name+")"));
-    observer.write(*_QJ(x,idx),DataAddressing(std::vector<std::string>{"states",states.name,"Quat","Qj"},std::string("qj(")+states.name+")"));
-    observer.write(*_QK(x,idx),DataAddressing(std::vector<std::string>{"states",states.name,"Quat","Qk"},std::string("qk(")+states.name+")"));
+    const std::vector<DataAddressing>& a = states_addressing;
+    observer.write(*_X(x,idx), a[0]);
+    observer.write(*_Y(x,idx), a[1]);
+    observer.write(*_Z(x,idx), a[2]);
+    observer.write(*_U(x,idx), a[3]);
+    observer.write(*_V(x,idx), a[4]);
+    observer.write(*_W(x,idx), a[5]);
+    observer.write(*_P(x,idx), a[6]);
+    observer.write(*_Q(x,idx), a[7]);
+    observer.write(*_R(x,idx), a[8]);
+    observer.write(*_QR(x,idx),a[9]);
+    observer.write(*_QI(x,idx),a[10]);
+    observer.write(*_QJ(x,idx),a[11]);
+    observer.write(*_QK(x,idx),a[12]);
     const auto angles = get_angles(x, c);
-    observer.write(angles.phi, DataAddressing(std::vector<std::string>{"states",states.name,"PHI"},std::string("phi(")+states.name+")"));
-    observer.write(angles.theta, DataAddressing(std::vector<std::string>{"states",states.name,"THETA"},std::string("theta(")+states.name+")"));
-    observer.write(angles.psi, DataAddressing(std::vector<std::string>{"states",states.name,"PSI"},std::string("psi(")+states.name+")"));
+    observer.write(angles.phi, a[13]);
+    observer.write(angles.theta, a[14]);
+    observer.write(angles.psi, a[15]);
 }
 
 std::string Body::get_name() const
@@ -221,6 +247,67 @@ void Body::set_states_history(const AbstractStates<History>& s)
     states = s;
 }
 
+void append(History& h, const History& new_samples);
+void append(History& h, const History& new_samples)
+{
+    for (size_t i = 0 ; i < new_samples.size() ; ++i)
+    {
+        const auto sample = new_samples[(int)i];
+        h.record(sample.first, sample.second);
+    }
+}
+
+void Body::append_states_history(const AbstractStates<History>& s)
+{
+    append(states.x, s.x);
+    append(states.y, s.y);
+    append(states.z, s.z);
+    append(states.u, s.u);
+    append(states.v, s.v);
+    append(states.w, s.w);
+    append(states.p, s.p);
+    append(states.q, s.q);
+    append(states.r, s.r);
+    append(states.qr, s.qr);
+    append(states.qi, s.qi);
+    append(states.qj, s.qj);
+    append(states.qk, s.qk);
+}
+
+void Body::save_states_history_checkpoint()
+{
+    states.x.save_checkpoint();
+    states.y.save_checkpoint();
+    states.z.save_checkpoint();
+    states.u.save_checkpoint();
+    states.v.save_checkpoint();
+    states.w.save_checkpoint();
+    states.p.save_checkpoint();
+    states.q.save_checkpoint();
+    states.r.save_checkpoint();
+    states.qr.save_checkpoint();
+    states.qi.save_checkpoint();
+    states.qj.save_checkpoint();
+    states.qk.save_checkpoint();
+}
+
+void Body::rewind_states_history_to_checkpoint()
+{
+    states.x.rewind_to_checkpoint();
+    states.y.rewind_to_checkpoint();
+    states.z.rewind_to_checkpoint();
+    states.u.rewind_to_checkpoint();
+    states.v.rewind_to_checkpoint();
+    states.w.rewind_to_checkpoint();
+    states.p.rewind_to_checkpoint();
+    states.q.rewind_to_checkpoint();
+    states.r.rewind_to_checkpoint();
+    states.qr.rewind_to_checkpoint();
+    states.qi.rewind_to_checkpoint();
+    states.qj.rewind_to_checkpoint();
+    states.qk.rewind_to_checkpoint();
+}
+
 void Body::reset_history()
 {
     states.x.reset();
@@ -10,12 +10,12 @@
 #include "BodyWithSurfaceForces.hpp"
 #include "BodyWithoutSurfaceForces.hpp"
 #include "HDBParser.hpp"
+#include "InputCache.hpp"
 #include "MeshBuilder.hpp"
 #include "YamlBody.hpp"
 #include "yaml2eigen.hpp"
 
 #include <ssc/kinematics.hpp>
-#include <ssc/text_file_reader.hpp>
 
 bool isSymmetric(const Eigen::MatrixXd& m)
 {
@@ -108,8 +108,7 @@ void BodyBuilder::add_inertia(BodyStates& states, const YamlDynamics6x6Matrix& r
     Eigen::Matrix<double,6,6> Ma;
     if (added_mass.read_from_file)
     {
-        const std::string hdb = ssc::text_file_reader::TextFileReader(std::vector<std::string>(1,added_mass.hdb_filename)).get_contents();
-        Ma = HDBParser(hdb).get_added_mass();
+        Ma = InputCache::hdb(added_mass.hdb_filename)->get_added_mass();
     }
     else
     {
@@ -24,7 +24,11 @@ ControllableForceModel::ControllableForceModel(const std::string& name_, const s
     body_name(body_name_),
     position_of_frame(internal_frame),
     latest_force_in_body_frame(),
-    from_internal_frame_to_a_known_frame(make_transform(position_of_frame, name, env.rot))
+    from_internal_frame_to_a_known_frame(make_transform(position_of_frame, name, env.rot)),
+    body_frame_addressing(get_wrench_addressing(name, body_name, body_name)),
+    internal_frame_addressing(get_wrench_addressing(name, body_name, name)),
+    ned_frame_addressing(get_wrench_addressing(name, body_name, "NED")),
+    body_to_internal_frame(env.transforms->get_handle(body_name, name))
 {
     env.k->add(from_internal_frame_to_a_known_frame);
 }
@@ -50,13 +54,30 @@ std::map<std::string,double> ControllableForceModel::get_commands(ssc::data_sour
     return ret;
 }
 
+void ControllableForceModel::start_computing_force(const BodyStates& states, const double t, ssc::data_source::DataSource& command_listener)
+{
+    if (computes_force_asynchronously())
+    {
+        start_force(states, t, get_commands(command_listener, t));
+    }
+}
+
+bool ControllableForceModel::computes_force_asynchronously() const
+{
+    return false;
+}
+
+void ControllableForceModel::start_force(const BodyStates& , const double , const std::map<std::string,double>& )
+{
+}
+
 ssc::kinematics::Wrench ControllableForceModel::operator()(const BodyStates& states, const double t, ssc::data_source::DataSource& command_listener, const ssc::kinematics::KinematicsPtr& k, const ssc::kinematics::Point& G)
 {
     const auto F = get_force(states,t,get_commands(command_listener,t));
     const Eigen::Vector3d force(F(0),F(1),F(2));
     const Eigen::Vector3d torque(F(3),F(4),F(5));
     const auto tau_in_internal_frame = ssc::kinematics::UnsafeWrench(ssc::kinematics::Point(name, 0, 0, 0), force, torque);
-    ssc::kinematics::Transform T = k->get(body_name, name);
+    const ssc::kinematics::Transform& T = env.transforms->get(k, body_to_internal_frame);
 
     // Origin of the internal frame is P
     // G is the point (not the origin) of the body frame where the forces are summed
@@ -155,26 +176,29 @@ void ControllableForceModel::feed(Observer& observer, ssc::kinematics::Kinematic
     const auto force_in_ned_frame_at_O = rot_from_body_frame_to_ned*tau_in_body_frame_at_G.force;
     const auto torque_in_ned_frame_at_O = rot_from_body_frame_to_ned*(tau_in_body_frame_at_G.torque+OG.cross(tau_in_body_frame_at_G.force));;
 
-    observer.write(tau_in_body_frame_at_G.X(),DataAddressing(std::vector<std::string>{"efforts",body_name,name,body_name,"Fx"},std::string("Fx(")+name+","+body_name+","+body_name+")"));
-    observer.write(tau_in_body_frame_at_G.Y(),DataAddressing(std::vector<std::string>{"efforts",body_name,name,body_name,"Fy"},std::string("Fy(")+name+","+body_name+","+body_name+")"));
-    observer.write(tau_in_body_frame_at_G.Z(),DataAddressing(std::vector<std::string>{"efforts",body_name,name,body_name,"Fz"},std::string("Fz(")+name+","+body_name+","+body_name+")"));
-    observer.write(tau_in_body_frame_at_G.K(),DataAddressing(std::vector<std::string>{"efforts",body_name,name,body_name,"Mx"},std::string("Mx(")+name+","+body_name+","+body_name+")"));
-    observer.write(tau_in_body_frame_at_G.M(),DataAddressing(std::vector<std::string>{"efforts",body_name,name,body_name,"My"},std::string("My(")+name+","+body_name+","+body_name+")"));
-    observer.write(tau_in_body_frame_at_G.N(),DataAddressing(std::vector<std::string>{"efforts",body_name,name,body_name,"Mz"},std::string("Mz(")+name+","+body_name+","+body_name+")"));
-
-    observer.write((double)force_in_internal_frame_at_P(0),DataAddressing(std::vector<std::string>{"efforts",body_name,name,name,"Fx"},std::string("Fx(")+name+","+body_name+","+name+")"));
-    observer.write((double)force_in_internal_frame_at_P(1),DataAddressing(std::vector<std::string>{"efforts",body_name,name,name,"Fy"},std::string("Fy(")+name+","+body_name+","+name+")"));
-    observer.write((double)force_in_internal_frame_at_P(2),DataAddressing(std::vector<std::string>{"efforts",body_name,name,name,"Fz"},std::string("Fz(")+name+","+body_name+","+name+")"));
-    observer.write((double)torque_in_internal_frame_at_P(0),DataAddressing(std::vector<std::string>{"efforts",body_name,name,name,"Mx"},std::string("Mx(")+name+","+body_name+","+name+")"));
-    observer.write((double)torque_in_internal_frame_at_P(1),DataAddressing(std::vector<std::string>{"efforts",body_name,name,name,"My"},std::string("My(")+name+","+body_name+","+name+")"));
-    observer.write((double)torque_in_internal_frame_at_P(2),DataAddressing(std::vector<std::string>{"efforts",body_name,name,name,"Mz"},std::string("Mz(")+name+","+body_name+","+name+")"));
-
-    observer.write((double)force_in_ned_frame_at_O(0),DataAddressing(std::vector<std::string>{"efforts",body_name,name,"NED","Fx"},std::string("Fx(")+name+","+body_name+",NED)"));
-    observer.write((double)force_in_ned_frame_at_O(1),DataAddressing(std::vector<std::string>{"efforts",body_name,name,"NED","Fy"},std::string("Fy(")+name+","+body_name+",NED)"));
-    observer.write((double)force_in_ned_frame_at_O(2),DataAddressing(std::vector<std::string>{"efforts",body_name,name,"NED","Fz"},std::string("Fz(")+name+","+body_name+",NED)"));
-    observer.write((double)torque_in_ned_frame_at_O(0),DataAddressing(std::vector<std::string>{"efforts",body_name,name,"NED","Mx"},std::string("Mx(")+name+","+body_name+",NED)"));
-    observer.write((double)torque_in_ned_frame_at_O(1),DataAddressing(std::vector<std::string>{"efforts",body_name,name,"NED","My"},std::string("My(")+name+","+body_name+",NED)"));
-    observer.write((double)torque_in_ned_frame_at_O(2),DataAddressing(std::vector<std::string>{"efforts",body_name,name,"NED","Mz"},std::string("Mz(")+name+","+body_name+",NED)"));
+    const WrenchAddressing& b = body_frame_addressing;
+    observer.write(tau_in_body_frame_at_G.X(),b[0]);
+    observer.write(tau_in_body_frame_at_G.Y(),b[1]);
+    observer.write(tau_in_body_frame_at_G.Z(),b[2]);
+    observer.write(tau_in_body_frame_at_G.K(),b[3]);
+    observer.write(tau_in_body_frame_at_G.M(),b[4]);
+    observer.write(tau_in_body_frame_at_G.N(),b[5]);
+
+    const WrenchAddressing& i = internal_frame_addressing;
+    observer.write((double)force_in_internal_frame_at_P(0),i[0]);
+    observer.write((double)force_in_internal_frame_at_P(1),i[1]);
+    observer.write((double)force_in_internal_frame_at_P(2),i[2]);
+    observer.write((double)torque_in_internal_frame_at_P(0),i[3]);
+    observer.write((double)torque_in_internal_frame_at_P(1),i[4]);
+    observer.write((double)torque_in_internal_frame_at_P(2),i[5]);
+
+    const WrenchAddressing& n = ned_frame_addressing;
+    observer.write((double)force_in_ned_frame_at_O(0),n[0]);
+    observer.write((double)force_in_ned_frame_at_O(1),n[1]);
+    observer.write((double)force_in_ned_frame_at_O(2),n[2]);
+    observer.write((double)torque_in_ned_frame_at_O(0),n[3]);
+    observer.write((double)torque_in_ned_frame_at_O(1),n[4]);
+    observer.write((double)torque_in_ned_frame_at_O(2),n[5]);
     extra_observations(observer);
 }
 
@@ -0,0 +1,20 @@
+/*
+ * DataAddressing.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include "DataAddressing.hpp"
+
+WrenchAddressing get_wrench_addressing(const std::string& force_name, const std::string& body_name, const std::string& frame)
+{
+    const std::string suffix = std::string("(") + force_name + "," + body_name + "," + frame + ")";
+    const std::array<std::string,6> components = {{"Fx","Fy","Fz","Mx","My","Mz"}};
+    WrenchAddressing ret;
+    for (size_t i = 0 ; i < 6 ; ++i)
+    {
+        ret[i] = DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,frame,components[i]},components[i]+suffix);
+    }
+    return ret;
+}
@@ -16,6 +16,7 @@ using namespace ssc::kinematics;
 
 EnvironmentAndFrames::EnvironmentAndFrames() : w(),
                                                k(KinematicsPtr(new Kinematics())),
+                                               transforms(new TransformCache()),
                                                rho(0),
                                                nu(0),
                                                g(0),
@@ -47,6 +48,7 @@ void EnvironmentAndFrames::feed(
             {
                 bodies[i]->update_kinematics(state,k);
             }
+            transforms->invalidate();
             const auto kk = w->get_waves_on_mesh_as_a_grid(k, t);
             if(kk.z.size()!=0)
             {
@@ -13,8 +13,18 @@ ForceModel::ForceModel(const std::string& force_name_, const std::string& body_n
     force_name(force_name_),
     body_name(body_name_),
     force_in_body_frame(),
-    force_in_ned_frame()
+    force_in_ned_frame(),
+    extra_observations_addressing(),
+    body_frame_addressing(),
+    ned_frame_addressing()
 {
+    build_addressing();
+}
+
+void ForceModel::build_addressing()
+{
+    body_frame_addressing = get_wrench_addressing(force_name, body_name, body_name);
+    ned_frame_addressing = get_wrench_addressing(force_name, body_name, "NED");
 }
 
 bool ForceModel::is_a_surface_force_model() const
@@ -29,7 +39,11 @@ std::string ForceModel::get_name() const
 
 void ForceModel::update(const BodyStates& body, const double t)
 {
-    body_name = body.name;
+    if (body.name != body_name)
+    {
+        body_name = body.name;
+        build_addressing();
+    }
     force_in_body_frame = this->operator()(body, t);
     force_in_ned_frame = project_into_NED_frame(force_in_body_frame, body.get_rot_from_ned_to_body());
 }
@@ -51,19 +65,21 @@ ssc::kinematics::Wrench ForceModel::get_force_in_ned_frame() const
 
 void ForceModel::feed(Observer& observer) const
 {
-    observer.write(force_in_body_frame.X(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,body_name,"Fx"},std::string("Fx(")+force_name+","+body_name+","+body_name+")"));
-    observer.write(force_in_body_frame.Y(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,body_name,"Fy"},std::string("Fy(")+force_name+","+body_name+","+body_name+")"));
-    observer.write(force_in_body_frame.Z(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,body_name,"Fz"},std::string("Fz(")+force_name+","+body_name+","+body_name+")"));
-    observer.write(force_in_body_frame.K(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,body_name,"Mx"},std::string("Mx(")+force_name+","+body_name+","+body_name+")"));
-    observer.write(force_in_body_frame.M(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,body_name,"My"},std::string("My(")+force_name+","+body_name+","+body_name+")"));
-    observer.write(force_in_body_frame.N(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,body_name,"Mz"},std::string("Mz(")+force_name+","+body_name+","+body_name+")"));
+    const WrenchAddressing& b = body_frame_addressing;
+    observer.write(force_in_body_frame.X(),b[0]);
+    observer.write(force_in_body_frame.Y(),b[1]);
+    observer.write(force_in_body_frame.Z(),b[2]);
+    observer.write(force_in_body_frame.K(),b[3]);
+    observer.write(force_in_body_frame.M(),b[4]);
+    observer.write(force_in_body_frame.N(),b[5]);
 
-    observer.write(force_in_ned_frame.X(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,"NED","Fx"},std::string("Fx(")+force_name+","+body_name+",NED)"));
-    observer.write(force_in_ned_frame.Y(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,"NED","Fy"},std::string("Fy(")+force_name+","+body_name+",NED)"));
-    observer.write(force_in_ned_frame.Z(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,"NED","Fz"},std::string("Fz(")+force_name+","+body_name+",NED)"));
-    observer.write(force_in_ned_frame.K(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,"NED","Mx"},std::string("Mx(")+force_name+","+body_name+",NED)"));
-    observer.write(force_in_ned_frame.M(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,"NED","My"},std::string("My(")+force_name+","+body_name+",NED)"));
-    observer.write(force_in_ned_frame.N(),DataAddressing(std::vector<std::string>{"efforts",body_name,force_name,"NED","Mz"},std::string("Mz(")+force_name+","+body_name+",NED)"));
+    const WrenchAddressing& n = ned_frame_addressing;
+    observer.write(force_in_ned_frame.X(),n[0]);
+    observer.write(force_in_ned_frame.Y(),n[1]);
+    observer.write(force_in_ned_frame.Z(),n[2]);
+    observer.write(force_in_ned_frame.K(),n[3]);
+    observer.write(force_in_ned_frame.M(),n[4]);
+    observer.write(force_in_ned_frame.N(),n[5]);
     extra_observations(observer);
 }
 
@@ -0,0 +1,128 @@
+/*
+ * InputCache.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <atomic>
+#include <future>
+#include <map>
+#include <mutex>
+
+#include <ssc/text_file_reader.hpp>
+
+#include "HDBParser.hpp"
+#include "InputCache.hpp"
+#include "stl_reader.hpp"
+
+typedef TR1(shared_ptr)<const HDBParser> HDBPtr;
+typedef TR1(shared_ptr)<const VectorOfVectorOfPoints> STLPtr;
+typedef TR1(shared_ptr)<const std::vector<std::vector<double> > > TablesPtr;
+
+class InputCache::Impl
+{
+    public:
+        Impl() : enabled(false), mutex(), hdbs(), stls(), tables()
+        {
+        }
+
+        /**  \brief Returns the value stored for 'key', building it if necessary
+          *  \details The mutex is not held while building, so different keys are built concurrently.
+          *           If the construction fails, the key is removed (so the next call will try again)
+          *           & all threads waiting for this key get the exception.
+          */
+        template <typename T> T get(std::map<std::string, std::shared_future<T> >& cache, const std::string& key, const std::function<T()>& build)
+        {
+            if (not(enabled)) return build();
+            std::promise<T> promise;
+            std::shared_future<T> value;
+            bool must_build = false;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                const auto it = cache.find(key);
+                if (it == cache.end())
+                {
+                    value = promise.get_future().share();
+                    cache[key] = value;
+                    must_build = true;
+                }
+                else
+                {
+                    value = it->second;
+                }
+            }
+            if (must_build)
+            {
+                try
+                {
+                    promise.set_value(build());
+                }
+                catch (...)
+                {
+                    promise.set_exception(std::current_exception());
+                    std::lock_guard<std::mutex> lock(mutex);
+                    cache.erase(key);
+                }
+            }
+            return value.get();
+        }
+
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            hdbs.clear();
+            stls.clear();
+            tables.clear();
+        }
+
+        std::atomic<bool> enabled;
+        std::mutex mutex;
+        std::map<std::string, std::shared_future<HDBPtr> > hdbs;
+        std::map<std::string, std::shared_future<STLPtr> > stls;
+        std::map<std::string, std::shared_future<TablesPtr> > tables;
+
+    private:
+        Impl(const Impl&);
+        Impl& operator=(const Impl&);
+};
+
+InputCache::Impl& InputCache::get_impl()
+{
+    static Impl impl;
+    return impl;
+}
+
+void InputCache::enable()
+{
+    get_impl().enabled = true;
+}
+
+void InputCache::disable()
+{
+    get_impl().enabled = false;
+    get_impl().clear();
+}
+
+bool InputCache::is_enabled()
+{
+    return get_impl().enabled;
+}
+
+HDBPtr InputCache::hdb(const std::string& filename)
+{
+    const std::function<HDBPtr()> parse = [filename](){return HDBPtr(new HDBParser(ssc::text_file_reader::TextFileReader(std::vector<std::string>(1,filename)).get_contents()));};
+    return get_impl().get(get_impl().hdbs, filename, parse);
+}
+
+STLPtr InputCache::stl(const std::string& filename)
+{
+    const std::function<STLPtr()> parse = [filename](){return STLPtr(new VectorOfVectorOfPoints(read_stl(ssc::text_file_reader::TextFileReader(filename).get_contents())));};
+    return get_impl().get(get_impl().stls, filename, parse);
+}
+
+TablesPtr InputCache::tables(const std::string& key, const std::function<std::vector<std::vector<double> >()>& compute)
+{
+    const std::function<TablesPtr()> build = [&compute](){return TablesPtr(new std::vector<std::vector<double> >(compute()));};
+    return get_impl().get(get_impl().tables, key, build);
+}
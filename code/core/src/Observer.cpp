@@ -5,13 +5,24 @@
  *      Author: cady
  */
 
+#include <algorithm>
+
 #include "Observer.hpp"
+#include "InternalErrorException.hpp"
 #include "InvalidInputException.hpp"
 #include "Sim.hpp"
 #include "SurfaceElevationGrid.hpp"
 
-Observer::Observer(const std::vector<std::string>& data_) : initialized(false), requested_serializations(data_), serialize(), initialize()
+Observer::Observer(const std::vector<std::string>& data_) : initialized(false), requested_serializations(data_), serialize(), initialize(),
+        t_address(std::vector<std::string>(1,"t"), "t"), row(), columns(), slot_of_name(), slot_of_call(), nb_of_calls(0),
+        requested_slots(), requested_non_scalars(), values_to_serialize(), requested_columns(), nb_of_observed_slots(0), writer(),
+        first_row_was_pushed(false), nb_of_columns_pushed(0)
+{
+}
+
+void Observer::write_asynchronously(const ObserverWriterPtr& writer_)
 {
+    writer = writer_;
 }
 
 std::function<void()> Observer::get_serializer(const SurfaceElevationGrid& , const DataAddressing& )
@@ -28,79 +39,178 @@ void Observer::before_write()
 {
 }
 
+void Observer::add_columns(const std::vector<DataAddressing>& new_columns)
+{
+    THROW(__PRETTY_FUNCTION__, InternalErrorException, "This observer cannot add columns during the simulation (" << new_columns.size() << " new columns, the first one being '"
+            << (new_columns.empty() ? std::string() : new_columns.front().name) << "').");
+}
+
+void Observer::write(const double val, const DataAddressing& address)
+{
+    const size_t call = nb_of_calls++;
+    if ((call < slot_of_call.size()) and (columns[slot_of_call[call]].name == address.name))
+    {
+        row[slot_of_call[call]] = val;
+        return;
+    }
+    write_unmatched_scalar(val, address, call);
+}
+
+void Observer::write_unmatched_scalar(const double val, const DataAddressing& address, const size_t call)
+{
+    const size_t slot = register_scalar(address);
+    row[slot] = val;
+    if (call >= slot_of_call.size())
+    {
+        slot_of_call.resize(call+1, 0);
+    }
+    slot_of_call[call] = slot;
+}
+
+size_t Observer::register_scalar(const DataAddressing& address)
+{
+    const auto it = slot_of_name.find(address.name);
+    if (it != slot_of_name.end())
+    {
+        return it->second;
+    }
+    const size_t slot = row.size();
+    row.push_back(0);
+    columns.push_back(address);
+    slot_of_name[address.name] = slot;
+    return slot;
+}
+
+void Observer::start_new_row(const double t)
+{
+    nb_of_calls = 0;
+    write(t, t_address);
+}
+
 void Observer::observe(const Sim& sys, const double t)
 {
-    write(t, DataAddressing(std::vector<std::string>(1,"t"), "t"));
+    start_new_row(t);
     sys.output(sys.state,*this, t);
     initialize_serialization_of_requested_variables(requested_serializations);
-    serialize_requested_variables(requested_serializations);
+    serialize_requested_variables();
 }
 
-std::vector<std::string> all_variables(std::map<std::string, std::function<void()> >& map);
-std::vector<std::string> all_variables(std::map<std::string, std::function<void()> >& map)
+std::vector<std::string> Observer::all_variables() const
 {
     std::vector<std::string> ret;
-    std::transform(map.begin(), map.end(), std::back_inserter(ret), [](const std::pair<std::string, std::function<void()> >& p){return p.first;});
+    for (const auto& scalar:slot_of_name) ret.push_back(scalar.first);
+    for (const auto& non_scalar:initialize) ret.push_back(non_scalar.first);
+    std::sort(ret.begin(), ret.end());
     return ret;
 }
 
 void Observer::observe_everything(const Sim& sys, const double t)
 {
-    write(t, DataAddressing(std::vector<std::string>(1,"t"), "t"));
+    start_new_row(t);
     sys.output(sys.state,*this, t);
-    const auto all_vars = all_variables(initialize);
-    initialize_serialization_of_requested_variables(all_vars);
-    serialize_requested_variables(all_vars);
+    if (not(initialized))
+    {
+        initialize_serialization_of_requested_variables(all_variables());
+        nb_of_observed_slots = row.size();
+    }
+    else if (row.size() > nb_of_observed_slots)
+    {
+        serialize_new_scalars();
+    }
+    serialize_requested_variables();
+}
+
+void Observer::serialize_new_scalars()
+{
+    std::vector<DataAddressing> new_columns;
+    for (size_t slot = nb_of_observed_slots ; slot < row.size() ; ++slot)
+    {
+        requested_slots.push_back(slot);
+        requested_columns.push_back(columns[slot]);
+        new_columns.push_back(columns[slot]);
+    }
+    nb_of_observed_slots = row.size();
+    values_to_serialize.resize(requested_slots.size());
+    if (not(writer)) add_columns(new_columns); // Otherwise the new columns are handed to the I/O thread with the next row
 }
 
 void Observer::initialize_serialization_of_requested_variables(const std::vector<std::string>& variables_to_serialize)
 {
     if (not(initialized))
     {
-        const size_t n = variables_to_serialize.size();
-        size_t i = 0;
-        for (auto stuff:variables_to_serialize)
+        for (const auto& stuff:variables_to_serialize)
         {
-            auto initialize_stuff = initialize.find(stuff);
-            if (initialize_stuff == initialize.end())
+            const auto slot = slot_of_name.find(stuff);
+            if (slot != slot_of_name.end())
+            {
+                requested_slots.push_back(slot->second);
+            }
+            else if (initialize.find(stuff) != initialize.end())
+            {
+                requested_non_scalars.push_back(stuff);
+            }
+            else
             {
                 THROW(__PRETTY_FUNCTION__, InvalidInputException, "In the 'outputs' section of the YAML file, you asked for '" << stuff << "', but it is not computed: maybe it is misspelt or the corresponding model is not in the YAML.");
             }
-            initialize_stuff->second();
-            if (i<(n-1)) flush_value_during_initialization();
-            ++i;
         }
-        flush_after_initialization();
+        for (const auto slot:requested_slots) requested_columns.push_back(columns[slot]);
+        values_to_serialize.resize(requested_slots.size());
+        if (not(writer)) // Otherwise the output is initialized by the I/O thread, with the first row
+        {
+            initialize_row(requested_columns);
+            for (const auto& stuff:requested_non_scalars) initialize[stuff]();
+            flush_after_initialization();
+        }
     }
     initialized = true;
 }
 
-void Observer::serialize_requested_variables(const std::vector<std::string>& variables_to_serialize)
+void Observer::push_row_to_writer()
 {
-    const size_t n = variables_to_serialize.size();
-    size_t i = 0;
-    before_write();
-    for (auto variable_name:variables_to_serialize)
+    ObserverRow& next_row = writer->next_row();
+    next_row.observer = this;
+    next_row.initialize = not(first_row_was_pushed);
+    next_row.columns.assign(requested_columns.begin() + (long)nb_of_columns_pushed, requested_columns.end());
+    nb_of_columns_pushed = requested_columns.size();
+    next_row.values.resize(requested_slots.size());
+    for (size_t i = 0 ; i < requested_slots.size() ; ++i)
     {
-        auto serialization_functor = serialize.find(variable_name);
-        if (serialization_functor == serialize.end())
-        {
-            THROW(__PRETTY_FUNCTION__, InvalidInputException, "In the 'outputs' section of the YAML file, you asked for '" << variable_name << "', but it is not computed: maybe it is misspelt or the corresponding model is not in the YAML.");
-        }
-        serialization_functor->second();
-        if (i<(n-1)) flush_value_during_write();
-        ++i;
+        next_row.values[i] = row[requested_slots[i]];
     }
-    flush_after_write();
+    next_row.initializers.clear();
+    if (next_row.initialize)
+    {
+        for (const auto& variable_name:requested_non_scalars) next_row.initializers.push_back(initialize[variable_name]);
+    }
+    next_row.serializers.clear();
+    for (const auto& variable_name:requested_non_scalars) next_row.serializers.push_back(serialize[variable_name]);
+    writer->push();
+    first_row_was_pushed = true;
 }
 
-Observer::~Observer()
+void Observer::serialize_requested_variables()
 {
+    if (writer)
+    {
+        push_row_to_writer();
+        return;
+    }
+    before_write();
+    for (size_t i = 0 ; i < requested_slots.size() ; ++i)
+    {
+        values_to_serialize[i] = row[requested_slots[i]];
+    }
+    write_row(values_to_serialize);
+    for (const auto& variable_name:requested_non_scalars)
+    {
+        serialize[variable_name]();
+    }
+    flush_after_write();
 }
 
-void Observer::flush_value_during_initialization()
+Observer::~Observer()
 {
-    flush_value_during_write();
 }
 
 void Observer::write_before_simulation(const std::vector<FlatDiscreteDirectionalWaveSpectrum>& , const DataAddressing& )
@@ -0,0 +1,239 @@
+/*
+ * ObserverWriter.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "Observer.hpp"
+#include "ObserverWriter.hpp"
+
+ObserverRow::ObserverRow() : observer(nullptr), initialize(false), columns(), values(), initializers(), serializers()
+{
+}
+
+ObserverRow::ObserverRow(const ObserverRow& rhs) :
+        observer(rhs.observer),
+        initialize(rhs.initialize),
+        columns(rhs.columns),
+        values(rhs.values),
+        initializers(rhs.initializers),
+        serializers(rhs.serializers)
+{
+}
+
+ObserverRow& ObserverRow::operator=(const ObserverRow& rhs)
+{
+    if (this != &rhs)
+    {
+        observer = rhs.observer;
+        initialize = rhs.initialize;
+        columns = rhs.columns;
+        values = rhs.values;
+        initializers = rhs.initializers;
+        serializers = rhs.serializers;
+    }
+    return *this;
+}
+
+/**  \brief Waits a little longer each time it is called (first yields, then sleeps)
+  *  \details Used by the simulation thread while the ring is full or while it waits for the rows to be written.
+  */
+class Backoff
+{
+    public:
+        Backoff() : nb_of_calls(0)
+        {
+        }
+
+        void wait()
+        {
+            if (nb_of_calls++ < 100)
+            {
+                std::this_thread::yield();
+            }
+            else
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+
+    private:
+        size_t nb_of_calls;
+};
+
+class ObserverWriter::Impl
+{
+    public:
+        Impl(const size_t nb_of_rows) :
+            rows(std::max((size_t)1, nb_of_rows)),
+            head(0),
+            tail(0),
+            stop(false),
+            failed(false),
+            error_was_rethrown(false),
+            error(),
+            consumer_is_waiting(false),
+            mutex(),
+            not_empty(),
+            thread()
+        {
+            thread = std::thread([this](){consume();});
+        }
+
+        ObserverRow& next_row()
+        {
+            rethrow_error_if_any();
+            const size_t t = tail.load(std::memory_order_relaxed);
+            Backoff backoff;
+            while (t - head.load(std::memory_order_acquire) >= rows.size())
+            {
+                backoff.wait();
+            }
+            return rows[t % rows.size()];
+        }
+
+        void push()
+        {
+            // Sequentially consistent: either the I/O thread sees the new row before waiting, or we see it is waiting
+            tail.store(tail.load(std::memory_order_relaxed) + 1);
+            if (consumer_is_waiting.load()) wake_up_consumer();
+        }
+
+        void flush()
+        {
+            const size_t t = tail.load(std::memory_order_relaxed);
+            Backoff backoff;
+            while (head.load(std::memory_order_acquire) != t)
+            {
+                backoff.wait();
+            }
+            rethrow_error_if_any();
+        }
+
+        void join()
+        {
+            stop.store(true);
+            wake_up_consumer();
+            if (thread.joinable()) thread.join();
+        }
+
+    private:
+        Impl();
+
+        void wake_up_consumer()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            not_empty.notify_one();
+        }
+
+        /**  \brief Blocks the I/O thread until a row is pushed after row 'h' or until 'join' is called
+          */
+        void wait_for_rows(const size_t h)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            consumer_is_waiting.store(true);
+            not_empty.wait(lock, [this, h](){return (tail.load() != h) or stop.load();});
+            consumer_is_waiting.store(false);
+        }
+
+        void consume()
+        {
+            for (;;)
+            {
+                const size_t h = head.load(std::memory_order_relaxed);
+                if (h == tail.load(std::memory_order_acquire))
+                {
+                    // 'stop' is read before 'tail' is read again, so rows pushed before 'stop' was set are written
+                    if (stop.load(std::memory_order_acquire) and (h == tail.load(std::memory_order_acquire))) return;
+                    wait_for_rows(h);
+                    continue;
+                }
+                if (not(failed.load(std::memory_order_relaxed)))
+                {
+                    try
+                    {
+                        ObserverWriter::write(rows[h % rows.size()]);
+                    }
+                    catch (...)
+                    {
+                        error = std::current_exception();
+                        failed.store(true, std::memory_order_release);
+                    }
+                }
+                head.store(h + 1, std::memory_order_release);
+            }
+        }
+
+        void rethrow_error_if_any()
+        {
+            if (failed.load(std::memory_order_acquire) and not(error_was_rethrown))
+            {
+                error_was_rethrown = true;
+                std::rethrow_exception(error);
+            }
+        }
+
+        std::vector<ObserverRow> rows;
+        std::atomic<size_t> head;   //!< Number of rows written by the I/O thread
+        std::atomic<size_t> tail;   //!< Number of rows pushed by the simulation thread
+        std::atomic<bool> stop;
+        std::atomic<bool> failed;
+        bool error_was_rethrown;
+        std::exception_ptr error;
+        std::atomic<bool> consumer_is_waiting; //!< Set by the I/O thread when the ring is empty, so 'push' only locks 'mutex' when needed
+        std::mutex mutex;
+        std::condition_variable not_empty;
+        std::thread thread;
+};
+
+ObserverWriter::ObserverWriter(const size_t nb_of_rows) : pimpl(new Impl(nb_of_rows))
+{
+}
+
+ObserverWriter::~ObserverWriter()
+{
+    pimpl->join();
+}
+
+ObserverRow& ObserverWriter::next_row()
+{
+    return pimpl->next_row();
+}
+
+void ObserverWriter::push()
+{
+    pimpl->push();
+}
+
+void ObserverWriter::flush()
+{
+    pimpl->flush();
+}
+
+void ObserverWriter::write(const ObserverRow& row)
+{
+    Observer& observer = *row.observer;
+    if (row.initialize)
+    {
+        observer.initialize_row(row.columns);
+        for (const auto& initialize:row.initializers) initialize();
+        observer.flush_after_initialization();
+    }
+    else if (not(row.columns.empty()))
+    {
+        observer.add_columns(row.columns);
+    }
+    observer.before_write();
+    observer.write_row(row.values);
+    for (const auto& serialize:row.serializers) serialize();
+    observer.flush_after_write();
+}
@@ -29,31 +29,54 @@ class Sim::Impl
              const ssc::data_source::DataSource& command_listener_) :
                  bodies(bodies_), name2bodyptr(), forces(), controlled_forces(), env(env_),
                  _dx_dt(StateType(x.size(),0)), command_listener(command_listener_), sum_of_forces_in_body_frame(),
-                 sum_of_forces_in_NED_frame()
+                 sum_of_forces_in_NED_frame(), body_names(), sum_of_forces_in_body_frame_addressing(), sum_of_forces_in_NED_frame_addressing(),
+                 blocked_states_addressing(), asynchronous_forces()
         {
             size_t i = 0;
             for (auto body:bodies)
             {
-                forces[body->get_name()] = forces_.at(i);
-                controlled_forces[body->get_name()] = controlled_forces_.at(i++);
-                name2bodyptr[body->get_name()] = body;
+                const std::string body_name = body->get_name();
+                forces[body_name] = forces_.at(i);
+                controlled_forces[body_name] = controlled_forces_.at(i++);
+                name2bodyptr[body_name] = body;
+                body_names.push_back(body_name);
+                sum_of_forces_in_body_frame_addressing.push_back(get_wrench_addressing("sum of forces", body_name, body_name));
+                sum_of_forces_in_NED_frame_addressing.push_back(get_wrench_addressing("sum of forces", body_name, "NED"));
+                blocked_states_addressing.push_back(get_wrench_addressing("blocked states", body_name, body_name));
+                for (const auto& force:controlled_forces[body_name])
+                {
+                    if (force->computes_force_asynchronously()) asynchronous_forces.push_back(std::make_pair(body, force));
+                }
             }
         }
 
-        void feed_sum_of_forces(Observer& observer, const std::string& body_name)
+        void feed_sum_of_forces(Observer& observer, const size_t body_idx)
         {
-            feed_sum_of_forces(observer, sum_of_forces_in_body_frame[body_name], body_name, body_name);
-            feed_sum_of_forces(observer, sum_of_forces_in_NED_frame[body_name], body_name, "NED");
+            const std::string& body_name = body_names[body_idx];
+            feed_sum_of_forces(observer, sum_of_forces_in_body_frame[body_name], sum_of_forces_in_body_frame_addressing[body_idx]);
+            feed_sum_of_forces(observer, sum_of_forces_in_NED_frame[body_name], sum_of_forces_in_NED_frame_addressing[body_idx]);
         }
 
-        void feed_sum_of_forces(Observer& observer, ssc::kinematics::UnsafeWrench& W, const std::string& body_name, const std::string& frame)
+        void feed_sum_of_forces(Observer& observer, ssc::kinematics::UnsafeWrench& W, const WrenchAddressing& addressing)
         {
-            observer.write(W.X(),DataAddressing(std::vector<std::string>{"efforts",body_name,"sum of forces",frame,"Fx"},std::string("Fx(sum of forces,")+body_name+","+frame+")"));
-            observer.write(W.Y(),DataAddressing(std::vector<std::string>{"efforts",body_name,"sum of forces",frame,"Fy"},std::string("Fy(sum of forces,")+body_name+","+frame+")"));
-            observer.write(W.Z(),DataAddressing(std::vector<std::string>{"efforts",body_name,"sum of forces",frame,"Fz"},std::string("Fz(sum of forces,")+body_name+","+frame+")"));
-            observer.write(W.K(),DataAddressing(std::vector<std::string>{"efforts",body_name,"sum of forces",frame,"Mx"},std::string("Mx(sum of forces,")+body_name+","+frame+")"));
-            observer.write(W.M(),DataAddressing(std::vector<std::string>{"efforts",body_name,"sum of forces",frame,"My"},std::string("My(sum of forces,")+body_name+","+frame+")"));
-            observer.write(W.N(),DataAddressing(std::vector<std::string>{"efforts",body_name,"sum of forces",frame,"Mz"},std::string("Mz(sum of forces,")+body_name+","+frame+")"));
+            observer.write(W.X(),addressing[0]);
+            observer.write(W.Y(),addressing[1]);
+            observer.write(W.Z(),addressing[2]);
+            observer.write(W.K(),addressing[3]);
+            observer.write(W.M(),addressing[4]);
+            observer.write(W.N(),addressing[5]);
+        }
+
+        void feed_blocked_states(Observer& observer, const size_t body_idx)
+        {
+            const auto dF = bodies[body_idx]->get_delta_F(_dx_dt,sum_of_forces_in_body_frame[body_names[body_idx]]);
+            const WrenchAddressing& addressing = blocked_states_addressing[body_idx];
+            observer.write((double)dF(0),addressing[0]);
+            observer.write((double)dF(1),addressing[1]);
+            observer.write((double)dF(2),addressing[2]);
+            observer.write((double)dF(3),addressing[3]);
+            observer.write((double)dF(4),addressing[4]);
+            observer.write((double)dF(5),addressing[5]);
         }
 
         std::vector<BodyPtr> bodies;
@@ -65,6 +88,11 @@ class Sim::Impl
         ssc::data_source::DataSource command_listener;
         std::map<std::string,ssc::kinematics::UnsafeWrench> sum_of_forces_in_body_frame;
         std::map<std::string,ssc::kinematics::UnsafeWrench> sum_of_forces_in_NED_frame;
+        std::vector<std::string> body_names;                                   //!< Same order as 'bodies'
+        std::vector<WrenchAddressing> sum_of_forces_in_body_frame_addressing; //!< Same order as 'bodies'
+        std::vector<WrenchAddressing> sum_of_forces_in_NED_frame_addressing;  //!< Same order as 'bodies'
+        std::vector<WrenchAddressing> blocked_states_addressing;              //!< Same order as 'bodies'
+        std::vector<std::pair<BodyPtr,ControllableForcePtr> > asynchronous_forces; //!< Started for all bodies before any force is summed
 };
 
 std::map<std::string,std::vector<ForcePtr> > Sim::get_forces() const
@@ -91,10 +119,9 @@ Sim::Sim(const std::vector<BodyPtr>& bodies,
 {
 }
 
-StateType Sim::normalize_quaternions(const StateType& all_states
-                                    ) const
+void Sim::normalize_quaternions(const StateType& all_states, StateType& normalized) const
 {
-    StateType normalized = all_states;
+    normalized = all_states;
     for (size_t i = 0 ; i < pimpl->bodies.size() ; ++i)
     {
         const auto norm = std::hypot(std::hypot(std::hypot(*_QR(normalized,i),*_QI(normalized,i)),*_QJ(normalized,i)),*_QK(normalized,i));
@@ -106,13 +133,12 @@ StateType Sim::normalize_quaternions(const StateType& all_states
             *_QK(normalized,i) /= norm;
         }
     }
-    return normalized;
 }
 
 void Sim::operator()(const StateType& x, StateType& dxdt, double t)
 {
     dx_dt(x, dxdt, t);
-    state = normalize_quaternions(x);
+    normalize_quaternions(x, state);
     pimpl->_dx_dt = dxdt;
 }
 
@@ -126,9 +152,17 @@ void Sim::force_states(StateType& x, const double t) const
 
 void Sim::dx_dt(const StateType& x, StateType& dxdt, const double t)
 {
-    for (auto body: pimpl->bodies)
+    for (const auto& body: pimpl->bodies)
     {
         body->update(pimpl->env,x,t);
+    }
+    // The results are retrieved by sum_of_forces, in the same order as when the models are not asynchronous
+    for (const auto& body_and_force: pimpl->asynchronous_forces)
+    {
+        body_and_force.second->start_computing_force(body_and_force.first->get_states(), t, pimpl->command_listener);
+    }
+    for (const auto& body: pimpl->bodies)
+    {
         const auto Fext = sum_of_forces(x, body, t);
         body->calculate_state_derivatives(Fext, x, dxdt, t, pimpl->env);
     }
@@ -146,33 +180,35 @@ ssc::kinematics::UnsafeWrench Sim::sum_of_forces(const StateType& x, const BodyP
 {
     const Eigen::Vector3d uvw = body->get_uvw(x);
     const Eigen::Vector3d pqr = body->get_pqr(x);
-    const auto states = body->get_states();
-    pimpl->sum_of_forces_in_body_frame[body->get_name()] = ssc::kinematics::UnsafeWrench(coriolis_and_centripetal(states.G,states.solid_body_inertia.get(),uvw, pqr));
-    const auto forces = pimpl->forces[body->get_name()];
-    for (auto force:forces)
+    const BodyStates& states = body->get_states();
+    const std::string& body_name = states.name;
+    ssc::kinematics::UnsafeWrench& sum_of_forces_in_body_frame = pimpl->sum_of_forces_in_body_frame[body_name];
+    sum_of_forces_in_body_frame = ssc::kinematics::UnsafeWrench(coriolis_and_centripetal(states.G,states.solid_body_inertia.get(),uvw, pqr));
+    const auto& forces = pimpl->forces[body_name];
+    for (const auto& force:forces)
     {
         force->update(states, t);
         const ssc::kinematics::Wrench tau = force->get_force_in_body_frame();
-        if (tau.get_frame() != body->get_name())
+        if (tau.get_frame() != body_name)
         {
-            const ssc::kinematics::Transform T = pimpl->env.k->get(tau.get_frame(), body->get_name());
+            const ssc::kinematics::Transform& T = pimpl->env.transforms->get(pimpl->env.k, tau.get_frame(), body_name);
             const auto t = tau.change_frame_but_keep_ref_point(T);
             const ssc::kinematics::UnsafeWrench tau_body(states.G, t.force, t.torque + (t.get_point()-states.G).cross(t.force));
-            pimpl->sum_of_forces_in_body_frame[body->get_name()] += tau_body;
+            sum_of_forces_in_body_frame += tau_body;
         }
         else
         {
-            pimpl->sum_of_forces_in_body_frame[body->get_name()] += tau;
+            sum_of_forces_in_body_frame += tau;
         }
     }
-    const auto controlled_forces = pimpl->controlled_forces[body->get_name()];
-    for (auto force:controlled_forces)
+    const auto& controlled_forces = pimpl->controlled_forces[body_name];
+    for (const auto& force:controlled_forces)
     {
         const ssc::kinematics::Wrench tau = force->operator()(states, t, pimpl->command_listener, pimpl->env.k, states.G);
-        pimpl->sum_of_forces_in_body_frame[body->get_name()] += tau;
+        sum_of_forces_in_body_frame += tau;
     }
-    pimpl->sum_of_forces_in_NED_frame[body->get_name()] = ForceModel::project_into_NED_frame(pimpl->sum_of_forces_in_body_frame[body->get_name()],states.get_rot_from_ned_to_body());
-    return pimpl->sum_of_forces_in_body_frame[body->get_name()];
+    pimpl->sum_of_forces_in_NED_frame[body_name] = ForceModel::project_into_NED_frame(sum_of_forces_in_body_frame,states.get_rot_from_ned_to_body());
+    return sum_of_forces_in_body_frame;
 }
 
 ssc::kinematics::PointMatrix Sim::get_waves(const double t//!< Current instant
@@ -186,6 +222,7 @@ ssc::kinematics::PointMatrix Sim::get_waves(const double t//!< Current instant
             {
                 pimpl->bodies[i]->update_kinematics(state,pimpl->env.k);
             }
+            pimpl->env.transforms->invalidate();
             return pimpl->env.w->get_waves_on_mesh(pimpl->env.k, t);
         }
     }
@@ -203,36 +240,31 @@ void Sim::output(const StateType& x, Observer& obs, const double t) const
     {
         x_with_forced_states = body->block_states_if_necessary(x,t);
     }
-    const auto normalized_x = normalize_quaternions(x_with_forced_states);
-    for (auto forces:pimpl->forces)
+    StateType normalized_x;
+    normalize_quaternions(x_with_forced_states, normalized_x);
+    for (const auto& forces:pimpl->forces)
     {
-        for (auto force:forces.second) force->feed(obs);
+        for (const auto& force:forces.second) force->feed(obs);
     }
-    for (auto controlled_forces:pimpl->controlled_forces)
+    for (const auto& controlled_forces:pimpl->controlled_forces)
     {
-        for (auto force:controlled_forces.second)
+        for (const auto& force:controlled_forces.second)
         {
-            const auto body_name = controlled_forces.first;
+            const auto& body_name = controlled_forces.first;
             const auto body = pimpl->name2bodyptr[body_name];
             const auto G = body->get_origin(x);
             force->feed(obs,pimpl->env.k,G);
         }
     }
-    for (auto body:pimpl->bodies)
+    for (size_t i = 0 ; i < pimpl->bodies.size() ; ++i)
     {
-        body->feed(normalized_x, obs, pimpl->env.rot);
-        auto dF = body->get_delta_F(pimpl->_dx_dt,pimpl->sum_of_forces_in_body_frame[body->get_name()]);
-        obs.write((double)dF(0),DataAddressing(std::vector<std::string>{"efforts",body->get_name(),"blocked states",body->get_name(),"Fx"},std::string("Fx(blocked states,")+body->get_name()+","+body->get_name()+")"));
-        obs.write((double)dF(1),DataAddressing(std::vector<std::string>{"efforts",body->get_name(),"blocked states",body->get_name(),"Fy"},std::string("Fy(blocked states,")+body->get_name()+","+body->get_name()+")"));
-        obs.write((double)dF(2),DataAddressing(std::vector<std::string>{"efforts",body->get_name(),"blocked states",body->get_name(),"Fz"},std::string("Fz(blocked states,")+body->get_name()+","+body->get_name()+")"));
-        obs.write((double)dF(3),DataAddressing(std::vector<std::string>{"efforts",body->get_name(),"blocked states",body->get_name(),"Mx"},std::string("Mx(blocked states,")+body->get_name()+","+body->get_name()+")"));
-        obs.write((double)dF(4),DataAddressing(std::vector<std::string>{"efforts",body->get_name(),"blocked states",body->get_name(),"My"},std::string("My(blocked states,")+body->get_name()+","+body->get_name()+")"));
-        obs.write((double)dF(5),DataAddressing(std::vector<std::string>{"efforts",body->get_name(),"blocked states",body->get_name(),"Mz"},std::string("Mz(blocked states,")+body->get_name()+","+body->get_name()+")"));
+        pimpl->bodies[i]->feed(normalized_x, obs, pimpl->env.rot);
+        pimpl->feed_blocked_states(obs, i);
     }
     pimpl->env.feed(obs, t, pimpl->bodies, normalized_x);
-    for (auto body:pimpl->bodies)
+    for (size_t i = 0 ; i < pimpl->bodies.size() ; ++i)
     {
-        pimpl->feed_sum_of_forces(obs, body->get_name());
+        pimpl->feed_sum_of_forces(obs, i);
     }
 }
 
@@ -246,6 +278,40 @@ void Sim::set_bodystates(const State& states_history)
     }
 }
 
+void Sim::set_bodystates(const std::vector<State>& states_histories)
+{
+    if (states_histories.size() != pimpl->bodies.size())
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "Got " << states_histories.size() << " state histories, but the simulation has " << pimpl->bodies.size() << " bodies.");
+    }
+    bool all_histories_have_samples = true;
+    for (size_t i = 0 ; i < states_histories.size() ; ++i)
+    {
+        pimpl->bodies[i]->set_states_history(states_histories[i]);
+        all_histories_have_samples = all_histories_have_samples and not(states_histories[i].x.is_empty());
+    }
+    if (all_histories_have_samples)
+    {
+        StateType new_state;
+        new_state.reserve(13*states_histories.size());
+        for (const auto& states_history:states_histories)
+        {
+            const StateType last_state = states_history.get_StateType(states_history.x.size()-1);
+            new_state.insert(new_state.end(), last_state.begin(), last_state.end());
+        }
+        state = new_state;
+    }
+}
+
+void Sim::append_bodystates(const State& new_states)
+{
+    pimpl->bodies.at(0)->append_states_history(new_states);
+    if (not(new_states.x.is_empty()))
+    {
+        state = new_states.get_StateType(new_states.x.size()-1);
+    }
+}
+
 void Sim::set_command_listener(const std::map<std::string, double>& new_commands)
 {
     for(const auto c : new_commands)
@@ -261,3 +327,19 @@ void Sim::reset_history()
         body->reset_history();
     }
 }
+
+void Sim::save_states_histories()
+{
+    for (size_t i = 0 ; i < pimpl->bodies.size() ; ++i)
+    {
+        pimpl->bodies[i]->save_states_history_checkpoint();
+    }
+}
+
+void Sim::restore_states_histories()
+{
+    for (size_t i = 0 ; i < pimpl->bodies.size() ; ++i)
+    {
+        pimpl->bodies[i]->rewind_states_history_to_checkpoint();
+    }
+}
@@ -9,10 +9,9 @@
 
 #include "InternalErrorException.hpp"
 #include "update_kinematics.hpp"
-#include "stl_reader.hpp"
+#include "InputCache.hpp"
 #include "BodyBuilder.hpp"
 
-#include <ssc/text_file_reader.hpp>
 
 SimulatorBuilder::SimulatorBuilder(const YamlSimulatorInput& input_, const double t0_, const ssc::data_source::DataSource& command_listener_) :
                                         input(input_),
@@ -283,8 +282,7 @@ VectorOfVectorOfPoints SimulatorBuilder::get_mesh(const YamlBody& body) const
 {
     if (not(body.mesh.empty()))
     {
-        const ssc::text_file_reader::TextFileReader reader(body.mesh);
-        return read_stl(reader.get_contents());
+        return *InputCache::stl(body.mesh);
     }
     return VectorOfVectorOfPoints();
 }
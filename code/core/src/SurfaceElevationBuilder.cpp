@@ -12,8 +12,7 @@ SurfaceElevationBuilderInterface::~SurfaceElevationBuilderInterface()
 {
 }
 
-std::pair<double,double> get_wave_mesh_step_size(const YamlWaveOutput& output);
-std::pair<double,double> get_wave_mesh_step_size(const YamlWaveOutput& output)
+std::pair<double,double> SurfaceElevationBuilderInterface::get_wave_mesh_step_size(const YamlWaveOutput& output)
 {
     const double dx = (output.xmax-output.xmin)/(double)(output.nx > 1 ? output.nx-1 : 1);
     const double dy = (output.ymax-output.ymin)/(double)(output.ny > 1 ? output.ny-1 : 1);
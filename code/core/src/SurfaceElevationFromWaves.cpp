@@ -6,16 +6,87 @@
  */
 
 #include "SurfaceElevationFromWaves.hpp"
+#include "InternalErrorException.hpp"
 
 #include <ssc/exception_handling.hpp>
 
+#include <cmath>
+
+// Above this size (64 MB), the output mesh is computed from scratch at each instant
+#define MAX_NB_OF_COEFFICIENTS_FOR_OUTPUT_MESH (1 << 23)
+
+std::vector<FlatDiscreteDirectionalWaveSpectrum> get_flat_spectra(const std::vector<WaveModelPtr>& models);
+std::vector<FlatDiscreteDirectionalWaveSpectrum> get_flat_spectra(const std::vector<WaveModelPtr>& models)
+{
+    std::vector<FlatDiscreteDirectionalWaveSpectrum> spectra;
+    for (const auto& model:models) spectra.push_back(model->get_flat_spectrum());
+    return spectra;
+}
+
+/**  \brief Checks the output mesh is an axis-aligned regular grid (x varying fastest, as built by SurfaceElevationBuilderInterface::make_wave_mesh)
+  */
+bool is_a_regular_grid(const ssc::kinematics::PointMatrix& mesh, const size_t nx, const size_t ny, double& x0, double& dx, double& y0, double& dy);
+bool is_a_regular_grid(const ssc::kinematics::PointMatrix& mesh, const size_t nx, const size_t ny, double& x0, double& dx, double& y0, double& dy)
+{
+    if ((nx == 0) or (ny == 0) or ((size_t)mesh.m.cols() != nx*ny)) return false;
+    x0 = (double)mesh.m(0,0);
+    y0 = (double)mesh.m(1,0);
+    dx = nx > 1 ? ((double)mesh.m(0,(long)nx-1) - x0)/(double)(nx-1) : 0;
+    dy = ny > 1 ? ((double)mesh.m(1,(long)(nx*(ny-1))) - y0)/(double)(ny-1) : 0;
+    for (size_t j = 0 ; j < ny ; ++j)
+    {
+        for (size_t i = 0 ; i < nx ; ++i)
+        {
+            const double x = x0 + (double)i*dx;
+            const double y = y0 + (double)j*dy;
+            const long k = (long)(j*nx + i);
+            if (std::abs((double)mesh.m(0,k) - x) > 1E-9*(1 + std::abs(x))) return false;
+            if (std::abs((double)mesh.m(1,k) - y) > 1E-9*(1 + std::abs(y))) return false;
+        }
+    }
+    return true;
+}
+
+TR1(shared_ptr)<WaveElevationOnRegularGrid> build_elevation_on_output_grid(const std::vector<WaveModelPtr>& models, const ssc::kinematics::PointMatrixPtr& output_mesh, const std::pair<std::size_t,std::size_t>& output_mesh_size);
+TR1(shared_ptr)<WaveElevationOnRegularGrid> build_elevation_on_output_grid(const std::vector<WaveModelPtr>& models, const ssc::kinematics::PointMatrixPtr& output_mesh, const std::pair<std::size_t,std::size_t>& output_mesh_size)
+{
+    const size_t nx = output_mesh_size.first;
+    const size_t ny = output_mesh_size.second;
+    double x0 = 0, dx = 0, y0 = 0, dy = 0;
+    if ((output_mesh->get_frame() != "NED") or not(is_a_regular_grid(*output_mesh, nx, ny, x0, dx, y0, dy))) return TR1(shared_ptr)<WaveElevationOnRegularGrid>();
+    const std::vector<FlatDiscreteDirectionalWaveSpectrum> spectra = get_flat_spectra(models);
+    TR1(shared_ptr)<WaveElevationOnRegularGrid> ret(new WaveElevationOnRegularGrid(spectra, x0, dx, nx, y0, dy, ny));
+    // Without any component on the FFT grid, the matrix-vector product of WaveElevationOnFixedPoints is faster (if it fits in memory)
+    const bool fixed_points_fit_in_memory = WaveElevationOnFixedPoints::nb_of_coefficients(spectra, nx*ny) <= MAX_NB_OF_COEFFICIENTS_FOR_OUTPUT_MESH;
+    if ((ret->get_nb_of_components_on_grid() == 0) and fixed_points_fit_in_memory) return TR1(shared_ptr)<WaveElevationOnRegularGrid>();
+    return ret;
+}
+
+TR1(shared_ptr)<WaveElevationOnFixedPoints> build_elevation_on_output_mesh(const std::vector<WaveModelPtr>& models, const ssc::kinematics::PointMatrixPtr& output_mesh);
+TR1(shared_ptr)<WaveElevationOnFixedPoints> build_elevation_on_output_mesh(const std::vector<WaveModelPtr>& models, const ssc::kinematics::PointMatrixPtr& output_mesh)
+{
+    const size_t n = (size_t)output_mesh->m.cols();
+    if ((n == 0) or (output_mesh->get_frame() != "NED")) return TR1(shared_ptr)<WaveElevationOnFixedPoints>();
+    const std::vector<FlatDiscreteDirectionalWaveSpectrum> spectra = get_flat_spectra(models);
+    if (WaveElevationOnFixedPoints::nb_of_coefficients(spectra, n) > MAX_NB_OF_COEFFICIENTS_FOR_OUTPUT_MESH) return TR1(shared_ptr)<WaveElevationOnFixedPoints>();
+    std::vector<double> x(n), y(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        x[i] = (double)output_mesh->m(0, (long)i);
+        y[i] = (double)output_mesh->m(1, (long)i);
+    }
+    return TR1(shared_ptr)<WaveElevationOnFixedPoints>(new WaveElevationOnFixedPoints(spectra, x, y));
+}
+
 
 SurfaceElevationFromWaves::SurfaceElevationFromWaves(
         const std::vector<WaveModelPtr>& models_,
         const std::pair<std::size_t,std::size_t> output_mesh_size_,
         const ssc::kinematics::PointMatrixPtr& output_mesh_) :
                 SurfaceElevationInterface(output_mesh_, output_mesh_size_),
-                directional_spectra(models_)
+                directional_spectra(models_),
+                elevation_on_output_grid(build_elevation_on_output_grid(models_, output_mesh_, output_mesh_size_)),
+                elevation_on_output_mesh(elevation_on_output_grid.get() ? TR1(shared_ptr)<WaveElevationOnFixedPoints>() : build_elevation_on_output_mesh(models_, output_mesh_))
 {
     if(output_mesh_size_.first*output_mesh_size_.second != (std::size_t)output_mesh_->m.cols())
     {
@@ -28,7 +99,9 @@ SurfaceElevationFromWaves::SurfaceElevationFromWaves(
         const std::pair<std::size_t,std::size_t> output_mesh_size_,
         const ssc::kinematics::PointMatrixPtr& output_mesh_) :
                 SurfaceElevationInterface(output_mesh_, output_mesh_size_),
-                directional_spectra(std::vector<WaveModelPtr>(1,model))
+                directional_spectra(std::vector<WaveModelPtr>(1,model)),
+                elevation_on_output_grid(build_elevation_on_output_grid(directional_spectra, output_mesh_, output_mesh_size_)),
+                elevation_on_output_mesh(elevation_on_output_grid.get() ? TR1(shared_ptr)<WaveElevationOnFixedPoints>() : build_elevation_on_output_mesh(directional_spectra, output_mesh_))
 {
     if(output_mesh_size_.first*output_mesh_size_.second != (std::size_t)output_mesh_->m.cols())
     {
@@ -55,6 +128,29 @@ std::vector<double> SurfaceElevationFromWaves::wave_height(const std::vector<dou
     return zwave;
 }
 
+std::vector<double> SurfaceElevationFromWaves::wave_height_on_fixed_output_mesh(const double t) const
+{
+    if (elevation_on_output_grid.get()) return elevation_on_output_grid->get_elevation(t);
+    if (elevation_on_output_mesh.get()) return elevation_on_output_mesh->get_elevation(t);
+    return std::vector<double>();
+}
+
+std::array<double, 6> SurfaceElevationFromWaves::evaluate_rao_6dof(const double x, const double y, const double t, const std::vector<CartesianRAO>& rao) const
+{
+    if (rao.size() != directional_spectra.size())
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "RAO were given for " << rao.size() << " directional spectra, but the wave model has " << directional_spectra.size() << " directional spectra");
+    }
+    std::array<double, 6> F;
+    F.fill(0);
+    for (size_t spectrum_idx = 0 ; spectrum_idx < directional_spectra.size() ; ++spectrum_idx)
+    {
+        const std::array<double, 6> F_spectrum = directional_spectra[spectrum_idx]->evaluate_rao_6dof(x, y, t, rao[spectrum_idx]);
+        for (size_t k = 0 ; k < 6 ; ++k) F[k] += F_spectrum[k];
+    }
+    return F;
+}
+
 std::vector<FlatDiscreteDirectionalWaveSpectrum> SurfaceElevationFromWaves::get_flat_directional_spectra(const double, const double, const double) const
 {
     std::vector<FlatDiscreteDirectionalWaveSpectrum> ret;
@@ -72,7 +168,8 @@ std::vector<DiscreteDirectionalWaveSpectrum> SurfaceElevationFromWaves::get_dire
     ret.reserve(directional_spectra.size());
     for (const auto& spectrum:directional_spectra)
     {
-        ret.push_back(spectrum->get_spectrum());
+        const std::vector<DiscreteDirectionalWaveSpectrum> spectra = spectrum->get_directional_spectra();
+        ret.insert(ret.end(), spectra.begin(), spectra.end());
     }
     return ret;
 }
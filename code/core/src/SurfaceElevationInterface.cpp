@@ -150,6 +150,23 @@ double SurfaceElevationInterface::evaluate_rao(
     return F;
 }
 
+std::array<double, 6> SurfaceElevationInterface::evaluate_rao_6dof(const double x, const double y, const double t, const std::vector<CartesianRAO>& rao) const
+{
+    const auto directional_spectra = get_flat_directional_spectra(x, y, t);
+    if (rao.size() != directional_spectra.size())
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "RAO were given for " << rao.size() << " directional spectra, but the wave model has " << directional_spectra.size() << " directional spectra");
+    }
+    std::array<double, 6> F;
+    F.fill(0);
+    for (size_t spectrum_idx = 0 ; spectrum_idx < directional_spectra.size() ; ++spectrum_idx)
+    {
+        const std::array<double, 6> F_spectrum = ::evaluate_rao_6dof(directional_spectra[spectrum_idx], x, y, t, rao[spectrum_idx]);
+        for (size_t k = 0 ; k < 6 ; ++k) F[k] += F_spectrum[k];
+    }
+    return F;
+}
+
 std::vector<double> SurfaceElevationInterface::get_and_check_wave_height(const std::vector<double> &x, //!< x-coordinates of the points, relative to the centre of the NED frame, projected in the NED frame
                                                                const std::vector<double> &y, //!< y-coordinates of the points, relative to the centre of the NED frame, projected in the NED frame
                                                                const double t                //!< Current instant (in seconds)
@@ -256,9 +273,27 @@ ssc::kinematics::PointMatrix SurfaceElevationInterface::get_waves_on_mesh(
         ) const
 {
     if (output_mesh->m.cols()==0) return ssc::kinematics::PointMatrix("NED",0);
+    if (output_mesh->get_frame()=="NED")
+    {
+        const std::vector<double> eta = wave_height_on_fixed_output_mesh(t);
+        if (not(eta.empty()))
+        {
+            ssc::kinematics::PointMatrix ret(*output_mesh);
+            for (size_t i = 0; i < eta.size(); ++i)
+            {
+                ret.m(2, (long)i) = eta[i];
+            }
+            return ret;
+        }
+    }
     return get_points_on_free_surface(t, get_output_mesh_in_NED_frame(k));
 }
 
+std::vector<double> SurfaceElevationInterface::wave_height_on_fixed_output_mesh(const double) const
+{
+    return std::vector<double>();
+}
+
 SurfaceElevationGrid SurfaceElevationInterface::get_waves_on_mesh_as_a_grid(
         const ssc::kinematics::KinematicsPtr& k,    //!< Object used to compute the transforms to the NED frame
         const double t                              //!< Current instant (in seconds)
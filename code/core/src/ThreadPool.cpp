@@ -0,0 +1,198 @@
+/*
+ * ThreadPool.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ThreadPool.hpp"
+
+/**  \brief One call to parallel_for
+  */
+struct Loop
+{
+    Loop(const size_t n_, const std::function<void(const size_t)>& task_) : n(n_), task(task_), next(0), nb_of_tasks_done(0), mutex(), done(), error()
+    {
+    }
+
+    /**  \brief Runs the next task of this loop, if any
+      *  \returns false if all tasks have already been started
+      */
+    bool run_next_task()
+    {
+        const size_t i = next++;
+        if (i >= n) return false;
+        try
+        {
+            task(i);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (not(error)) error = std::current_exception();
+        }
+        if (++nb_of_tasks_done == n)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            done.notify_all();
+        }
+        return true;
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this]{return nb_of_tasks_done == n;});
+        if (error) std::rethrow_exception(error);
+    }
+
+    const size_t n;
+    const std::function<void(const size_t)>& task;
+    std::atomic<size_t> next;
+    std::atomic<size_t> nb_of_tasks_done;
+    std::mutex mutex;
+    std::condition_variable done;
+    std::exception_ptr error;
+
+    private:
+        Loop();
+        Loop(const Loop&);
+        Loop& operator=(const Loop&);
+};
+
+typedef TR1(shared_ptr)<Loop> LoopPtr;
+
+class ThreadPool::Impl
+{
+    public:
+        Impl(const size_t nb_of_threads_) : nb_of_threads(nb_of_threads_ ? nb_of_threads_ : 1), workers(), mutex(), new_loop(), loops(), stop(false)
+        {
+            for (size_t i = 1 ; i < nb_of_threads ; ++i) workers.push_back(std::thread([this]{work();}));
+        }
+
+        ~Impl()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stop = true;
+            }
+            new_loop.notify_all();
+            for (auto& worker:workers) worker.join();
+        }
+
+        void parallel_for(const size_t n, const std::function<void(const size_t)>& task)
+        {
+            if ((nb_of_threads == 1) or (n == 1))
+            {
+                for (size_t i = 0 ; i < n ; ++i) task(i);
+                return;
+            }
+            const LoopPtr loop(new Loop(n, task));
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                loops.push_back(loop);
+            }
+            new_loop.notify_all();
+            while (loop->run_next_task())
+            {
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                for (auto it = loops.begin() ; it != loops.end() ; ++it)
+                {
+                    if (*it == loop)
+                    {
+                        loops.erase(it);
+                        break;
+                    }
+                }
+            }
+            loop->wait();
+        }
+
+        const size_t nb_of_threads;
+
+    private:
+        Impl();
+        Impl(const Impl&);
+        Impl& operator=(const Impl&);
+
+        void work()
+        {
+            while (true)
+            {
+                LoopPtr loop;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    new_loop.wait(lock, [this]{return stop or not(loops.empty());});
+                    if (stop) return;
+                    loop = loops.front();
+                }
+                if (not(loop->run_next_task()))
+                {
+                    // All tasks of this loop have been started: let the other workers see the next loop
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (not(loops.empty()) and (loops.front() == loop)) loops.pop_front();
+                }
+            }
+        }
+
+        std::vector<std::thread> workers;
+        std::mutex mutex;
+        std::condition_variable new_loop;
+        std::deque<LoopPtr> loops;
+        bool stop;
+};
+
+std::mutex& pool_mutex();
+std::mutex& pool_mutex()
+{
+    static std::mutex ret;
+    return ret;
+}
+
+size_t& requested_nb_of_threads();
+size_t& requested_nb_of_threads()
+{
+    static size_t ret = std::thread::hardware_concurrency();
+    return ret;
+}
+
+TR1(shared_ptr)<ThreadPool::Impl>& ThreadPool::pool()
+{
+    static TR1(shared_ptr)<ThreadPool::Impl> ret;
+    return ret;
+}
+
+void ThreadPool::parallel_for(const size_t n, const std::function<void(const size_t)>& task)
+{
+    if (n == 0) return;
+    TR1(shared_ptr)<Impl> impl;
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex());
+        if (not(pool())) pool().reset(new Impl(requested_nb_of_threads()));
+        impl = pool();
+    }
+    impl->parallel_for(n, task);
+}
+
+void ThreadPool::set_nb_of_threads(const size_t nb_of_threads)
+{
+    std::lock_guard<std::mutex> lock(pool_mutex());
+    requested_nb_of_threads() = nb_of_threads;
+    pool().reset();
+}
+
+size_t ThreadPool::get_nb_of_threads()
+{
+    std::lock_guard<std::mutex> lock(pool_mutex());
+    return requested_nb_of_threads() ? requested_nb_of_threads() : 1;
+}
@@ -0,0 +1,67 @@
+/*
+ * TransformCache.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <algorithm>
+
+#include "TransformCache.hpp"
+#include "InternalErrorException.hpp"
+
+TransformCache::TransformCache() :
+        handles(),
+        frames(),
+        transforms(),
+        is_up_to_date(),
+        kinematics()
+{
+}
+
+size_t TransformCache::get_handle(const std::string& from_frame, const std::string& to_frame)
+{
+    const auto key = std::make_pair(from_frame, to_frame);
+    const auto it = handles.find(key);
+    if (it != handles.end()) return it->second;
+    const size_t handle = frames.size();
+    handles[key] = handle;
+    frames.push_back(key);
+    transforms.push_back(ssc::kinematics::Transform());
+    is_up_to_date.push_back(false);
+    return handle;
+}
+
+const ssc::kinematics::Transform& TransformCache::get(const ssc::kinematics::KinematicsPtr& k, const size_t handle)
+{
+    if (handle >= frames.size())
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "Unknown handle " << handle << ": only " << frames.size() << " pairs of frames were registered.");
+    }
+    if (k != kinematics)
+    {
+        invalidate();
+        kinematics = k;
+    }
+    if (not(is_up_to_date[handle]))
+    {
+        transforms[handle] = k->get(frames[handle].first, frames[handle].second);
+        is_up_to_date[handle] = true;
+    }
+    return transforms[handle];
+}
+
+const ssc::kinematics::Transform& TransformCache::get(const ssc::kinematics::KinematicsPtr& k, const std::string& from_frame, const std::string& to_frame)
+{
+    return get(k, get_handle(from_frame, to_frame));
+}
+
+void TransformCache::invalidate()
+{
+    std::fill(is_up_to_date.begin(), is_up_to_date.end(), false);
+}
+
+size_t TransformCache::get_nb_of_handles() const
+{
+    return frames.size();
+}
@@ -0,0 +1,25 @@
+/*
+ * AdaptiveRKCKTest.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+
+#ifndef ADAPTIVERKCKTEST_HPP_
+#define ADAPTIVERKCKTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator/DataGenerator.hpp>
+
+class AdaptiveRKCKTest : public ::testing::Test
+{
+    protected:
+        AdaptiveRKCKTest();
+        virtual ~AdaptiveRKCKTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif  /* ADAPTIVERKCKTEST_HPP_ */
@@ -0,0 +1,25 @@
+/*
+ * InputCacheTest.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+
+#ifndef INPUTCACHETEST_HPP_
+#define INPUTCACHETEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator/DataGenerator.hpp>
+
+class InputCacheTest : public ::testing::Test
+{
+    protected:
+        InputCacheTest();
+        virtual ~InputCacheTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif  /* INPUTCACHETEST_HPP_ */
@@ -0,0 +1,25 @@
+/*
+ * ObserverWriterTest.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+
+#ifndef OBSERVERWRITERTEST_HPP_
+#define OBSERVERWRITERTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator/DataGenerator.hpp>
+
+class ObserverWriterTest : public ::testing::Test
+{
+    protected:
+        ObserverWriterTest();
+        virtual ~ObserverWriterTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif  /* OBSERVERWRITERTEST_HPP_ */
@@ -0,0 +1,25 @@
+/*
+ * ThreadPoolTest.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+
+#ifndef THREADPOOLTEST_HPP_
+#define THREADPOOLTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator/DataGenerator.hpp>
+
+class ThreadPoolTest : public ::testing::Test
+{
+    protected:
+        ThreadPoolTest();
+        virtual ~ThreadPoolTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif  /* THREADPOOLTEST_HPP_ */
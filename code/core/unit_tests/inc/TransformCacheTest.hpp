@@ -0,0 +1,25 @@
+/*
+ * TransformCacheTest.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+
+#ifndef TRANSFORMCACHETEST_HPP_
+#define TRANSFORMCACHETEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator/DataGenerator.hpp>
+
+class TransformCacheTest : public ::testing::Test
+{
+    protected:
+        TransformCacheTest();
+        virtual ~TransformCacheTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif  /* TRANSFORMCACHETEST_HPP_ */
@@ -0,0 +1,36 @@
+/*
+ * allocation_counter.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef ALLOCATION_COUNTER_HPP_
+#define ALLOCATION_COUNTER_HPP_
+
+#include <cstdlib> //size_t
+
+/**  \brief Counts the heap allocations made by the current thread while it exists
+  *  \details Global operators new & delete (all variants) are replaced in allocation_counter.cpp:
+  *           they forward to malloc & free & only count the calls made by a thread in which an
+  *           AllocationCounter is alive, so the rest of the test executable is not affected.
+  *           Allocations made by other threads (eg. the thread pool) are not counted.
+  *  \snippet force_models/unit_tests/src/RadiationDampingForceModelTest.cpp RadiationDampingForceModelTest allocation_counter_example
+  */
+class AllocationCounter
+{
+    public:
+        AllocationCounter();
+        ~AllocationCounter();
+
+        /**  \brief Number of calls to operator new (or new[]) since this object was built
+          */
+        size_t get_nb_of_allocations() const;
+
+    private:
+        AllocationCounter(const AllocationCounter&);
+        AllocationCounter& operator=(const AllocationCounter&);
+        size_t nb_of_allocations_at_construction;
+};
+
+#endif  /* ALLOCATION_COUNTER_HPP_ */
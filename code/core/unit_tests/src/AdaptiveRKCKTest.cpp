@@ -0,0 +1,156 @@
+/*
+ * AdaptiveRKCKTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <cmath>
+
+#include "AdaptiveRKCK.hpp"
+#include "AdaptiveRKCKTest.hpp"
+#include "NumericalErrorException.hpp"
+
+AdaptiveRKCKTest::AdaptiveRKCKTest() : a(ssc::random_data_generator::DataGenerator(87412))
+{
+}
+
+AdaptiveRKCKTest::~AdaptiveRKCKTest()
+{
+}
+
+void AdaptiveRKCKTest::SetUp()
+{
+}
+
+void AdaptiveRKCKTest::TearDown()
+{
+}
+
+size_t integrate(AdaptiveRKCK& stepper, const AdaptiveRKCK::RHS& f, StateType& x, const double t0, const double tend, double dt);
+size_t integrate(AdaptiveRKCK& stepper, const AdaptiveRKCK::RHS& f, StateType& x, const double t0, const double tend, double dt)
+{
+    StateType dx_dt(x.size()), x_high(x.size()), x_low(x.size());
+    size_t nb_of_accepted_steps = 0;
+    double t = t0;
+    while (t < tend)
+    {
+        dt = std::min(dt, tend - t);
+        f(x, dx_dt, t);
+        stepper.do_step(f, x, dx_dt, t, dt, x_high, x_low);
+        const double err = stepper.error(x, x_high, x_low);
+        if (err <= 1)
+        {
+            t += dt;
+            x = x_high;
+            ++nb_of_accepted_steps;
+        }
+        dt = stepper.next_dt(dt, err, t);
+    }
+    return nb_of_accepted_steps;
+}
+
+TEST_F(AdaptiveRKCKTest, example)
+{
+//! [AdaptiveRKCKTest example]
+    AdaptiveRKCK::Parameters parameters;
+    parameters.absolute_tolerance = 1E-9;
+    parameters.relative_tolerance = 1E-9;
+    AdaptiveRKCK stepper(parameters, 1);
+    const AdaptiveRKCK::RHS f = [](const StateType& x, StateType& dx_dt, const double){dx_dt[0] = -x[0];};
+    StateType x(1, 1);
+    integrate(stepper, f, x, 0, 3, 0.01);
+//! [AdaptiveRKCKTest example]
+//! [AdaptiveRKCKTest expected output]
+    ASSERT_NEAR(std::exp(-3.), x[0], 1E-8);
+//! [AdaptiveRKCKTest expected output]
+}
+
+TEST_F(AdaptiveRKCKTest, tighter_tolerances_should_require_more_steps)
+{
+    const AdaptiveRKCK::RHS f = [](const StateType& x, StateType& dx_dt, const double){dx_dt[0] = x[1]; dx_dt[1] = -x[0];};
+    AdaptiveRKCK::Parameters loose;
+    loose.absolute_tolerance = 1E-4;
+    loose.relative_tolerance = 1E-4;
+    AdaptiveRKCK::Parameters tight;
+    tight.absolute_tolerance = 1E-10;
+    tight.relative_tolerance = 1E-10;
+    AdaptiveRKCK loose_stepper(loose, 2);
+    AdaptiveRKCK tight_stepper(tight, 2);
+    StateType x_loose{1,0};
+    StateType x_tight{1,0};
+    const size_t n_loose = integrate(loose_stepper, f, x_loose, 0, 10, 0.1);
+    const size_t n_tight = integrate(tight_stepper, f, x_tight, 0, 10, 0.1);
+    ASSERT_LT(n_loose, n_tight);
+    ASSERT_NEAR(std::cos(10.), x_loose[0], 1E-2);
+    ASSERT_NEAR(std::cos(10.), x_tight[0], 1E-8);
+    ASSERT_NEAR(-std::sin(10.), x_tight[1], 1E-8);
+}
+
+TEST_F(AdaptiveRKCKTest, error_should_be_zero_for_polynomials_of_degree_lower_than_four)
+{
+    AdaptiveRKCK stepper(AdaptiveRKCK::Parameters(), 1);
+    const AdaptiveRKCK::RHS f = [](const StateType&, StateType& dx_dt, const double t){dx_dt[0] = 3*t*t - 2*t + 1;};
+    StateType x(1, 2), dx_dt(1, 1), x_high(1), x_low(1);
+    const double dt = 0.5;
+    stepper.do_step(f, x, dx_dt, 0, dt, x_high, x_low);
+    ASSERT_NEAR(2 + dt*dt*dt - dt*dt + dt, x_high[0], 1E-14);
+    ASSERT_NEAR(2 + dt*dt*dt - dt*dt + dt, x_low[0], 1E-14);
+    ASSERT_NEAR(0, stepper.error(x, x_high, x_low), 1E-6);
+    ASSERT_DOUBLE_EQ(5*dt, stepper.next_dt(dt, 0, 0));
+}
+
+TEST_F(AdaptiveRKCKTest, step_should_be_reduced_when_rejected)
+{
+    const AdaptiveRKCK stepper(AdaptiveRKCK::Parameters(), 1);
+    const double dt = 0.3;
+    for (size_t i = 0 ; i < 100 ; ++i)
+    {
+        const double err = a.random<double>().between(1.001, 1E6);
+        const double new_dt = stepper.next_dt(dt, err, 0);
+        ASSERT_LT(new_dt, dt);
+        ASSERT_LE(0.2*dt, new_dt);
+    }
+}
+
+TEST_F(AdaptiveRKCKTest, step_should_not_be_increased_by_more_than_a_factor_five)
+{
+    AdaptiveRKCK::Parameters parameters;
+    const AdaptiveRKCK stepper(parameters, 1);
+    ASSERT_DOUBLE_EQ(5, stepper.next_dt(1, 1E-12, 0));
+    parameters.dt_max = 2;
+    const AdaptiveRKCK bounded_stepper(parameters, 1);
+    ASSERT_DOUBLE_EQ(2, bounded_stepper.next_dt(1, 1E-12, 0));
+}
+
+TEST_F(AdaptiveRKCKTest, should_throw_if_step_becomes_too_small)
+{
+    AdaptiveRKCK::Parameters parameters;
+    parameters.dt_min = 0.1;
+    const AdaptiveRKCK stepper(parameters, 1);
+    ASSERT_THROW(stepper.next_dt(0.15, 1E3, 0), NumericalErrorException);
+}
+
+TEST_F(AdaptiveRKCKTest, nan_should_be_rejected)
+{
+    const AdaptiveRKCK stepper(AdaptiveRKCK::Parameters(), 1);
+    const StateType x(1, 1);
+    const StateType x_high(1, std::nan(""));
+    ASSERT_GT(stepper.error(x, x_high, x), 1);
+}
+
+TEST_F(AdaptiveRKCKTest, interpolation_should_be_exact_for_cubic_polynomials)
+{
+    const auto p = [](const double t){return 2*t*t*t - t*t + 3*t - 1;};
+    const auto dp = [](const double t){return 6*t*t - 2*t + 3;};
+    const double t0 = a.random<double>().between(-10, 10);
+    const double t1 = t0 + a.random<double>().between(0.1, 2);
+    const StateType x0(1, p(t0)), dx0(1, dp(t0)), x1(1, p(t1)), dx1(1, dp(t1));
+    StateType x;
+    for (size_t i = 0 ; i < 100 ; ++i)
+    {
+        const double t = a.random<double>().between(t0, t1);
+        AdaptiveRKCK::interpolate(x0, dx0, t0, x1, dx1, t1, t, x);
+        ASSERT_NEAR(p(t), x.at(0), 1E-9*std::max(1., std::abs(p(t))));
+    }
+}
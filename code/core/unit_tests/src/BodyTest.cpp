@@ -12,6 +12,7 @@
 #include "SimulatorYamlParser.hpp"
 #include "yaml_data.hpp"
 #include "State.hpp"
+#include "allocation_counter.hpp"
 #define _USE_MATH_DEFINE
 #include <cmath>
 #define PI M_PI
@@ -333,3 +334,18 @@ TEST_F(BodyTest, can_compute_euler_angles_from_body_states)
     ASSERT_DOUBLE_EQ(body->get_states().get_angles().theta*180./PI, std::asin(-1./2.)*180./PI);
     ASSERT_DOUBLE_EQ(body->get_states().get_angles().psi*180./PI, std::atan(std::sqrt(2.))*180./PI);
 }
+
+TEST_F(BodyTest, get_states_does_not_copy_the_states)
+{
+    size_t nb_of_allocations = 0;
+    const BodyStates* states = nullptr;
+    const BodyStates* states_again = nullptr;
+    {
+        const AllocationCounter counter;
+        states = &body->get_states();
+        states_again = &body->get_states();
+        nb_of_allocations = counter.get_nb_of_allocations();
+    }
+    ASSERT_EQ(0, nb_of_allocations);
+    ASSERT_EQ(states, states_again);
+}
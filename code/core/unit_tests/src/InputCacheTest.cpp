@@ -0,0 +1,107 @@
+/*
+ * InputCacheTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <atomic>
+#include <thread>
+
+#include "InputCache.hpp"
+#include "InputCacheTest.hpp"
+#include "InvalidInputException.hpp"
+
+InputCacheTest::InputCacheTest() : a(ssc::random_data_generator::DataGenerator(54123))
+{
+}
+
+InputCacheTest::~InputCacheTest()
+{
+}
+
+void InputCacheTest::SetUp()
+{
+}
+
+void InputCacheTest::TearDown()
+{
+    InputCache::disable();
+}
+
+TEST_F(InputCacheTest, example)
+{
+//! [InputCacheTest example]
+    size_t nb_of_computations = 0;
+    const std::function<std::vector<std::vector<double> >()> compute = [&nb_of_computations](){nb_of_computations++; return std::vector<std::vector<double> >(1, std::vector<double>(3, 1.5));};
+    InputCache::enable();
+    const auto t1 = InputCache::tables("some key", compute);
+    const auto t2 = InputCache::tables("some key", compute);
+//! [InputCacheTest example]
+//! [InputCacheTest expected output]
+    ASSERT_EQ(1, nb_of_computations);
+    ASSERT_EQ(t1.get(), t2.get());
+    ASSERT_EQ(1, t2->size());
+    ASSERT_EQ(3, t2->at(0).size());
+    ASSERT_DOUBLE_EQ(1.5, t2->at(0).at(2));
+//! [InputCacheTest expected output]
+}
+
+TEST_F(InputCacheTest, cache_is_disabled_by_default)
+{
+    ASSERT_FALSE(InputCache::is_enabled());
+    size_t nb_of_computations = 0;
+    const std::function<std::vector<std::vector<double> >()> compute = [&nb_of_computations](){nb_of_computations++; return std::vector<std::vector<double> >();};
+    InputCache::tables("key", compute);
+    InputCache::tables("key", compute);
+    ASSERT_EQ(2, nb_of_computations);
+}
+
+TEST_F(InputCacheTest, different_keys_are_computed_separately)
+{
+    InputCache::enable();
+    const auto t1 = InputCache::tables("key 1", [](){return std::vector<std::vector<double> >(1, std::vector<double>(1, 1));});
+    const auto t2 = InputCache::tables("key 2", [](){return std::vector<std::vector<double> >(1, std::vector<double>(1, 2));});
+    ASSERT_DOUBLE_EQ(1, t1->at(0).at(0));
+    ASSERT_DOUBLE_EQ(2, t2->at(0).at(0));
+}
+
+TEST_F(InputCacheTest, disabling_the_cache_empties_it)
+{
+    size_t nb_of_computations = 0;
+    const std::function<std::vector<std::vector<double> >()> compute = [&nb_of_computations](){nb_of_computations++; return std::vector<std::vector<double> >();};
+    InputCache::enable();
+    InputCache::tables("key", compute);
+    InputCache::disable();
+    InputCache::enable();
+    InputCache::tables("key", compute);
+    ASSERT_EQ(2, nb_of_computations);
+}
+
+TEST_F(InputCacheTest, failed_computations_are_not_cached)
+{
+    InputCache::enable();
+    const std::function<std::vector<std::vector<double> >()> fail = [](){THROW(__PRETTY_FUNCTION__, InvalidInputException, "Something went wrong"); return std::vector<std::vector<double> >();};
+    ASSERT_THROW(InputCache::tables("key", fail), InvalidInputException);
+    const auto t = InputCache::tables("key", [](){return std::vector<std::vector<double> >(2);});
+    ASSERT_EQ(2, t->size());
+}
+
+TEST_F(InputCacheTest, each_key_is_only_computed_once_even_if_several_threads_ask_for_it)
+{
+    InputCache::enable();
+    std::atomic<size_t> nb_of_computations(0);
+    const std::function<std::vector<std::vector<double> >()> compute = [&nb_of_computations](){nb_of_computations++; return std::vector<std::vector<double> >(1, std::vector<double>(1000, 2.));};
+    std::vector<std::thread> threads;
+    std::vector<TR1(shared_ptr)<const std::vector<std::vector<double> > > > tables(8);
+    for (size_t i = 0 ; i < 8 ; ++i)
+    {
+        threads.push_back(std::thread([i, &compute, &tables](){tables[i] = InputCache::tables("key", compute);}));
+    }
+    for (auto& thread:threads) thread.join();
+    ASSERT_EQ(1, nb_of_computations);
+    for (size_t i = 1 ; i < 8 ; ++i)
+    {
+        ASSERT_EQ(tables[0].get(), tables[i].get());
+    }
+}
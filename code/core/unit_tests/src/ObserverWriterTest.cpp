@@ -0,0 +1,118 @@
+/*
+ * ObserverWriterTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <thread>
+
+#include "ObserverWriterTest.hpp"
+#include "Observer.hpp"
+#include "ObserverWriter.hpp"
+#include "InternalErrorException.hpp"
+
+ObserverWriterTest::ObserverWriterTest() : a(ssc::random_data_generator::DataGenerator(8754))
+{
+}
+
+ObserverWriterTest::~ObserverWriterTest()
+{
+}
+
+void ObserverWriterTest::SetUp()
+{
+}
+
+void ObserverWriterTest::TearDown()
+{
+}
+
+class RecordingObserver : public Observer
+{
+    public:
+        RecordingObserver(const bool throw_on_third_row_) : Observer(std::vector<std::string>()),
+            rows(), nb_of_initializations(0), thread_ids(), throw_on_third_row(throw_on_third_row_)
+        {
+        }
+        std::vector<std::vector<double> > rows;
+        size_t nb_of_initializations;
+        std::vector<std::thread::id> thread_ids;
+
+    private:
+        RecordingObserver();
+        void initialize_row(const std::vector<DataAddressing>&)
+        {
+            nb_of_initializations++;
+        }
+        void write_row(const std::vector<double>& values)
+        {
+            if (throw_on_third_row and (rows.size() == 2))
+            {
+                THROW(__PRETTY_FUNCTION__, InternalErrorException, "Disk full");
+            }
+            rows.push_back(values);
+            thread_ids.push_back(std::this_thread::get_id());
+        }
+        void flush_after_initialization() {}
+        void flush_after_write() {}
+        bool throw_on_third_row;
+};
+
+void push(ObserverWriter& writer, Observer& observer, const std::vector<double>& values, const bool initialize);
+void push(ObserverWriter& writer, Observer& observer, const std::vector<double>& values, const bool initialize)
+{
+    ObserverRow& row = writer.next_row();
+    row.observer = &observer;
+    row.initialize = initialize;
+    row.values = values;
+    writer.push();
+}
+
+TEST_F(ObserverWriterTest, rows_are_written_in_order_by_another_thread)
+{
+    RecordingObserver observer(false);
+//! [ObserverWriterTest example]
+    ObserverWriter writer(8); // Much less than the number of rows: the ring is reused
+    for (size_t i = 0 ; i < 1000 ; ++i)
+    {
+        push(writer, observer, {(double)i, 2*(double)i}, i == 0);
+    }
+    writer.flush();
+//! [ObserverWriterTest example]
+    ASSERT_EQ(1, observer.nb_of_initializations);
+    ASSERT_EQ(1000, observer.rows.size());
+    for (size_t i = 0 ; i < 1000 ; ++i)
+    {
+        ASSERT_EQ(2, observer.rows[i].size());
+        ASSERT_EQ((double)i, observer.rows[i][0]);
+        ASSERT_EQ(2*(double)i, observer.rows[i][1]);
+        ASSERT_NE(std::this_thread::get_id(), observer.thread_ids[i]);
+    }
+}
+
+TEST_F(ObserverWriterTest, destructor_writes_all_pending_rows)
+{
+    RecordingObserver observer(false);
+    {
+        ObserverWriter writer(3);
+        for (size_t i = 0 ; i < 100 ; ++i) push(writer, observer, {(double)i}, false);
+    }
+    ASSERT_EQ(100, observer.rows.size());
+    ASSERT_EQ(99, observer.rows.back().front());
+}
+
+TEST_F(ObserverWriterTest, exceptions_of_the_io_thread_are_rethrown_in_the_simulation_thread)
+{
+    RecordingObserver observer(true);
+    ObserverWriter writer(4);
+    // Depending on the progress of the I/O thread, the exception is rethrown by next_row or by flush
+    const auto push_rows_and_flush = [&writer, &observer]()
+        {
+            for (size_t i = 0 ; i < 10 ; ++i) push(writer, observer, {(double)i}, false);
+            writer.flush();
+        };
+    ASSERT_THROW(push_rows_and_flush(), InternalErrorException);
+    ASSERT_EQ(2, observer.rows.size()); // Rows following the error are not written
+    ASSERT_NO_THROW(writer.flush());    // The exception is only rethrown once
+}
@@ -15,6 +15,7 @@
 #include "YamlWaveModelInput.hpp"
 #include "YamlWaveModelInput.hpp"
 #include "Stretching.hpp"
+#include "InternalErrorException.hpp"
 #include "InvalidInputException.hpp"
 #include <ssc/kinematics.hpp>
 #define _USE_MATH_DEFINE
@@ -246,3 +247,117 @@ TEST_F(SurfaceElevationFromWavesTest, dynamic_pressure_plus_hydrostatic)
     ASSERT_NEAR(-rho*g*(cosh(h-1)/cosh(h)), pdyn.at(4), EPS);
     ASSERT_NEAR(rho*g*(1-cosh(h-1)/cosh(h)), phs5 + pdyn.at(4), EPS);
 }
+
+TEST_F(SurfaceElevationFromWavesTest, waves_on_a_mesh_defined_in_NED_should_match_the_direct_computation)
+{
+    ssc::kinematics::KinematicsPtr k(new ssc::kinematics::Kinematics());
+    YamlWaveOutput out;
+    out.frame_of_reference = "NED";
+    out.xmin = -100;
+    out.xmax = 100;
+    out.nx = 30;
+    out.ymin = -50;
+    out.ymax = 50;
+    out.ny = 10;
+    const auto output_mesh = SurfaceElevationBuilderInterface::make_wave_mesh(out);
+    std::vector<WaveModelPtr> models;
+    models.push_back(get_model(PI/4, 2, 7, 0.3, 500, 0.1, 2, 20));
+    models.push_back(get_model(-PI/3, 1, 5, 1.2, 500, 0.1, 2, 20));
+    const SurfaceElevationFromWaves wave(models, std::make_pair(30, 10), output_mesh);
+    std::vector<double> x, y;
+    for (long i = 0 ; i < output_mesh->m.cols() ; ++i)
+    {
+        x.push_back(output_mesh->m(0,i));
+        y.push_back(output_mesh->m(1,i));
+    }
+    for (size_t j = 0 ; j < 10 ; ++j)
+    {
+        const double t = a.random<double>().between(0, 3600);
+        const ssc::kinematics::PointMatrix M = wave.get_waves_on_mesh(k, t);
+        const std::vector<double> eta = wave.get_and_check_wave_height(x, y, t);
+        ASSERT_EQ("NED", M.get_frame());
+        ASSERT_EQ(300, M.m.cols());
+        for (size_t i = 0 ; i < 300 ; ++i)
+        {
+            ASSERT_DOUBLE_EQ(x[i], M.m(0,(long)i));
+            ASSERT_DOUBLE_EQ(y[i], M.m(1,(long)i));
+            ASSERT_NEAR(eta[i], M.m(2,(long)i), 1E-10);
+        }
+    }
+}
+
+TEST_F(SurfaceElevationFromWavesTest, waves_on_a_regular_grid_synthesized_by_FFT_should_match_the_direct_computation)
+{
+    ssc::kinematics::KinematicsPtr k(new ssc::kinematics::Kinematics());
+    const WaveModelPtr model = get_model(0, 2, 7, 0.3, 500, 0.1, 2, 1);
+    // Grid step such that the wave number is on the FFT grid (32 points along x)
+    const double dx = 2*PI*3/(model->get_flat_spectrum().k.at(0)*32);
+    YamlWaveOutput out;
+    out.frame_of_reference = "NED";
+    out.xmin = -10;
+    out.xmax = -10 + 31*dx;
+    out.nx = 32;
+    out.ymin = -50;
+    out.ymax = 50;
+    out.ny = 11;
+    const auto output_mesh = SurfaceElevationBuilderInterface::make_wave_mesh(out);
+    const SurfaceElevationFromWaves wave(model, std::make_pair(32, 11), output_mesh);
+    std::vector<double> x, y;
+    for (long i = 0 ; i < output_mesh->m.cols() ; ++i)
+    {
+        x.push_back(output_mesh->m(0,i));
+        y.push_back(output_mesh->m(1,i));
+    }
+    for (size_t j = 0 ; j < 10 ; ++j)
+    {
+        const double t = a.random<double>().between(0, 3600);
+        const ssc::kinematics::PointMatrix M = wave.get_waves_on_mesh(k, t);
+        const std::vector<double> eta = wave.get_and_check_wave_height(x, y, t);
+        ASSERT_EQ(32*11, M.m.cols());
+        for (size_t i = 0 ; i < 32*11 ; ++i)
+        {
+            ASSERT_NEAR(eta[i], M.m(2,(long)i), 1E-10);
+        }
+    }
+}
+
+TEST_F(SurfaceElevationFromWavesTest, evaluate_rao_6dof_should_match_evaluate_rao_for_each_degree_of_freedom)
+{
+    std::vector<WaveModelPtr> models;
+    models.push_back(get_model(PI/4, 2, 7, 0.3, 500, 0.1, 2, 20));
+    models.push_back(get_model(-PI/3, 1, 5, 1.2, 500, 0.1, 2, 30));
+    const SurfaceElevationFromWaves wave(models);
+    std::vector<CartesianRAO> rao;
+    std::array<std::vector<std::vector<double> >, 6> rao_modules;
+    std::array<std::vector<std::vector<double> >, 6> rao_phases;
+    for (const auto& model:models)
+    {
+        const size_t n = model->get_flat_spectrum().a.size();
+        rao.push_back(CartesianRAO(n));
+        for (size_t k = 0 ; k < 6 ; ++k)
+        {
+            std::vector<double> module, phase;
+            for (size_t i = 0 ; i < n ; ++i)
+            {
+                module.push_back(a.random<double>().between(0, 1E6));
+                phase.push_back(a.random<double>().between(-PI, PI));
+            }
+            rao.back().set(k, module, phase);
+            rao_modules[k].push_back(module);
+            rao_phases[k].push_back(phase);
+        }
+    }
+    for (size_t j = 0 ; j < 10 ; ++j)
+    {
+        const double x = a.random<double>().between(-100, 100);
+        const double y = a.random<double>().between(-100, 100);
+        const double t = a.random<double>().between(0, 3600);
+        const std::array<double, 6> F = wave.evaluate_rao_6dof(x, y, t, rao);
+        for (size_t k = 0 ; k < 6 ; ++k)
+        {
+            const double expected = wave.evaluate_rao(x, y, t, rao_modules[k], rao_phases[k]);
+            ASSERT_NEAR(expected, F[k], 1E-9*std::max(1., std::abs(expected)));
+        }
+    }
+    ASSERT_THROW(wave.evaluate_rao_6dof(0, 0, 0, std::vector<CartesianRAO>(1, rao.front())), InternalErrorException);
+}
@@ -0,0 +1,93 @@
+/*
+ * ThreadPoolTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "ThreadPool.hpp"
+#include "ThreadPoolTest.hpp"
+#include "InvalidInputException.hpp"
+
+ThreadPoolTest::ThreadPoolTest() : a(ssc::random_data_generator::DataGenerator(8865))
+{
+}
+
+ThreadPoolTest::~ThreadPoolTest()
+{
+}
+
+void ThreadPoolTest::SetUp()
+{
+}
+
+void ThreadPoolTest::TearDown()
+{
+    ThreadPool::set_nb_of_threads(std::thread::hardware_concurrency());
+}
+
+TEST_F(ThreadPoolTest, example)
+{
+//! [ThreadPoolTest example]
+    ThreadPool::set_nb_of_threads(4);
+    std::vector<double> squares(1000, 0);
+    ThreadPool::parallel_for(squares.size(), [&squares](const size_t i){squares[i] = (double)(i*i);});
+//! [ThreadPoolTest example]
+    for (size_t i = 0 ; i < squares.size() ; ++i) ASSERT_EQ((double)(i*i), squares[i]);
+    ASSERT_EQ(4, ThreadPool::get_nb_of_threads());
+}
+
+TEST_F(ThreadPoolTest, all_tasks_are_run_exactly_once)
+{
+    for (size_t nb_of_threads = 1 ; nb_of_threads < 6 ; ++nb_of_threads)
+    {
+        ThreadPool::set_nb_of_threads(nb_of_threads);
+        for (size_t n = 0 ; n < 50 ; ++n)
+        {
+            std::vector<std::atomic<size_t> > counts(n);
+            for (auto& c:counts) c = 0;
+            ThreadPool::parallel_for(n, [&counts](const size_t i){counts[i]++;});
+            for (size_t i = 0 ; i < n ; ++i) ASSERT_EQ(1, counts[i]) << "n = " << n << ", i = " << i << ", nb_of_threads = " << nb_of_threads;
+        }
+    }
+}
+
+TEST_F(ThreadPoolTest, exceptions_are_forwarded_to_the_caller)
+{
+    ThreadPool::set_nb_of_threads(3);
+    std::atomic<size_t> nb_of_tasks_run(0);
+    ASSERT_THROW(ThreadPool::parallel_for(20, [&nb_of_tasks_run](const size_t i)
+                                              {
+                                                  nb_of_tasks_run++;
+                                                  if (i == 7) THROW(__PRETTY_FUNCTION__, InvalidInputException, "Task 7 failed");
+                                              }), InvalidInputException);
+    ASSERT_EQ(20, nb_of_tasks_run);
+    // The pool can still be used
+    std::atomic<size_t> n(0);
+    ThreadPool::parallel_for(10, [&n](const size_t){n++;});
+    ASSERT_EQ(10, n);
+}
+
+TEST_F(ThreadPoolTest, can_be_called_concurrently_and_recursively)
+{
+    ThreadPool::set_nb_of_threads(3);
+    std::vector<std::atomic<size_t> > sums(8);
+    for (auto& s:sums) s = 0;
+    std::vector<std::thread> callers;
+    for (size_t k = 0 ; k < 4 ; ++k)
+    {
+        callers.push_back(std::thread([&sums,k]()
+            {
+                ThreadPool::parallel_for(2, [&sums,k](const size_t i)
+                    {
+                        ThreadPool::parallel_for(100, [&sums,k,i](const size_t j){sums[2*k+i] += j;});
+                    });
+            }));
+    }
+    for (auto& caller:callers) caller.join();
+    for (size_t i = 0 ; i < sums.size() ; ++i) ASSERT_EQ(4950, sums[i]);
+}
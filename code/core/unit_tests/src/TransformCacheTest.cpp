@@ -0,0 +1,77 @@
+/*
+ * TransformCacheTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include "TransformCache.hpp"
+#include "TransformCacheTest.hpp"
+#include "InternalErrorException.hpp"
+
+TransformCacheTest::TransformCacheTest() : a(ssc::random_data_generator::DataGenerator(7125))
+{
+}
+
+TransformCacheTest::~TransformCacheTest()
+{
+}
+
+void TransformCacheTest::SetUp()
+{
+}
+
+void TransformCacheTest::TearDown()
+{
+}
+
+TEST_F(TransformCacheTest, example)
+{
+//! [TransformCacheTest example]
+    ssc::kinematics::KinematicsPtr k(new ssc::kinematics::Kinematics());
+    k->add(ssc::kinematics::Transform(ssc::kinematics::Point("NED", 1, 2, 3), "body"));
+    TransformCache cache;
+    const size_t ned_to_body = cache.get_handle("NED", "body");
+    const double x0 = cache.get(k, ned_to_body).get_point().x();
+    k->add(ssc::kinematics::Transform(ssc::kinematics::Point("NED", 4, 5, 6), "body"));
+    const double x1 = cache.get(k, ned_to_body).get_point().x(); // Not recomputed
+    cache.invalidate();
+    const double x2 = cache.get(k, ned_to_body).get_point().x();
+//! [TransformCacheTest example]
+//! [TransformCacheTest expected output]
+    ASSERT_DOUBLE_EQ(1, x0);
+    ASSERT_DOUBLE_EQ(1, x1);
+    ASSERT_DOUBLE_EQ(4, x2);
+//! [TransformCacheTest expected output]
+}
+
+TEST_F(TransformCacheTest, handles_are_only_created_once_for_each_pair_of_frames)
+{
+    TransformCache cache;
+    const size_t h1 = cache.get_handle("NED", "body");
+    const size_t h2 = cache.get_handle("body", "NED");
+    ASSERT_NE(h1, h2);
+    ASSERT_EQ(h1, cache.get_handle("NED", "body"));
+    ASSERT_EQ(h2, cache.get_handle("body", "NED"));
+    ASSERT_EQ(2, cache.get_nb_of_handles());
+    ssc::kinematics::KinematicsPtr k(new ssc::kinematics::Kinematics());
+    k->add(ssc::kinematics::Transform(ssc::kinematics::Point("NED", 1, 2, 3), "body"));
+    ASSERT_DOUBLE_EQ(2, cache.get(k, "NED", "body").get_point().y());
+    ASSERT_EQ(2, cache.get_nb_of_handles());
+    ASSERT_THROW(cache.get(k, 2), InternalErrorException);
+}
+
+TEST_F(TransformCacheTest, transforms_computed_with_another_kinematics_object_are_not_used)
+{
+    ssc::kinematics::KinematicsPtr k1(new ssc::kinematics::Kinematics());
+    ssc::kinematics::KinematicsPtr k2(new ssc::kinematics::Kinematics());
+    const double z1 = a.random<double>();
+    const double z2 = a.random<double>();
+    k1->add(ssc::kinematics::Transform(ssc::kinematics::Point("NED", 0, 0, z1), "body"));
+    k2->add(ssc::kinematics::Transform(ssc::kinematics::Point("NED", 0, 0, z2), "body"));
+    TransformCache cache;
+    const size_t ned_to_body = cache.get_handle("NED", "body");
+    ASSERT_DOUBLE_EQ(z1, cache.get(k1, ned_to_body).get_point().z());
+    ASSERT_DOUBLE_EQ(z2, cache.get(k2, ned_to_body).get_point().z());
+    ASSERT_DOUBLE_EQ(z1, cache.get(k1, ned_to_body).get_point().z());
+}
@@ -0,0 +1,191 @@
+/*
+ * allocation_counter.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include "allocation_counter.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+// Plain thread-local integers: no dynamic initialization, so they can be used by operator new itself
+static thread_local size_t nb_of_active_counters = 0;
+static thread_local size_t nb_of_allocations = 0;
+
+AllocationCounter::AllocationCounter() : nb_of_allocations_at_construction(nb_of_allocations)
+{
+    ++nb_of_active_counters;
+}
+
+AllocationCounter::~AllocationCounter()
+{
+    --nb_of_active_counters;
+}
+
+size_t AllocationCounter::get_nb_of_allocations() const
+{
+    return nb_of_allocations - nb_of_allocations_at_construction;
+}
+
+void* allocate(const std::size_t size);
+void* allocate(const std::size_t size)
+{
+    if (nb_of_active_counters) ++nb_of_allocations;
+    // Same behaviour as the default operator new: call the new handler until the allocation succeeds
+    while (true)
+    {
+        void* p = std::malloc(size ? size : 1);
+        if (p) return p;
+        const std::new_handler handler = std::get_new_handler();
+        if (not(handler)) throw std::bad_alloc();
+        handler();
+    }
+}
+
+void* allocate(const std::size_t size, const std::nothrow_t&) noexcept;
+void* allocate(const std::size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return allocate(size);
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t& tag) noexcept
+{
+    return allocate(size, tag);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept
+{
+    return allocate(size, tag);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
+
+#if defined(__cpp_sized_deallocation)
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+#endif
+
+#if defined(__cpp_aligned_new)
+void* allocate(const std::size_t size, const std::align_val_t alignment);
+void* allocate(const std::size_t size, const std::align_val_t alignment)
+{
+    if (nb_of_active_counters) ++nb_of_allocations;
+    const std::size_t a = std::max(static_cast<std::size_t>(alignment), sizeof(void*));
+    while (true)
+    {
+        void* p = nullptr;
+        if (posix_memalign(&p, a, size ? size : 1) == 0) return p;
+        const std::new_handler handler = std::get_new_handler();
+        if (not(handler)) throw std::bad_alloc();
+        handler();
+    }
+}
+
+void* allocate(const std::size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept;
+void* allocate(const std::size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return allocate(size, alignment);
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return allocate(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return allocate(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t& tag) noexcept
+{
+    return allocate(size, alignment, tag);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t& tag) noexcept
+{
+    return allocate(size, alignment, tag);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::align_val_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
+#endif
@@ -35,6 +35,15 @@ class Airy : public WaveModel
                             const std::vector<double>& rao_phase //!< Phase of the RAO
                              ) const;
 
+        /**  \brief Same as evaluate_rao, for the six degrees of freedom at once (cf. CartesianRAO.hpp)
+          *  \returns Force & torque (X, Y, Z, K, M, N)
+          */
+        std::array<double, 6> evaluate_rao_6dof(const double x,         //!< x-position of the RAO's calculation point in the NED frame (in meters)
+                                                const double y,         //!< y-position of the RAO's calculation point in the NED frame (in meters)
+                                                const double t,         //!< Current time instant (in seconds)
+                                                const CartesianRAO& rao //!< RAO of the six degrees of freedom
+                                                ) const;
+
 
     private:
         Airy(); // Disabled
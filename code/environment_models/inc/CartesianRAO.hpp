@@ -0,0 +1,56 @@
+/*
+ * CartesianRAO.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef CARTESIANRAO_HPP_
+#define CARTESIANRAO_HPP_
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "DiscreteDirectionalWaveSpectrum.hpp"
+
+/** \brief Force RAO of the six degrees of freedom for each component of a (flat) directional spectrum
+ *  \details The RAO are stored as module*cos(phase) & module*sin(phase) so that the forces can be computed
+ *           from the phasor of each wave component (cf. evaluate_rao_6dof) without evaluating any trigonometric
+ *           function of the RAO's phase.
+ *  \ingroup wave_models
+ *  \section ex1 Example
+ *  \snippet environment_models/unit_tests/src/CartesianRAOTest.cpp CartesianRAOTest example
+ */
+struct CartesianRAO
+{
+    CartesianRAO();
+    CartesianRAO(const size_t nb_of_components);
+
+    /**  \brief Converts the RAO (module, phase) of one degree of freedom (using batch_sincos)
+      */
+    void set(const size_t degree_of_freedom,         //!< 0 for X, 1 for Y, 2 for Z, 3 for K, 4 for M & 5 for N
+             const std::vector<double>& rao_module,  //!< Module of the RAO, for each (omega,psi) pair
+             const std::vector<double>& rao_phase    //!< Phase of the RAO, for each (omega,psi) pair
+             );
+
+    std::array<std::vector<double>, 6> module_cos_phase; //!< RAO_module*cos(RAO_phase), for each degree of freedom & each (omega,psi) pair
+    std::array<std::vector<double>, 6> module_sin_phase; //!< RAO_module*sin(RAO_phase), for each degree of freedom & each (omega,psi) pair
+};
+
+/**  \brief Same as Airy::evaluate_rao, for the six degrees of freedom at once
+  *  \details F = -sum_i a_i*RAO_module_i*sin(theta_i + RAO_phase_i) is evaluated as
+  *           -sum_i a_i*(RAO_module_i*cos(RAO_phase_i)*sin(theta_i) + RAO_module_i*sin(RAO_phase_i)*cos(theta_i))
+  *           where theta_i = -omega_i*t + k_i*(x*cos(psi_i) + y*sin(psi_i)) + phase_i, so sin & cos of theta_i are
+  *           computed once per component (by batch_sincos) instead of once per component & per degree of freedom.
+  *           Components are processed in blocks, so no memory is allocated.
+  *  \returns Force & torque (X, Y, Z, K, M, N)
+  */
+std::array<double, 6> evaluate_rao_6dof(const FlatDiscreteDirectionalWaveSpectrum& spectrum, //!< Wave components
+                                        const double x,                                      //!< x-position of the RAO's calculation point in the NED frame (in meters)
+                                        const double y,                                      //!< y-position of the RAO's calculation point in the NED frame (in meters)
+                                        const double t,                                      //!< Current time instant (in seconds)
+                                        const CartesianRAO& rao                              //!< RAO for each component of the spectrum
+                                        );
+
+#endif /* CARTESIANRAO_HPP_ */
@@ -34,6 +34,8 @@ struct DiscreteDirectionalWaveSpectrum
 
     std::function<double(double,double,double)> pdyn_factor;    //!< Factor used when computing the dynamic pressure (no unit)
     std::function<double(double,double,double)> pdyn_factor_sh; //!< Factor used when computing the orbital velocity (no unit)
+    double depth;                                               //!< Water depth used by pdyn_factor & pdyn_factor_sh (in meters, 0 for infinite depth)
+    std::function<double(double,double)> rescaled_z;            //!< Stretching used by pdyn_factor & pdyn_factor_sh: (z,eta) -> rescaled z. Lets the wave models evaluate the depth factors for all components at once (unset if pdyn_factor is not built by 'discretize')
 };
 
 /** \brief Used by the wave models (eg. Airy, Stokes, etc.)
@@ -56,6 +58,8 @@ struct FlatDiscreteDirectionalWaveSpectrum
     std::vector<double> phase;   //!< Random phases, for each (frequency, direction) couple (but time invariant) in radian, for each angular frequency omega, and direction
     std::function<double(double,double,double)> pdyn_factor;    //!< Factor used when computing the dynamic pressure (no unit)
     std::function<double(double,double,double)> pdyn_factor_sh; //!< Factor used when computing the orbital velocity (no unit)
+    double depth;                                               //!< Water depth used by pdyn_factor & pdyn_factor_sh (in meters, 0 for infinite depth)
+    std::function<double(double,double)> rescaled_z;            //!< Stretching used by pdyn_factor & pdyn_factor_sh: (z,eta) -> rescaled z. Lets the wave models evaluate the depth factors for all components at once (unset if pdyn_factor is not built by 'discretize')
 };
 
 #endif /* DISCRETEDIRECTIONALWAVESPECTRUM_HPP_ */
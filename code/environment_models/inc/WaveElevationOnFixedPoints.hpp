@@ -0,0 +1,60 @@
+/*
+ * WaveElevationOnFixedPoints.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef WAVEELEVATIONONFIXEDPOINTS_HPP_
+#define WAVEELEVATIONONFIXEDPOINTS_HPP_
+
+#include "DiscreteDirectionalWaveSpectrum.hpp"
+
+#include <Eigen/Dense>
+#include <vector>
+
+/** \brief Airy wave elevation on points which do not move in the NED frame (eg. the wave output mesh)
+ *  \details The elevation at point p is
+ *           \f[\eta_p(t) = -\sum_i a_i\sin(\phi_{p,i} + \tau_i(t))\f]
+ *           where \f$\phi_{p,i}=k_i(x_p\cos\psi_i + y_p\sin\psi_i)\f$ only depends on the point
+ *           & \f$\tau_i(t)=-\omega_i t + \theta_i\f$ only depends on the instant. The matrix
+ *           \f$[a_i\sin\phi_{p,i}\ |\ a_i\cos\phi_{p,i}]\f$ is computed once by the constructor,
+ *           so each call to get_elevation only evaluates sin & cos of the n phases \f$\tau_i\f$
+ *           & does a matrix-vector product, instead of evaluating sin for each (point,component) pair.
+ *           Since \f$\tau_i\f$ is computed from t at each call (& not by accumulating rotations),
+ *           there is no round-off drift over long simulations.
+ *  \addtogroup wave_models
+ *  \ingroup wave_models
+ *  \section ex1 Example
+ *  \snippet environment_models/unit_tests/src/WaveElevationOnFixedPointsTest.cpp WaveElevationOnFixedPointsTest example
+ *  \section ex2 Expected output
+ *  \snippet environment_models/unit_tests/src/WaveElevationOnFixedPointsTest.cpp WaveElevationOnFixedPointsTest expected output
+ */
+class WaveElevationOnFixedPoints
+{
+    public:
+        WaveElevationOnFixedPoints(const std::vector<FlatDiscreteDirectionalWaveSpectrum>& spectra, //!< Spectra of each wave model (the elevations are summed)
+                                   const std::vector<double>& x,                                    //!< x-positions in the NED frame (in meters)
+                                   const std::vector<double>& y                                     //!< y-positions in the NED frame (in meters)
+                                   );
+
+        /**  \brief Number of coefficients the constructor would have to store
+          *  \details Used to decide whether the precomputation is worth its memory footprint (8 bytes per coefficient)
+          */
+        static size_t nb_of_coefficients(const std::vector<FlatDiscreteDirectionalWaveSpectrum>& spectra, const size_t nb_of_points);
+
+        /**  \brief Wave elevation at each point given to the constructor
+          *  \returns Surface elevations (in meters), in the same order as the points
+          */
+        std::vector<double> get_elevation(const double t //!< Current instant (in seconds)
+                                         ) const;
+
+    private:
+        WaveElevationOnFixedPoints(); // Disabled
+
+        std::vector<double> minus_omega;   //!< -omega_i for each component (in rad/s)
+        std::vector<double> phase;         //!< Random phase theta_i of each component (in radians)
+        Eigen::MatrixXd spatial_part;      //!< [a_i*sin(phi_{p,i}) | a_i*cos(phi_{p,i})] (one row per point)
+};
+
+#endif /* WAVEELEVATIONONFIXEDPOINTS_HPP_ */
@@ -0,0 +1,87 @@
+/*
+ * WaveElevationOnRegularGrid.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef WAVEELEVATIONONREGULARGRID_HPP_
+#define WAVEELEVATIONONREGULARGRID_HPP_
+
+#include "DiscreteDirectionalWaveSpectrum.hpp"
+
+#include <complex>
+#include <vector>
+
+/** \brief Airy wave elevation on a regular grid, axis-aligned in the NED frame, synthesized by inverse FFT
+ *  \details On the grid points \f$x_m = x_0 + m\,dx\f$ & \f$y_n = y_0 + n\,dy\f$, the elevation is
+ *           \f[\eta_{m,n}(t) = -\mathrm{Im}\sum_i c_i(t) e^{ik_{x,i}m\,dx}e^{ik_{y,i}n\,dy}\f]
+ *           with \f$c_i(t)=a_i e^{i(k_{x,i}x_0 + k_{y,i}y_0 - \omega_i t + \theta_i)}\f$.
+ *           The grid is embedded in a periodic grid of \f$N_x\times N_y\f$ points (the smallest powers of two
+ *           larger than \f$n_x\f$ & \f$n_y\f$). A component is "on-grid" if \f$k_{x,i}\,dx\,N_x/2\pi\f$ &
+ *           \f$k_{y,i}\,dy\,N_y/2\pi\f$ are integers: its contribution is then exactly a term of a 2D inverse
+ *           discrete Fourier transform, so all on-grid components are summed by a single inverse FFT
+ *           (\f$O(N_xN_y\log(N_xN_y))\f$ operations, whatever their number). The other components are
+ *           summed directly, using the separability of the exponential (two multiplications per point &
+ *           per component, no trigonometric function), so the result is exact (to round-off errors) for all spectra.
+ *  \addtogroup wave_models
+ *  \ingroup wave_models
+ *  \section ex1 Example
+ *  \snippet environment_models/unit_tests/src/WaveElevationOnRegularGridTest.cpp WaveElevationOnRegularGridTest example
+ *  \section ex2 Expected output
+ *  \snippet environment_models/unit_tests/src/WaveElevationOnRegularGridTest.cpp WaveElevationOnRegularGridTest expected output
+ */
+class WaveElevationOnRegularGrid
+{
+    public:
+        WaveElevationOnRegularGrid(const std::vector<FlatDiscreteDirectionalWaveSpectrum>& spectra, //!< Spectra of each wave model (the elevations are summed)
+                                   const double x0,                                                 //!< x-coordinate of the first point of the grid, in the NED frame (in meters)
+                                   const double dx,                                                 //!< Distance between two points along the x-axis (in meters)
+                                   const size_t nx,                                                 //!< Number of points along the x-axis
+                                   const double y0,                                                 //!< y-coordinate of the first point of the grid, in the NED frame (in meters)
+                                   const double dy,                                                 //!< Distance between two points along the y-axis (in meters)
+                                   const size_t ny                                                  //!< Number of points along the y-axis
+                                   );
+
+        /**  \brief Wave elevation at each point of the grid
+          *  \returns Surface elevations (in meters), x varying fastest (point (m,n) is at index n*nx+m), like the wave output mesh
+          */
+        std::vector<double> get_elevation(const double t //!< Current instant (in seconds)
+                                         ) const;
+
+        size_t get_nb_of_components_on_grid() const;
+        size_t get_nb_of_components_off_grid() const;
+
+    private:
+        WaveElevationOnRegularGrid(); // Disabled
+
+        size_t nx;
+        size_t ny;
+        size_t Nx;                                         //!< Size of the FFT along the x-axis (power of two)
+        size_t Ny;                                         //!< Size of the FFT along the y-axis (power of two)
+        std::vector<size_t> bin;                           //!< For each on-grid component, index of its coefficient in the Nx*Ny spectrum
+        std::vector<double> amplitude;                     //!< a_i for each component (on-grid components first)
+        std::vector<double> minus_omega;                   //!< -omega_i for each component (on-grid components first)
+        std::vector<double> phase_at_origin;               //!< k_xi*x0 + k_yi*y0 + theta_i for each component (on-grid components first)
+        std::vector<std::vector<std::complex<double> > > X; //!< exp(i*k_xi*m*dx) for each off-grid component & each m < nx
+        std::vector<std::vector<std::complex<double> > > Y; //!< exp(i*k_yi*n*dy) for each off-grid component & each n < ny
+        std::vector<std::complex<double> > twiddles_x;     //!< exp(2*i*pi*p/Nx) for p < Nx/2
+        std::vector<std::complex<double> > twiddles_y;     //!< exp(2*i*pi*q/Ny) for q < Ny/2
+};
+
+/**  \brief Moves each component to the nearest wave vector on the FFT grid of WaveElevationOnRegularGrid
+  *  \details \f$k_x\f$ & \f$k_y\f$ are rounded to the nearest multiples of \f$2\pi/(N_x\,dx)\f$ & \f$2\pi/(N_y\,dy)\f$
+  *           (there is no constraint along an axis with a single point) & \f$\omega\f$ is recomputed from the dispersion
+  *           relation. Amplitudes & phases are unchanged. The wave field is then periodic & all its components are
+  *           summed by the inverse FFT of a WaveElevationOnRegularGrid built with the same grid.
+  *  \returns Spectrum with the same number of components
+  *  \snippet environment_models/unit_tests/src/WaveElevationOnRegularGridTest.cpp WaveElevationOnRegularGridTest put_on_regular_grid_example
+  */
+FlatDiscreteDirectionalWaveSpectrum put_on_regular_grid(const FlatDiscreteDirectionalWaveSpectrum& spectrum, //!< Spectrum to modify
+                                                        const double dx,                                     //!< Distance between two points along the x-axis (in meters)
+                                                        const size_t nx,                                     //!< Number of points along the x-axis
+                                                        const double dy,                                     //!< Distance between two points along the y-axis (in meters)
+                                                        const size_t ny                                      //!< Number of points along the y-axis
+                                                        );
+
+#endif /* WAVEELEVATIONONREGULARGRID_HPP_ */
@@ -8,6 +8,7 @@
 #ifndef WAVEMODEL_HPP_
 #define WAVEMODEL_HPP_
 
+#include "CartesianRAO.hpp"
 #include "DiscreteDirectionalWaveSpectrum.hpp"
 
 #include <ssc/kinematics.hpp>
@@ -41,6 +42,15 @@ class WaveModel
                                     const std::vector<double>& rao_phase //!< Phase of the RAO
                                      ) const = 0;
 
+        /**  \brief Same as evaluate_rao, for the six degrees of freedom at once
+          *  \returns Force & torque (X, Y, Z, K, M, N)
+          */
+        virtual std::array<double, 6> evaluate_rao_6dof(const double x,         //!< x-position of the RAO's calculation point in the NED frame (in meters)
+                                                        const double y,         //!< y-position of the RAO's calculation point in the NED frame (in meters)
+                                                        const double t,         //!< Current time instant (in seconds)
+                                                        const CartesianRAO& rao //!< RAO of the six degrees of freedom
+                                                        ) const = 0;
+
         /**  \brief Computes the surface elevations at given points.
           *  \returns Elevations of a list of points at a given instant, in meters.
           *  \snippet environment_models/unit_tests/src/WaveModelTest.cpp WaveModelTest method_example
@@ -84,9 +94,24 @@ class WaveModel
           */
         std::vector<double> get_psis() const;
 
+        /**  \brief Moves each component so the wave field is periodic over a regular grid in the NED frame (cf. put_on_regular_grid)
+          *  \details The components are then no longer on a (frequency, direction) grid: get_spectrum still returns the
+          *           initial discretization, but get_directional_spectra returns the moved components.
+          */
+        void put_on_regular_grid(const double dx, //!< Distance between two points along the x-axis (in meters)
+                                 const size_t nx, //!< Number of points along the x-axis
+                                 const double dy, //!< Distance between two points along the y-axis (in meters)
+                                 const size_t ny  //!< Number of points along the y-axis
+                                 );
+
         FlatDiscreteDirectionalWaveSpectrum get_flat_spectrum() const {return flat_spectrum;};
         DiscreteDirectionalWaveSpectrum get_spectrum() const {return spectrum;};
 
+        /**  \brief Spectra of the components used by all computations (eg. sent to the distant models)
+          *  \returns get_spectrum(), or one spectrum per component once put_on_regular_grid was called
+          */
+        std::vector<DiscreteDirectionalWaveSpectrum> get_directional_spectra() const;
+
     private:
         WaveModel(); // Disabled
         void check_sizes() const;
@@ -134,6 +159,7 @@ class WaveModel
     protected:
         DiscreteDirectionalWaveSpectrum spectrum;
         FlatDiscreteDirectionalWaveSpectrum flat_spectrum;
+        std::vector<DiscreteDirectionalWaveSpectrum> spectra_on_regular_grid; //!< Empty unless put_on_regular_grid was called
 };
 
 typedef TR1(shared_ptr)<WaveModel> WaveModelPtr;
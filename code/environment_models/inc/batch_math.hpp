@@ -0,0 +1,51 @@
+/*
+ * batch_math.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef BATCH_MATH_HPP_
+#define BATCH_MATH_HPP_
+
+#include <cstddef>
+#include <string>
+
+/** \brief Evaluates sin, cos & exp over arrays, for the wave models' loops over spectrum components
+ *  \details The loops are branch-free (polynomial approximations after Cody-Waite range reduction)
+ *           so the compiler can vectorize them. On x86 processors compiled with GCC or Clang, an
+ *           AVX-512 or AVX2 version is selected when the library is loaded (depending on the CPU)
+ *           and a generic version is used otherwise.
+ *
+ *           Accuracy, compared to std::sin, std::cos & std::exp (checked in batch_mathTest):
+ *           - sin & cos: absolute error lower than BATCH_MATH_SINCOS_TOLERANCE (4 ulp of 1) for
+ *             |x| < BATCH_MATH_MAX_ANGLE. Larger angles are delegated to std::sin & std::cos.
+ *           - exp: relative error lower than BATCH_MATH_EXP_TOLERANCE (4 ulp). Results below the
+ *             smallest normal number (x < -708.39) are flushed to zero.
+ *  \addtogroup wave_models
+ *  \ingroup wave_models
+ *  \section ex1 Example
+ *  \snippet environment_models/unit_tests/src/batch_mathTest.cpp batch_mathTest example
+ */
+
+#define BATCH_MATH_SINCOS_TOLERANCE 8.8817841970012523e-16 //!< 2^-50
+#define BATCH_MATH_EXP_TOLERANCE 8.8817841970012523e-16    //!< Relative
+#define BATCH_MATH_MAX_ANGLE 1647099.3291652855            //!< 2^20*pi/2 (in radians)
+
+/**  \brief s[i] = sin(x[i]) for i < n
+  */
+void batch_sin(const double* x, double* s, const size_t n);
+
+/**  \brief s[i] = sin(x[i]) & c[i] = cos(x[i]) for i < n
+  */
+void batch_sincos(const double* x, double* s, double* c, const size_t n);
+
+/**  \brief y[i] = exp(x[i]) for i < n (x & y can be the same array)
+  */
+void batch_exp(const double* x, double* y, const size_t n);
+
+/**  \brief Instruction set used by the functions above ("avx512", "avx2" or "generic")
+  */
+std::string batch_math_instruction_set();
+
+#endif /* BATCH_MATH_HPP_ */
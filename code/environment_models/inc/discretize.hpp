@@ -17,6 +17,11 @@ class WaveDirectionalSpreading;
 FlatDiscreteDirectionalWaveSpectrum flatten(const DiscreteDirectionalWaveSpectrum& spectrum
                                             );
 
+/**  \brief Inverse of 'flatten' for spectra whose components are not on a (frequency, direction) grid (eg. after put_on_regular_grid)
+  *  \returns One spectrum per component (a single frequency & a single direction), so flattening each of them gives back the component
+  */
+std::vector<DiscreteDirectionalWaveSpectrum> split_into_components(const FlatDiscreteDirectionalWaveSpectrum& spectrum);
+
 /**  \brief Only select the most important spectrum components & create single vector
   *  \details No need to loop on all frequencies & all directions: we only select
   *  the most important ones (i.e. those representing a given ratio of the total
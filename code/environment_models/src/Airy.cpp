@@ -6,10 +6,13 @@
  */
 
 #include "Airy.hpp"
+#include "batch_math.hpp"
 #include "InternalErrorException.hpp"
 #include "InvalidInputException.hpp"
 #include "discretize.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 #include <ssc/macros.hpp>
 
@@ -49,6 +52,107 @@ double Airy::evaluate_rao(
     return F;
 }
 
+std::array<double, 6> Airy::evaluate_rao_6dof(const double x, const double y, const double t, const CartesianRAO& rao) const
+{
+    return ::evaluate_rao_6dof(flat_spectrum, x, y, t, rao);
+}
+
+/**  \brief -omega*t for each component (so it is not recomputed for each point)
+  */
+std::vector<double> minus_omega_t(const FlatDiscreteDirectionalWaveSpectrum& spectrum, const double t);
+std::vector<double> minus_omega_t(const FlatDiscreteDirectionalWaveSpectrum& spectrum, const double t)
+{
+    std::vector<double> ret(spectrum.omega.size());
+    for (size_t i = 0 ; i < ret.size() ; ++i) ret[i] = -spectrum.omega[i] * t;
+    return ret;
+}
+
+/**  \brief Phase of each component at (x,y)
+  *  \details Operations are done in the same order as in evaluate_rao, so results only differ by the approximation of sin & cos (cf. batch_math.hpp)
+  */
+void compute_phases(const FlatDiscreteDirectionalWaveSpectrum& spectrum, const std::vector<double>& minus_omega_t, const double x, const double y, std::vector<double>& theta);
+void compute_phases(const FlatDiscreteDirectionalWaveSpectrum& spectrum, const std::vector<double>& minus_omega_t, const double x, const double y, std::vector<double>& theta)
+{
+    const double* k = spectrum.k.data();
+    const double* cos_psi = spectrum.cos_psi.data();
+    const double* sin_psi = spectrum.sin_psi.data();
+    const double* phase = spectrum.phase.data();
+    const double* omega_t = minus_omega_t.data();
+    double* th = theta.data();
+    const size_t n = theta.size();
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        th[i] = omega_t[i] + k[i] * (x * cos_psi[i] + y * sin_psi[i]) + phase[i];
+    }
+}
+
+/**  \brief Evaluates pdyn_factor & pdyn_factor_sh for all components at once
+  *  \details When the spectrum was built by 'discretize', the depth & stretching are known so the factors are computed
+  *           with batch_exp instead of calling the std::function for each component:
+  *           - infinite depth: exp(-k*z'),
+  *           - finite depth: cosh(k*(h-z'))/cosh(k*h) = exp(-k*z')*(1+exp(-2k*(h-z')))/(1+exp(-2*k*h)) (& likewise for sinh),
+  *           where z' is the rescaled z. Callers should check that z is below the free surface.
+  */
+class DepthFactors
+{
+    public:
+        DepthFactors(const FlatDiscreteDirectionalWaveSpectrum& spectrum_) : spectrum(spectrum_), n(spectrum_.k.size()), one_over_one_plus_exp_minus_2kh(n, 0), e1(n, 0), e2(n, 0)
+        {
+            if (spectrum.depth > 0)
+            {
+                for (size_t i = 0 ; i < n ; ++i) one_over_one_plus_exp_minus_2kh[i] = 1./(1 + std::exp(-2 * spectrum.k[i] * spectrum.depth));
+            }
+        }
+
+        void compute(const double z, const double eta, std::vector<double>& f, std::vector<double>* f_sh)
+        {
+            if (not(spectrum.rescaled_z))
+            {
+                for (size_t i = 0 ; i < n ; ++i) f[i] = spectrum.pdyn_factor(spectrum.k[i], z, eta);
+                if (f_sh) for (size_t i = 0 ; i < n ; ++i) (*f_sh)[i] = spectrum.pdyn_factor_sh(spectrum.k[i], z, eta);
+                return;
+            }
+            if (std::isnan(z))
+            {
+                THROW(__PRETTY_FUNCTION__, InternalErrorException, "z (value to rescale, in meters) was NaN");
+            }
+            if (std::isnan(eta))
+            {
+                THROW(__PRETTY_FUNCTION__, InternalErrorException, "eta (wave height, in meters) was NaN");
+            }
+            const double h = spectrum.depth;
+            if ((h > 0) and (z > h))
+            {
+                std::fill(f.begin(), f.end(), 0);
+                if (f_sh) std::fill(f_sh->begin(), f_sh->end(), 0);
+                return;
+            }
+            const double rescaled_z = spectrum.rescaled_z(z, eta);
+            for (size_t i = 0 ; i < n ; ++i) e1[i] = -spectrum.k[i] * rescaled_z;
+            batch_exp(e1.data(), e1.data(), n);
+            if (h == 0)
+            {
+                f = e1;
+                if (f_sh) *f_sh = e1;
+                return;
+            }
+            for (size_t i = 0 ; i < n ; ++i) e2[i] = -2 * spectrum.k[i] * (h - rescaled_z);
+            batch_exp(e2.data(), e2.data(), n);
+            for (size_t i = 0 ; i < n ; ++i) f[i] = e1[i] * (1 + e2[i]) * one_over_one_plus_exp_minus_2kh[i];
+            if (f_sh) for (size_t i = 0 ; i < n ; ++i) (*f_sh)[i] = e1[i] * (1 - e2[i]) * one_over_one_plus_exp_minus_2kh[i];
+        }
+
+    private:
+        DepthFactors();
+        DepthFactors(const DepthFactors&);
+        DepthFactors& operator=(const DepthFactors&);
+        const FlatDiscreteDirectionalWaveSpectrum& spectrum;
+        size_t n;
+        std::vector<double> one_over_one_plus_exp_minus_2kh;
+        std::vector<double> e1; //!< exp(-k*z')
+        std::vector<double> e2; //!< exp(-2k*(h-z'))
+};
+
 std::vector<double> Airy::elevation(
     const std::vector<double> &x, //!< x-positions in the NED frame (in meters)
     const std::vector<double> &y, //!< y-positions in the NED frame (in meters)
@@ -57,16 +161,19 @@ std::vector<double> Airy::elevation(
 {
     std::vector<double> zeta(x.size());
     const size_t n = flat_spectrum.psi.size();
+    const std::vector<double> omega_t = minus_omega_t(flat_spectrum, t);
+    std::vector<double> theta(n), sin_theta(n);
 
-    for (size_t j = 0; j < zeta.size(); ++j) {
+    for (size_t j = 0; j < zeta.size(); ++j)
+    {
+        compute_phases(flat_spectrum, omega_t, x[j], y.at(j), theta);
+        batch_sin(theta.data(), sin_theta.data(), n);
+        double zeta_j = 0;
         for (size_t i = 0 ; i < n ; ++i)
         {
-            const double a = flat_spectrum.a[i];
-            const double omega_t = flat_spectrum.omega[i] * t;
-            const double k_xCosPsi_ySinPsi = flat_spectrum.k[i] * (x.at(j) * flat_spectrum.cos_psi[i] + y.at(j) * flat_spectrum.sin_psi[i]);
-            const double theta = flat_spectrum.phase[i];
-            zeta.at(j) -= a * sin(-omega_t + k_xCosPsi_ySinPsi + theta);
+            zeta_j -= flat_spectrum.a[i] * sin_theta[i];
         }
+        zeta[j] = zeta_j;
     }
 
     return zeta;
@@ -83,6 +190,10 @@ std::vector<double> Airy::dynamic_pressure(
     ) const
 {
     std::vector<double> p(x.size(), 0);
+    const size_t n = flat_spectrum.psi.size();
+    const std::vector<double> omega_t = minus_omega_t(flat_spectrum, t);
+    std::vector<double> theta(n), sin_theta(n), pdyn_fact(n);
+    DepthFactors depth_factors(flat_spectrum);
 
     for (size_t j = 0; j < p.size(); ++j)
     {
@@ -101,20 +212,16 @@ std::vector<double> Airy::dynamic_pressure(
         }
         else
         {
-            const size_t n = flat_spectrum.psi.size();
+            compute_phases(flat_spectrum, omega_t, x[j], y[j], theta);
+            batch_sin(theta.data(), sin_theta.data(), n);
+            depth_factors.compute(z[j], eta[j], pdyn_fact, NULL);
+            double p_j = 0;
             for (size_t i = 0; i < n; ++i)
             {
-                const double a = flat_spectrum.a[i];
-                const double k = flat_spectrum.k[i];
-                const double omega_t = flat_spectrum.omega[i] * t;
-                const double pdyn_fact = flat_spectrum.pdyn_factor(k, z[j], eta[j]);
-                const double k_xCosPsi_ySinPsi = k * (x[j] * flat_spectrum.cos_psi[i] + y[j] * flat_spectrum.sin_psi[i]);
-                const double theta = flat_spectrum.phase[i];
-                p[j] += a * pdyn_fact * sin(-omega_t + k_xCosPsi_ySinPsi + theta);
+                p_j += flat_spectrum.a[i] * pdyn_fact[i] * sin_theta[i];
             }
-            p[j] *= rho * g;
+            p[j] = p_j * rho * g;
         }
-        
     }
     return p;
 }
@@ -129,33 +236,33 @@ ssc::kinematics::PointMatrix Airy::orbital_velocity(
         ) const
 {
     ssc::kinematics::PointMatrix M("NED", x.size());
-    for (size_t point_index = 0; point_index < x.size(); ++point_index) {
-
-        if (z.at(point_index) < eta.at(point_index)) 
+    const size_t n = flat_spectrum.psi.size();
+    const std::vector<double> omega_t = minus_omega_t(flat_spectrum, t);
+    std::vector<double> theta(n), sin_theta(n), cos_theta(n), pdyn_factor(n), pdyn_factor_sh(n), a_k_omega(n);
+    for (size_t i = 0 ; i < n ; ++i) a_k_omega[i] = flat_spectrum.a[i] * flat_spectrum.k[i] / flat_spectrum.omega[i];
+    DepthFactors depth_factors(flat_spectrum);
+    for (size_t point_index = 0; point_index < x.size(); ++point_index)
+    {
+        if (z.at(point_index) < eta.at(point_index))
         {
             M.m(0, point_index) = 0;
             M.m(1, point_index) = 0;
             M.m(2, point_index) = 0;
-        } else {
-            const size_t n = flat_spectrum.psi.size();
+        }
+        else
+        {
+            compute_phases(flat_spectrum, omega_t, x[point_index], y[point_index], theta);
+            batch_sincos(theta.data(), sin_theta.data(), cos_theta.data(), n);
+            depth_factors.compute(z[point_index], 0, pdyn_factor, &pdyn_factor_sh); // No stretching for the orbital velocity
             double u = 0;
             double v = 0;
             double w = 0;
             for (size_t i = 0 ; i < n ; ++i)
             {
-                const double omega = flat_spectrum.omega[i];
-                const double k = flat_spectrum.k[i];
-                const double pdyn_factor = flat_spectrum.pdyn_factor(k,z[point_index],0); // No stretching for the orbital velocity
-                const double pdyn_factor_sh = flat_spectrum.pdyn_factor_sh(k,z[point_index],0); // No stretching for the orbital velocity
-                const double k_xCosPsi_ySinPsi = k * (x[point_index] * flat_spectrum.cos_psi[i] + y[point_index] * flat_spectrum.sin_psi[i]);
-                const double theta = -omega * t + k_xCosPsi_ySinPsi + flat_spectrum.phase[i];
-                const double cos_theta = cos(theta);
-                const double sin_theta = sin(theta);
-                const double a_k_omega = flat_spectrum.a[i] * k / omega;
-                const double a_k_omega_pdyn_factor_sin_theta = a_k_omega * pdyn_factor * sin_theta;
+                const double a_k_omega_pdyn_factor_sin_theta = a_k_omega[i] * pdyn_factor[i] * sin_theta[i];
                 u += a_k_omega_pdyn_factor_sin_theta * flat_spectrum.cos_psi[i];
                 v += a_k_omega_pdyn_factor_sin_theta * flat_spectrum.sin_psi[i];
-                w += a_k_omega * pdyn_factor_sh * cos_theta;
+                w += a_k_omega[i] * pdyn_factor_sh[i] * cos_theta[i];
             }
             M.m(0, point_index) = u * g;
             M.m(1, point_index) = v * g;
@@ -163,5 +270,4 @@ ssc::kinematics::PointMatrix Airy::orbital_velocity(
         }
     }
     return M;
-
 }
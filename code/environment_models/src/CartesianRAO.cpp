@@ -0,0 +1,88 @@
+/*
+ * CartesianRAO.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <algorithm>
+
+#include "batch_math.hpp"
+#include "CartesianRAO.hpp"
+#include "InternalErrorException.hpp"
+
+// Number of components whose phasors are stored on the stack at once
+#define RAO_BLOCK_SIZE 256
+
+CartesianRAO::CartesianRAO() : module_cos_phase(), module_sin_phase()
+{
+}
+
+CartesianRAO::CartesianRAO(const size_t nb_of_components) : module_cos_phase(), module_sin_phase()
+{
+    for (size_t k = 0 ; k < 6 ; ++k)
+    {
+        module_cos_phase[k].resize(nb_of_components, 0);
+        module_sin_phase[k].resize(nb_of_components, 0);
+    }
+}
+
+void CartesianRAO::set(const size_t degree_of_freedom, const std::vector<double>& rao_module, const std::vector<double>& rao_phase)
+{
+    const size_t n = rao_module.size();
+    if (rao_phase.size() != n)
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "RAO module has " << n << " values but RAO phase has " << rao_phase.size() << " values (for degree of freedom " << degree_of_freedom << ")");
+    }
+    std::vector<double>& re = module_cos_phase.at(degree_of_freedom);
+    std::vector<double>& im = module_sin_phase.at(degree_of_freedom);
+    re.resize(n);
+    im.resize(n);
+    batch_sincos(rao_phase.data(), im.data(), re.data(), n);
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        re[i] *= rao_module[i];
+        im[i] *= rao_module[i];
+    }
+}
+
+std::array<double, 6> evaluate_rao_6dof(const FlatDiscreteDirectionalWaveSpectrum& spectrum, const double x, const double y, const double t, const CartesianRAO& rao)
+{
+    const size_t n = spectrum.k.size();
+    for (size_t k = 0 ; k < 6 ; ++k)
+    {
+        if ((rao.module_cos_phase[k].size() != n) or (rao.module_sin_phase[k].size() != n))
+        {
+            THROW(__PRETTY_FUNCTION__, InternalErrorException, "Number of angular frequencies times number of incidences in HDB RAO is " << rao.module_cos_phase[k].size() << ", which does not match spectrum size (" << n << " (omega,psi) pairs)");
+        }
+    }
+    std::array<double, 6> F;
+    F.fill(0);
+    double theta[RAO_BLOCK_SIZE];
+    double sin_theta[RAO_BLOCK_SIZE];
+    double cos_theta[RAO_BLOCK_SIZE];
+    for (size_t first = 0 ; first < n ; first += RAO_BLOCK_SIZE)
+    {
+        const size_t m = std::min((size_t)RAO_BLOCK_SIZE, n - first);
+        const double* a = spectrum.a.data() + first;
+        const double* omega = spectrum.omega.data() + first;
+        const double* k = spectrum.k.data() + first;
+        const double* cos_psi = spectrum.cos_psi.data() + first;
+        const double* sin_psi = spectrum.sin_psi.data() + first;
+        const double* phase = spectrum.phase.data() + first;
+        for (size_t i = 0 ; i < m ; ++i)
+        {
+            theta[i] = -omega[i] * t + k[i] * (x * cos_psi[i] + y * sin_psi[i]) + phase[i];
+        }
+        batch_sincos(theta, sin_theta, cos_theta, m);
+        for (size_t dof = 0 ; dof < 6 ; ++dof)
+        {
+            const double* re = rao.module_cos_phase[dof].data() + first;
+            const double* im = rao.module_sin_phase[dof].data() + first;
+            double sum = 0;
+            for (size_t i = 0 ; i < m ; ++i) sum += a[i] * (re[i] * sin_theta[i] + im[i] * cos_theta[i]);
+            F[dof] -= sum;
+        }
+    }
+    return F;
+}
@@ -16,7 +16,9 @@ FlatDiscreteDirectionalWaveSpectrum::FlatDiscreteDirectionalWaveSpectrum() :
                     k(),
                     phase(),
                     pdyn_factor(),
-                    pdyn_factor_sh()
+                    pdyn_factor_sh(),
+                    depth(0),
+                    rescaled_z()
 {
 }
 
@@ -28,7 +30,9 @@ DiscreteDirectionalWaveSpectrum::DiscreteDirectionalWaveSpectrum() :
                     k(),
                     phase(),
                     pdyn_factor(),
-                    pdyn_factor_sh()
+                    pdyn_factor_sh(),
+                    depth(0),
+                    rescaled_z()
 {
 }
 
@@ -0,0 +1,78 @@
+/*
+ * WaveElevationOnFixedPoints.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include "WaveElevationOnFixedPoints.hpp"
+#include "batch_math.hpp"
+#include "InternalErrorException.hpp"
+
+#include <ssc/exception_handling.hpp>
+
+size_t total_nb_of_components(const std::vector<FlatDiscreteDirectionalWaveSpectrum>& spectra);
+size_t total_nb_of_components(const std::vector<FlatDiscreteDirectionalWaveSpectrum>& spectra)
+{
+    size_t n = 0;
+    for (const auto& spectrum:spectra) n += spectrum.a.size();
+    return n;
+}
+
+size_t WaveElevationOnFixedPoints::nb_of_coefficients(const std::vector<FlatDiscreteDirectionalWaveSpectrum>& spectra, const size_t nb_of_points)
+{
+    return 2*total_nb_of_components(spectra)*nb_of_points;
+}
+
+WaveElevationOnFixedPoints::WaveElevationOnFixedPoints(const std::vector<FlatDiscreteDirectionalWaveSpectrum>& spectra,
+                                                       const std::vector<double>& x,
+                                                       const std::vector<double>& y) :
+        minus_omega(),
+        phase(),
+        spatial_part(x.size(), 2*total_nb_of_components(spectra))
+{
+    if (x.size() != y.size())
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "x and y don't have the same size (size of x: " << x.size() << ", size of y: " << y.size() << ")");
+    }
+    const size_t n = total_nb_of_components(spectra);
+    minus_omega.reserve(n);
+    phase.reserve(n);
+    std::vector<double> a, k, cos_psi, sin_psi;
+    for (const auto& spectrum:spectra)
+    {
+        for (size_t i = 0 ; i < spectrum.a.size() ; ++i)
+        {
+            minus_omega.push_back(-spectrum.omega.at(i));
+            phase.push_back(spectrum.phase.at(i));
+            a.push_back(spectrum.a[i]);
+            k.push_back(spectrum.k.at(i));
+            cos_psi.push_back(spectrum.cos_psi.at(i));
+            sin_psi.push_back(spectrum.sin_psi.at(i));
+        }
+    }
+    std::vector<double> phi(n), sin_phi(n), cos_phi(n);
+    for (size_t p = 0 ; p < x.size() ; ++p)
+    {
+        for (size_t i = 0 ; i < n ; ++i) phi[i] = k[i]*(x[p]*cos_psi[i] + y[p]*sin_psi[i]);
+        batch_sincos(phi.data(), sin_phi.data(), cos_phi.data(), n);
+        for (size_t i = 0 ; i < n ; ++i)
+        {
+            spatial_part((long)p, (long)i) = a[i]*sin_phi[i];
+            spatial_part((long)p, (long)(n+i)) = a[i]*cos_phi[i];
+        }
+    }
+}
+
+std::vector<double> WaveElevationOnFixedPoints::get_elevation(const double t) const
+{
+    const size_t n = phase.size();
+    std::vector<double> tau(n);
+    for (size_t i = 0 ; i < n ; ++i) tau[i] = minus_omega[i]*t + phase[i];
+    // sin(phi+tau) = sin(phi)cos(tau) + cos(phi)sin(tau)
+    Eigen::VectorXd cos_sin_tau(2*n);
+    batch_sincos(tau.data(), cos_sin_tau.data() + n, cos_sin_tau.data(), n);
+    std::vector<double> eta((size_t)spatial_part.rows());
+    Eigen::Map<Eigen::VectorXd>(eta.data(), spatial_part.rows()).noalias() = -spatial_part*cos_sin_tau;
+    return eta;
+}
@@ -0,0 +1,237 @@
+/*
+ * WaveElevationOnRegularGrid.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include "WaveElevationOnRegularGrid.hpp"
+#include "batch_math.hpp"
+#include "InternalErrorException.hpp"
+
+#include <ssc/exception_handling.hpp>
+
+#define _USE_MATH_DEFINE
+#include <cmath>
+#define PI M_PI
+
+// Tolerance on k*dx*N/(2*pi) to consider a component is on the FFT grid
+#define ON_GRID_TOLERANCE 1E-9
+
+size_t next_power_of_two(const size_t n);
+size_t next_power_of_two(const size_t n)
+{
+    size_t ret = 1;
+    while (ret < n) ret *= 2;
+    return ret;
+}
+
+std::vector<std::complex<double> > twiddle_factors(const size_t N);
+std::vector<std::complex<double> > twiddle_factors(const size_t N)
+{
+    std::vector<std::complex<double> > ret(N/2);
+    for (size_t p = 0 ; p < N/2 ; ++p) ret[p] = std::polar(1., 2*PI*(double)p/(double)N);
+    return ret;
+}
+
+/**  \brief Unnormalized inverse discrete Fourier transform: z[m] <- sum_p z[p]*exp(2*i*pi*p*m/N)
+  *  \details Iterative radix-2 Cooley-Tukey algorithm (N must be a power of two)
+  */
+void inverse_fft(std::complex<double>* z, const size_t N, const std::vector<std::complex<double> >& twiddles);
+void inverse_fft(std::complex<double>* z, const size_t N, const std::vector<std::complex<double> >& twiddles)
+{
+    for (size_t i = 1, j = 0 ; i < N ; ++i)
+    {
+        size_t bit = N >> 1;
+        for ( ; j & bit ; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) std::swap(z[i], z[j]);
+    }
+    for (size_t len = 2 ; len <= N ; len *= 2)
+    {
+        const size_t half = len/2;
+        const size_t step = N/len;
+        for (size_t i = 0 ; i < N ; i += len)
+        {
+            for (size_t j = 0 ; j < half ; ++j)
+            {
+                const std::complex<double> u = z[i+j];
+                const std::complex<double> v = z[i+j+half]*twiddles[j*step];
+                z[i+j] = u + v;
+                z[i+j+half] = u - v;
+            }
+        }
+    }
+}
+
+/**  \brief Index of the FFT bin corresponding to wave number k
+  *  \returns false if k*d*N/(2*pi) is not an integer
+  */
+bool get_bin(const double k, const double d, const size_t n, const size_t N, size_t& bin);
+bool get_bin(const double k, const double d, const size_t n, const size_t N, size_t& bin)
+{
+    if (n == 1)
+    {
+        bin = 0;
+        return true;
+    }
+    const double p = k*d*(double)N/(2*PI);
+    const double p_ = std::round(p);
+    if (std::abs(p - p_) > ON_GRID_TOLERANCE*(1 + std::abs(p))) return false;
+    const long N_ = (long)N;
+    bin = (size_t)((((long)p_ % N_) + N_) % N_);
+    return true;
+}
+
+/**  \brief Distance between two wave numbers of the FFT grid along an axis
+  *  \returns 0 if there is no constraint (single point)
+  */
+double wave_number_step(const double d, const size_t n);
+double wave_number_step(const double d, const size_t n)
+{
+    if ((n <= 1) or (d == 0)) return 0;
+    return 2*PI/(std::abs(d)*(double)next_power_of_two(n));
+}
+
+double round_wave_number(const double k, const double dk);
+double round_wave_number(const double k, const double dk)
+{
+    return (dk == 0) ? k : dk*std::round(k/dk);
+}
+
+FlatDiscreteDirectionalWaveSpectrum put_on_regular_grid(const FlatDiscreteDirectionalWaveSpectrum& spectrum, const double dx, const size_t nx, const double dy, const size_t ny)
+{
+    const double g = 9.81; // Same as WaveNumberFunctor
+    const double dkx = wave_number_step(dx, nx);
+    const double dky = wave_number_step(dy, ny);
+    FlatDiscreteDirectionalWaveSpectrum ret = spectrum;
+    for (size_t i = 0 ; i < ret.k.size() ; ++i)
+    {
+        const double kx0 = spectrum.k[i]*spectrum.cos_psi.at(i);
+        const double ky0 = spectrum.k[i]*spectrum.sin_psi.at(i);
+        double kx = round_wave_number(kx0, dkx);
+        double ky = round_wave_number(ky0, dky);
+        if ((kx == 0) and (ky == 0)) // Wave too long for the grid: use the longest one it can represent, in the closest direction
+        {
+            if ((dky == 0) or ((dkx != 0) and (std::abs(kx0)/dkx >= std::abs(ky0)/dky))) kx = std::copysign(dkx, kx0);
+            else                                                                        ky = std::copysign(dky, ky0);
+        }
+        const double k = std::hypot(kx, ky);
+        const double psi = std::atan2(ky, kx);
+        ret.k[i] = k;
+        ret.psi.at(i) = psi < 0 ? psi + 2*PI : psi;
+        ret.cos_psi[i] = kx/k;
+        ret.sin_psi[i] = ky/k;
+        ret.omega.at(i) = std::sqrt(g*k*(spectrum.depth > 0 ? std::tanh(k*spectrum.depth) : 1));
+    }
+    return ret;
+}
+
+WaveElevationOnRegularGrid::WaveElevationOnRegularGrid(const std::vector<FlatDiscreteDirectionalWaveSpectrum>& spectra,
+                                                       const double x0, const double dx, const size_t nx_,
+                                                       const double y0, const double dy, const size_t ny_) :
+        nx(nx_),
+        ny(ny_),
+        Nx(next_power_of_two(nx_)),
+        Ny(next_power_of_two(ny_)),
+        bin(),
+        amplitude(),
+        minus_omega(),
+        phase_at_origin(),
+        X(),
+        Y(),
+        twiddles_x(twiddle_factors(Nx)),
+        twiddles_y(twiddle_factors(Ny))
+{
+    if ((nx == 0) or (ny == 0))
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "The grid should have at least one point along each axis (nx = " << nx << ", ny = " << ny << ")");
+    }
+    std::vector<double> a_off, minus_omega_off, phase_off;
+    for (const auto& spectrum:spectra)
+    {
+        for (size_t i = 0 ; i < spectrum.a.size() ; ++i)
+        {
+            const double kx = spectrum.k.at(i)*spectrum.cos_psi.at(i);
+            const double ky = spectrum.k.at(i)*spectrum.sin_psi.at(i);
+            const double phase = kx*x0 + ky*y0 + spectrum.phase.at(i);
+            size_t p = 0, q = 0;
+            if (get_bin(kx, dx, nx, Nx, p) and get_bin(ky, dy, ny, Ny, q))
+            {
+                bin.push_back(q*Nx + p);
+                amplitude.push_back(spectrum.a[i]);
+                minus_omega.push_back(-spectrum.omega.at(i));
+                phase_at_origin.push_back(phase);
+            }
+            else
+            {
+                a_off.push_back(spectrum.a[i]);
+                minus_omega_off.push_back(-spectrum.omega.at(i));
+                phase_off.push_back(phase);
+                std::vector<std::complex<double> > Xi(nx), Yi(ny);
+                for (size_t m = 0 ; m < nx ; ++m) Xi[m] = std::polar(1., kx*(double)m*dx);
+                for (size_t n = 0 ; n < ny ; ++n) Yi[n] = std::polar(1., ky*(double)n*dy);
+                X.push_back(Xi);
+                Y.push_back(Yi);
+            }
+        }
+    }
+    amplitude.insert(amplitude.end(), a_off.begin(), a_off.end());
+    minus_omega.insert(minus_omega.end(), minus_omega_off.begin(), minus_omega_off.end());
+    phase_at_origin.insert(phase_at_origin.end(), phase_off.begin(), phase_off.end());
+}
+
+size_t WaveElevationOnRegularGrid::get_nb_of_components_on_grid() const
+{
+    return bin.size();
+}
+
+size_t WaveElevationOnRegularGrid::get_nb_of_components_off_grid() const
+{
+    return X.size();
+}
+
+std::vector<double> WaveElevationOnRegularGrid::get_elevation(const double t) const
+{
+    const size_t n = amplitude.size();
+    const size_t n_on = bin.size();
+    std::vector<double> tau(n), sin_tau(n), cos_tau(n);
+    for (size_t i = 0 ; i < n ; ++i) tau[i] = minus_omega[i]*t + phase_at_origin[i];
+    batch_sincos(tau.data(), sin_tau.data(), cos_tau.data(), n);
+
+    std::vector<double> eta(nx*ny, 0);
+    if (n_on)
+    {
+        std::vector<std::complex<double> > C(Nx*Ny);
+        std::vector<bool> row_is_used(Ny, false);
+        for (size_t i = 0 ; i < n_on ; ++i)
+        {
+            C[bin[i]] += std::complex<double>(amplitude[i]*cos_tau[i], amplitude[i]*sin_tau[i]);
+            row_is_used[bin[i]/Nx] = true;
+        }
+        for (size_t q = 0 ; q < Ny ; ++q)
+        {
+            if (row_is_used[q]) inverse_fft(C.data() + q*Nx, Nx, twiddles_x);
+        }
+        std::vector<std::complex<double> > column(Ny);
+        for (size_t m = 0 ; m < nx ; ++m)
+        {
+            for (size_t q = 0 ; q < Ny ; ++q) column[q] = C[q*Nx + m];
+            inverse_fft(column.data(), Ny, twiddles_y);
+            for (size_t j = 0 ; j < ny ; ++j) eta[j*nx + m] = -column[j].imag();
+        }
+    }
+    for (size_t i = n_on ; i < n ; ++i)
+    {
+        const std::complex<double> c(amplitude[i]*cos_tau[i], amplitude[i]*sin_tau[i]);
+        const std::vector<std::complex<double> >& Xi = X[i - n_on];
+        const std::vector<std::complex<double> >& Yi = Y[i - n_on];
+        for (size_t j = 0 ; j < ny ; ++j)
+        {
+            const std::complex<double> w = c*Yi[j];
+            double* eta_j = eta.data() + j*nx;
+            for (size_t m = 0 ; m < nx ; ++m) eta_j[m] -= w.real()*Xi[m].imag() + w.imag()*Xi[m].real();
+        }
+    }
+    return eta;
+}
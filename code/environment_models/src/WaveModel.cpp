@@ -8,6 +8,7 @@
 #include "WaveModel.hpp"
 #include "InternalErrorException.hpp"
 #include "discretize.hpp"
+#include "WaveElevationOnRegularGrid.hpp"
 #include <cmath> // For isnan
 #include <boost/random/mersenne_twister.hpp>
 #include <boost/random/uniform_real_distribution.hpp>
@@ -55,12 +56,12 @@ DiscreteDirectionalWaveSpectrum add_random_phases(DiscreteDirectionalWaveSpectru
     return spectrum;
 }
 
-WaveModel::WaveModel(const DiscreteDirectionalWaveSpectrum& spectrum_, const double constant_phase) : spectrum(add_constant_phases(spectrum_, constant_phase)), flat_spectrum(flatten(spectrum))
+WaveModel::WaveModel(const DiscreteDirectionalWaveSpectrum& spectrum_, const double constant_phase) : spectrum(add_constant_phases(spectrum_, constant_phase)), flat_spectrum(flatten(spectrum)), spectra_on_regular_grid()
 {
     check_sizes();
 }
 
-WaveModel::WaveModel(const DiscreteDirectionalWaveSpectrum& spectrum_, const int random_number_generator_seed) : spectrum(add_random_phases(spectrum_, random_number_generator_seed)), flat_spectrum(flatten(spectrum))
+WaveModel::WaveModel(const DiscreteDirectionalWaveSpectrum& spectrum_, const int random_number_generator_seed) : spectrum(add_random_phases(spectrum_, random_number_generator_seed)), flat_spectrum(flatten(spectrum)), spectra_on_regular_grid()
 {
     check_sizes();
 }
@@ -112,6 +113,18 @@ WaveModel::~WaveModel()
 {
 }
 
+void WaveModel::put_on_regular_grid(const double dx, const size_t nx, const double dy, const size_t ny)
+{
+    flat_spectrum = ::put_on_regular_grid(flat_spectrum, dx, nx, dy, ny);
+    spectra_on_regular_grid = split_into_components(flat_spectrum);
+}
+
+std::vector<DiscreteDirectionalWaveSpectrum> WaveModel::get_directional_spectra() const
+{
+    if (spectra_on_regular_grid.empty()) return std::vector<DiscreteDirectionalWaveSpectrum>(1, spectrum);
+    return spectra_on_regular_grid;
+}
+
 std::vector<double> WaveModel::get_omegas() const
 {
     return flat_spectrum.omega;
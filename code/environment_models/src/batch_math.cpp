@@ -0,0 +1,208 @@
+/*
+ * batch_math.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "batch_math.hpp"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define BATCH_MATH_RUNTIME_DISPATCH 1
+#define BATCH_MATH_INLINE inline __attribute__((always_inline))
+#else
+#define BATCH_MATH_RUNTIME_DISPATCH 0
+#define BATCH_MATH_INLINE inline
+#endif
+
+// pi/2 split in three parts (the first two have 33 significant bits, so n*PIO2_1 & n*PIO2_2 are exact for |n| < 2^20)
+#define PIO2_1  1.57079632673412561417e+00
+#define PIO2_2  6.07710050630396597660e-11
+#define PIO2_2T 2.02226624879595063154e-21
+#define TWO_OVER_PI 6.36619772367581382433e-01
+// Minimax polynomials on [-pi/4,pi/4] (from fdlibm's __kernel_sin & __kernel_cos)
+#define S1 -1.66666666666666324348e-01
+#define S2  8.33333333332248946124e-03
+#define S3 -1.98412698298579493134e-04
+#define S4  2.75573137070700676789e-06
+#define S5 -2.50507602534068634195e-08
+#define S6  1.58969099521155010221e-10
+#define C1  4.16666666666666019037e-02
+#define C2 -1.38888888888741095749e-03
+#define C3  2.48015872894767294178e-05
+#define C4 -2.75573143513906633035e-07
+#define C5  2.08757232129817482790e-09
+#define C6 -1.13596475577881948265e-11
+// ln(2) split in two parts (n*LN2_HI is exact for |n| < 2^11)
+#define LN2_HI 6.93147180369123816490e-01
+#define LN2_LO 1.90821492927058770002e-10
+#define LOG2_E 1.44269504088896338700e+00
+#define EXP_MIN -708.3964185322641 // ln of the smallest normal number
+#define EXP_MAX 709.782712893384   // ln of the largest finite number
+
+BATCH_MATH_INLINE bool angles_are_small(const double* x, const size_t n)
+{
+    size_t nb_of_large_angles = 0;
+    for (size_t i = 0 ; i < n ; ++i) nb_of_large_angles += std::abs(x[i]) >= BATCH_MATH_MAX_ANGLE ? 1 : 0;
+    return nb_of_large_angles == 0;
+}
+
+/**  \brief sin & cos of x = r + q*pi/2, computed from the polynomials in r (|r| <= pi/4)
+  */
+BATCH_MATH_INLINE void sincos_kernel(const double x, double& s, double& c)
+{
+    const double q = std::floor(x*TWO_OVER_PI + 0.5);
+    const double r = ((x - q*PIO2_1) - q*PIO2_2) - q*PIO2_2T;
+    const double z = r*r;
+    const double sin_r = r + (z*r)*(S1 + z*(S2 + z*(S3 + z*(S4 + z*(S5 + z*S6)))));
+    const double hz = 0.5*z;
+    const double w = 1.0 - hz;
+    const double cos_r = w + (((1.0 - w) - hz) + z*z*(C1 + z*(C2 + z*(C3 + z*(C4 + z*(C5 + z*C6))))));
+    // Only simple selects (no short-circuit logic) so the loops stay branch-free
+    const double quadrant = q - 4*std::floor(0.25*q); // 0, 1, 2 or 3
+    const double odd = quadrant - 2*std::floor(0.5*quadrant);
+    const double sin_sign = quadrant >= 2 ? -1 : 1;
+    const double cos_sign = std::abs(quadrant - 1.5) < 1 ? -1 : 1; // Quadrants 1 & 2
+    s = sin_sign*(odd == 1 ? cos_r : sin_r);
+    c = cos_sign*(odd == 1 ? sin_r : cos_r);
+}
+
+BATCH_MATH_INLINE void sin_loop(const double* x, double* s, const size_t n)
+{
+    if (not(angles_are_small(x, n)))
+    {
+        for (size_t i = 0 ; i < n ; ++i) s[i] = std::sin(x[i]);
+        return;
+    }
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        double c;
+        sincos_kernel(x[i], s[i], c);
+    }
+}
+
+BATCH_MATH_INLINE void sincos_loop(const double* x, double* s, double* c, const size_t n)
+{
+    if (not(angles_are_small(x, n)))
+    {
+        for (size_t i = 0 ; i < n ; ++i)
+        {
+            s[i] = std::sin(x[i]);
+            c[i] = std::cos(x[i]);
+        }
+        return;
+    }
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        sincos_kernel(x[i], s[i], c[i]);
+    }
+}
+
+/**  \brief 2^q for integer q in [-1022,1023], without converting q to an integer (not vectorizable with AVX2)
+  *  \details Adding 1.5*2^52 puts q in the lowest bits of the mantissa, then the biased exponent is shifted in place
+  */
+BATCH_MATH_INLINE double power_of_two(const double q)
+{
+    const double shifted = q + 6755399441055744.0;
+    std::uint64_t bits;
+    std::memcpy(&bits, &shifted, sizeof(double));
+    bits = (bits + 1023) << 52;
+    double ret;
+    std::memcpy(&ret, &bits, sizeof(double));
+    return ret;
+}
+
+/**  \brief exp(x) = 2^q*exp(r), with |r| <= ln(2)/2 & exp(r) evaluated by its Taylor series (degree 13)
+  */
+BATCH_MATH_INLINE void exp_loop(const double* x, double* y, const size_t n)
+{
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        const double xi = x[i];
+        const double x_ = std::min(std::max(EXP_MIN, xi), EXP_MAX); // NaN -> EXP_MIN
+        const double q = std::floor(x_*LOG2_E + 0.5);
+        const double r = (x_ - q*LN2_HI) - q*LN2_LO;
+        const double p = 1 + r*(1 + r*(1./2 + r*(1./6 + r*(1./24 + r*(1./120 + r*(1./720 + r*(1./5040 + r*(1./40320
+                           + r*(1./362880 + r*(1./3628800 + r*(1./39916800 + r*(1./479001600 + r*(1./6227020800.)))))))))))));
+        // 2^q is built in two halves so that q = 1024 (x close to EXP_MAX) does not overflow the exponent
+        const double q1 = std::floor(0.5*q);
+        const double ret = (p*power_of_two(q1))*power_of_two(q - q1);
+        double y_ = xi < EXP_MIN ? 0 : ret;
+        y_ = xi > EXP_MAX ? HUGE_VAL : y_;
+        y[i] = xi != xi ? xi : y_;
+    }
+}
+
+struct BatchMathImplementation
+{
+    void (*sin)(const double*, double*, const size_t);
+    void (*sincos)(const double*, double*, double*, const size_t);
+    void (*exp)(const double*, double*, const size_t);
+    const char* instruction_set;
+};
+
+#define BATCH_MATH_DEFINE(SUFFIX, ATTRIBUTES) \
+void batch_sin_##SUFFIX(const double* x, double* s, const size_t n); \
+ATTRIBUTES void batch_sin_##SUFFIX(const double* x, double* s, const size_t n) {sin_loop(x, s, n);} \
+void batch_sincos_##SUFFIX(const double* x, double* s, double* c, const size_t n); \
+ATTRIBUTES void batch_sincos_##SUFFIX(const double* x, double* s, double* c, const size_t n) {sincos_loop(x, s, c, n);} \
+void batch_exp_##SUFFIX(const double* x, double* y, const size_t n); \
+ATTRIBUTES void batch_exp_##SUFFIX(const double* x, double* y, const size_t n) {exp_loop(x, y, n);}
+
+BATCH_MATH_DEFINE(generic, )
+#if BATCH_MATH_RUNTIME_DISPATCH
+BATCH_MATH_DEFINE(avx2, __attribute__((target("avx2,fma"))))
+BATCH_MATH_DEFINE(avx512, __attribute__((target("avx512f,avx512dq"))))
+#endif
+
+BatchMathImplementation select_implementation();
+BatchMathImplementation select_implementation()
+{
+#if BATCH_MATH_RUNTIME_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") and __builtin_cpu_supports("avx512dq"))
+    {
+        const BatchMathImplementation ret = {batch_sin_avx512, batch_sincos_avx512, batch_exp_avx512, "avx512"};
+        return ret;
+    }
+    if (__builtin_cpu_supports("avx2") and __builtin_cpu_supports("fma"))
+    {
+        const BatchMathImplementation ret = {batch_sin_avx2, batch_sincos_avx2, batch_exp_avx2, "avx2"};
+        return ret;
+    }
+#endif
+    const BatchMathImplementation ret = {batch_sin_generic, batch_sincos_generic, batch_exp_generic, "generic"};
+    return ret;
+}
+
+const BatchMathImplementation& implementation();
+const BatchMathImplementation& implementation()
+{
+    static const BatchMathImplementation ret = select_implementation();
+    return ret;
+}
+
+void batch_sin(const double* x, double* s, const size_t n)
+{
+    implementation().sin(x, s, n);
+}
+
+void batch_sincos(const double* x, double* s, double* c, const size_t n)
+{
+    implementation().sincos(x, s, c, n);
+}
+
+void batch_exp(const double* x, double* y, const size_t n)
+{
+    implementation().exp(x, y, n);
+}
+
+std::string batch_math_instruction_set()
+{
+    return implementation().instruction_set;
+}
@@ -57,6 +57,7 @@ DiscreteDirectionalWaveSpectrum discretize(
     for (const auto omega:ret.omega) ret.k.push_back(S.get_wave_number(omega));
     ret.pdyn_factor = [stretching](const double k, const double z, const double eta){return dynamic_pressure_factor(k,z,eta,stretching);};
     ret.pdyn_factor_sh = [stretching](const double k, const double z, const double eta){return dynamic_pressure_factor(k,z,eta,stretching);};
+    ret.rescaled_z = [stretching](const double z, const double eta){return stretching.rescaled_z(z,eta);};
     return ret;
 }
 
@@ -89,6 +90,8 @@ DiscreteDirectionalWaveSpectrum discretize(
     }
     ret.pdyn_factor = [h,stretching](const double k, const double z, const double eta){return dynamic_pressure_factor(k,z,h,eta,stretching);};
     ret.pdyn_factor_sh = [h,stretching](const double k, const double z, const double eta){return dynamic_pressure_factor_sh(k,z,h,eta,stretching);};
+    ret.depth = h;
+    ret.rescaled_z = [stretching](const double z, const double eta){return stretching.rescaled_z(z,eta);};
     return ret;
 }
 
@@ -170,6 +173,28 @@ FlatDiscreteDirectionalWaveSpectrum flatten(
     }
     ret.pdyn_factor = spectrum.pdyn_factor;
     ret.pdyn_factor_sh = spectrum.pdyn_factor_sh;
+    ret.depth = spectrum.depth;
+    ret.rescaled_z = spectrum.rescaled_z;
+    return ret;
+}
+
+std::vector<DiscreteDirectionalWaveSpectrum> split_into_components(const FlatDiscreteDirectionalWaveSpectrum& spectrum)
+{
+    std::vector<DiscreteDirectionalWaveSpectrum> ret(spectrum.a.size());
+    for (size_t i = 0 ; i < spectrum.a.size() ; ++i)
+    {
+        // With a single frequency & a single direction, 'flatten' uses domega = dpsi = 1, so a = sqrt(2*Si*Dj)
+        ret[i].Si = {spectrum.a[i]*spectrum.a[i]/2};
+        ret[i].Dj = {1};
+        ret[i].omega = {spectrum.omega.at(i)};
+        ret[i].psi = {spectrum.psi.at(i)};
+        ret[i].k = {spectrum.k.at(i)};
+        ret[i].phase = {{spectrum.phase.at(i)}};
+        ret[i].pdyn_factor = spectrum.pdyn_factor;
+        ret[i].pdyn_factor_sh = spectrum.pdyn_factor_sh;
+        ret[i].depth = spectrum.depth;
+        ret[i].rescaled_z = spectrum.rescaled_z;
+    }
     return ret;
 }
 
@@ -194,6 +219,8 @@ FlatDiscreteDirectionalWaveSpectrum filter(
     FlatDiscreteDirectionalWaveSpectrum ret;
     ret.pdyn_factor=spectrum.pdyn_factor;
     ret.pdyn_factor_sh=spectrum.pdyn_factor_sh;
+    ret.depth=spectrum.depth;
+    ret.rescaled_z=spectrum.rescaled_z;
     for (size_t i = 0 ; i < n; ++i)
     {
         a = spectrum.a.at(i);
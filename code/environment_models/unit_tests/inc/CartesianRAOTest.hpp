@@ -0,0 +1,25 @@
+/*
+ * CartesianRAOTest.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef CARTESIANRAOTEST_HPP_
+#define CARTESIANRAOTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator.hpp>
+
+class CartesianRAOTest : public ::testing::Test
+{
+    protected:
+        CartesianRAOTest();
+        virtual ~CartesianRAOTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+
+};
+
+#endif  /* CARTESIANRAOTEST_HPP_ */
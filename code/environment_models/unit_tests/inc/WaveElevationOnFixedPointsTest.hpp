@@ -0,0 +1,25 @@
+/*
+ * WaveElevationOnFixedPointsTest.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef WAVEELEVATIONONFIXEDPOINTSTEST_HPP_
+#define WAVEELEVATIONONFIXEDPOINTSTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator.hpp>
+
+class WaveElevationOnFixedPointsTest : public ::testing::Test
+{
+    protected:
+        WaveElevationOnFixedPointsTest();
+        virtual ~WaveElevationOnFixedPointsTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+
+};
+
+#endif  /* WAVEELEVATIONONFIXEDPOINTSTEST_HPP_ */
@@ -0,0 +1,25 @@
+/*
+ * WaveElevationOnRegularGridTest.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef WAVEELEVATIONONREGULARGRIDTEST_HPP_
+#define WAVEELEVATIONONREGULARGRIDTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator.hpp>
+
+class WaveElevationOnRegularGridTest : public ::testing::Test
+{
+    protected:
+        WaveElevationOnRegularGridTest();
+        virtual ~WaveElevationOnRegularGridTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+
+};
+
+#endif  /* WAVEELEVATIONONREGULARGRIDTEST_HPP_ */
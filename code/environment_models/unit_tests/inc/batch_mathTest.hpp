@@ -0,0 +1,25 @@
+/*
+ * batch_mathTest.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef BATCH_MATHTEST_HPP_
+#define BATCH_MATHTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator.hpp>
+
+class batch_mathTest : public ::testing::Test
+{
+    protected:
+        batch_mathTest();
+        virtual ~batch_mathTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+
+};
+
+#endif  /* BATCH_MATHTEST_HPP_ */
@@ -17,6 +17,7 @@
 #include "discretize.hpp"
 #include "YamlWaveModelInput.hpp"
 #include "Stretching.hpp"
+#include "batch_math.hpp"
 #define _USE_MATH_DEFINE
 #include <cmath>
 #define PI M_PI
@@ -799,3 +800,58 @@ TEST_F(AiryTest, get_dynamic_pressure_and_orbital_velocities_should_be_0_above_w
         ASSERT_DOUBLE_EQ(0, wave.get_orbital_velocity(g, x, y, z, t, eta).m.col(0).norm());
     }
 }
+
+TEST_F(AiryTest, vectorized_loops_should_match_the_scalar_formulas)
+{
+    const double g = 9.81;
+    const double rho = 1025;
+    const double h = 50;
+    const double t = a.random<double>().between(0, 1000);
+    YamlStretching ys;
+    ys.h = 10;
+    ys.delta = 0.5;
+    const Stretching stretching(ys);
+    const BretschneiderSpectrum S(3, 8);
+    const Cos2sDirectionalSpreading D(PI/3, 2);
+    const Airy wave(discretize(S, D, 0.5, 3, 50, h, stretching), 12);
+    const FlatDiscreteDirectionalWaveSpectrum spectrum = wave.get_flat_spectrum();
+    const size_t n = spectrum.a.size();
+
+    std::vector<double> x, y, z;
+    for (size_t j = 0 ; j < 20 ; ++j)
+    {
+        x.push_back(a.random<double>().between(-200, 200));
+        y.push_back(a.random<double>().between(-200, 200));
+        z.push_back(a.random<double>().between(0, 40));
+    }
+    const std::vector<double> eta = wave.get_elevation(x, y, t);
+    const std::vector<double> pdyn = wave.get_dynamic_pressure(rho, g, x, y, z, eta, t);
+    const ssc::kinematics::PointMatrix V = wave.get_orbital_velocity(g, x, y, z, t, eta);
+
+    // The loops only differ from the scalar formulas by the approximations of sin, cos & exp (cf. batch_math.hpp)
+    double sum_of_amplitudes = 0;
+    for (size_t i = 0 ; i < n ; ++i) sum_of_amplitudes += spectrum.a[i];
+    const double tolerance = 4*(BATCH_MATH_SINCOS_TOLERANCE + BATCH_MATH_EXP_TOLERANCE)*sum_of_amplitudes;
+    for (size_t j = 0 ; j < x.size() ; ++j)
+    {
+        double zeta = 0, p = 0, u = 0, v = 0, w = 0;
+        for (size_t i = 0 ; i < n ; ++i)
+        {
+            const double theta = -spectrum.omega[i]*t + spectrum.k[i]*(x[j]*spectrum.cos_psi[i] + y[j]*spectrum.sin_psi[i]) + spectrum.phase[i];
+            zeta -= spectrum.a[i]*sin(theta);
+            p += spectrum.a[i]*spectrum.pdyn_factor(spectrum.k[i], z[j], eta[j])*sin(theta);
+            const double a_k_omega = spectrum.a[i]*spectrum.k[i]/spectrum.omega[i];
+            u += a_k_omega*spectrum.pdyn_factor(spectrum.k[i], z[j], 0)*sin(theta)*spectrum.cos_psi[i];
+            v += a_k_omega*spectrum.pdyn_factor(spectrum.k[i], z[j], 0)*sin(theta)*spectrum.sin_psi[i];
+            w += a_k_omega*spectrum.pdyn_factor_sh(spectrum.k[i], z[j], 0)*cos(theta);
+        }
+        ASSERT_NEAR(zeta, eta[j], tolerance) << "j = " << j;
+        if (z[j] >= eta[j])
+        {
+            ASSERT_NEAR(rho*g*p, pdyn[j], rho*g*tolerance) << "j = " << j;
+            ASSERT_NEAR(g*u, (double)V.m(0,j), g*tolerance) << "j = " << j;
+            ASSERT_NEAR(g*v, (double)V.m(1,j), g*tolerance) << "j = " << j;
+            ASSERT_NEAR(g*w, (double)V.m(2,j), g*tolerance) << "j = " << j;
+        }
+    }
+}
@@ -0,0 +1,111 @@
+/*
+ * CartesianRAOTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include "CartesianRAOTest.hpp"
+#include "CartesianRAO.hpp"
+#include "Airy.hpp"
+#include "BretschneiderSpectrum.hpp"
+#include "Cos2sDirectionalSpreading.hpp"
+#include "discretize.hpp"
+#include "Stretching.hpp"
+#include "YamlWaveModelInput.hpp"
+#include "InternalErrorException.hpp"
+
+#define _USE_MATH_DEFINE
+#include <cmath>
+#define PI M_PI
+
+CartesianRAOTest::CartesianRAOTest() : a(ssc::random_data_generator::DataGenerator(2026))
+{
+}
+
+CartesianRAOTest::~CartesianRAOTest()
+{
+}
+
+void CartesianRAOTest::SetUp()
+{
+}
+
+void CartesianRAOTest::TearDown()
+{
+}
+
+TEST_F(CartesianRAOTest, example)
+{
+//! [CartesianRAOTest example]
+    YamlStretching ys;
+    ys.h = 0;
+    ys.delta = 1;
+    // More components than RAO_BLOCK_SIZE (cf. CartesianRAO.cpp)
+    const Airy wave(discretize(BretschneiderSpectrum(3, 8), Cos2sDirectionalSpreading(PI/3, 2), 0.1, 3, 30, Stretching(ys)), 12);
+    const size_t n = wave.get_flat_spectrum().a.size();
+    ASSERT_GT(n, (size_t)256);
+    std::array<std::vector<double>, 6> rao_module;
+    std::array<std::vector<double>, 6> rao_phase;
+    CartesianRAO rao(n);
+    for (size_t k = 0 ; k < 6 ; ++k)
+    {
+        for (size_t i = 0 ; i < n ; ++i)
+        {
+            rao_module[k].push_back(a.random<double>().between(0, 1E6));
+            rao_phase[k].push_back(a.random<double>().between(-PI, PI));
+        }
+        rao.set(k, rao_module[k], rao_phase[k]);
+    }
+    const std::array<double, 6> F = wave.evaluate_rao_6dof(4, 5, 6, rao);
+//! [CartesianRAOTest example]
+//! [CartesianRAOTest expected output]
+    for (size_t k = 0 ; k < 6 ; ++k)
+    {
+        const double expected = wave.evaluate_rao(4, 5, 6, rao_module[k], rao_phase[k]);
+        ASSERT_NEAR(expected, F[k], 1E-10*std::max(1., std::abs(expected))) << "k = " << k;
+    }
+//! [CartesianRAOTest expected output]
+}
+
+TEST_F(CartesianRAOTest, should_match_evaluate_rao_for_random_positions_and_instants)
+{
+    YamlStretching ys;
+    ys.h = 0;
+    ys.delta = 1;
+    const Airy wave(discretize(BretschneiderSpectrum(2, 6), Cos2sDirectionalSpreading(PI/4, 4), 0.2, 2, 20, Stretching(ys)), 7);
+    const size_t n = wave.get_flat_spectrum().a.size();
+    CartesianRAO rao(n);
+    std::array<std::vector<double>, 6> rao_module;
+    std::array<std::vector<double>, 6> rao_phase;
+    for (size_t k = 0 ; k < 6 ; ++k)
+    {
+        rao_module[k] = a.random_vector_of<double>().of_size(n).between(0, 1E7);
+        rao_phase[k] = a.random_vector_of<double>().of_size(n).between(-10, 10);
+        rao.set(k, rao_module[k], rao_phase[k]);
+    }
+    for (size_t j = 0 ; j < 20 ; ++j)
+    {
+        const double x = a.random<double>().between(-1000, 1000);
+        const double y = a.random<double>().between(-1000, 1000);
+        const double t = a.random<double>().between(0, 10000);
+        const std::array<double, 6> F = wave.evaluate_rao_6dof(x, y, t, rao);
+        for (size_t k = 0 ; k < 6 ; ++k)
+        {
+            const double expected = wave.evaluate_rao(x, y, t, rao_module[k], rao_phase[k]);
+            ASSERT_NEAR(expected, F[k], 1E-9*std::max(1., std::abs(expected))) << "x = " << x << ", y = " << y << ", t = " << t << ", k = " << k;
+        }
+    }
+}
+
+TEST_F(CartesianRAOTest, should_throw_if_the_rao_does_not_match_the_spectrum)
+{
+    YamlStretching ys;
+    ys.h = 0;
+    ys.delta = 1;
+    const Airy wave(discretize(BretschneiderSpectrum(3, 8), Cos2sDirectionalSpreading(PI/3, 2), 0.1, 3, 10, Stretching(ys)), 12);
+    const CartesianRAO rao(wave.get_flat_spectrum().a.size() + 1);
+    ASSERT_THROW(wave.evaluate_rao_6dof(1, 2, 3, rao), InternalErrorException);
+    CartesianRAO rao2;
+    ASSERT_THROW(rao2.set(0, std::vector<double>(3, 1), std::vector<double>(2, 0)), InternalErrorException);
+}
@@ -0,0 +1,105 @@
+/*
+ * WaveElevationOnFixedPointsTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include "WaveElevationOnFixedPointsTest.hpp"
+#include "WaveElevationOnFixedPoints.hpp"
+#include "Airy.hpp"
+#include "BretschneiderSpectrum.hpp"
+#include "Cos2sDirectionalSpreading.hpp"
+#include "JonswapSpectrum.hpp"
+#include "DiracDirectionalSpreading.hpp"
+#include "discretize.hpp"
+#include "Stretching.hpp"
+#include "YamlWaveModelInput.hpp"
+#include "InternalErrorException.hpp"
+
+#define _USE_MATH_DEFINE
+#include <cmath>
+#define PI M_PI
+
+WaveElevationOnFixedPointsTest::WaveElevationOnFixedPointsTest() : a(ssc::random_data_generator::DataGenerator(8712))
+{
+}
+
+WaveElevationOnFixedPointsTest::~WaveElevationOnFixedPointsTest()
+{
+}
+
+void WaveElevationOnFixedPointsTest::SetUp()
+{
+}
+
+void WaveElevationOnFixedPointsTest::TearDown()
+{
+}
+
+Stretching no_stretching();
+Stretching no_stretching()
+{
+    YamlStretching ys;
+    ys.h = 0;
+    ys.delta = 1;
+    return Stretching(ys);
+}
+
+TEST_F(WaveElevationOnFixedPointsTest, example)
+{
+//! [WaveElevationOnFixedPointsTest example]
+    const Airy wave(discretize(BretschneiderSpectrum(3, 8), Cos2sDirectionalSpreading(PI/3, 2), 0.1, 3, 30, no_stretching()), 12);
+    const std::vector<double> x{0, 10, 20, 30};
+    const std::vector<double> y{0, 0, 5, 5};
+    const WaveElevationOnFixedPoints mesh(std::vector<FlatDiscreteDirectionalWaveSpectrum>(1, wave.get_flat_spectrum()), x, y);
+    const std::vector<double> eta = mesh.get_elevation(12.3);
+//! [WaveElevationOnFixedPointsTest example]
+//! [WaveElevationOnFixedPointsTest expected output]
+    const std::vector<double> expected = wave.get_elevation(x, y, 12.3);
+    ASSERT_EQ(expected.size(), eta.size());
+    for (size_t i = 0 ; i < eta.size() ; ++i) ASSERT_NEAR(expected[i], eta[i], 1E-10);
+//! [WaveElevationOnFixedPointsTest expected output]
+}
+
+TEST_F(WaveElevationOnFixedPointsTest, elevations_of_several_models_are_summed)
+{
+    const Airy wave1(discretize(BretschneiderSpectrum(3, 8), Cos2sDirectionalSpreading(PI/3, 2), 0.1, 3, 30, no_stretching()), 12);
+    const Airy wave2(discretize(JonswapSpectrum(2, 6, 3.3), DiracDirectionalSpreading(PI/4), 0.2, 2, 40, no_stretching()), 87);
+    std::vector<double> x, y;
+    for (size_t i = 0 ; i < 100 ; ++i)
+    {
+        x.push_back(a.random<double>().between(-500, 500));
+        y.push_back(a.random<double>().between(-500, 500));
+    }
+    std::vector<FlatDiscreteDirectionalWaveSpectrum> spectra;
+    spectra.push_back(wave1.get_flat_spectrum());
+    spectra.push_back(wave2.get_flat_spectrum());
+    const WaveElevationOnFixedPoints mesh(spectra, x, y);
+    ASSERT_EQ(2*(wave1.get_flat_spectrum().a.size() + wave2.get_flat_spectrum().a.size())*100, WaveElevationOnFixedPoints::nb_of_coefficients(spectra, 100));
+    for (size_t j = 0 ; j < 20 ; ++j)
+    {
+        const double t = a.random<double>().between(0, 10000);
+        const std::vector<double> eta = mesh.get_elevation(t);
+        const std::vector<double> eta1 = wave1.get_elevation(x, y, t);
+        const std::vector<double> eta2 = wave2.get_elevation(x, y, t);
+        for (size_t i = 0 ; i < x.size() ; ++i)
+        {
+            ASSERT_NEAR(eta1[i] + eta2[i], eta[i], 1E-9) << "t = " << t << ", i = " << i;
+        }
+    }
+}
+
+TEST_F(WaveElevationOnFixedPointsTest, should_throw_if_x_and_y_do_not_have_the_same_size)
+{
+    const Airy wave(discretize(BretschneiderSpectrum(3, 8), DiracDirectionalSpreading(0), 0.1, 3, 10, no_stretching()), 12);
+    const std::vector<FlatDiscreteDirectionalWaveSpectrum> spectra(1, wave.get_flat_spectrum());
+    ASSERT_THROW(WaveElevationOnFixedPoints(spectra, std::vector<double>(3), std::vector<double>(2)), InternalErrorException);
+}
+
+TEST_F(WaveElevationOnFixedPointsTest, no_points)
+{
+    const Airy wave(discretize(BretschneiderSpectrum(3, 8), DiracDirectionalSpreading(0), 0.1, 3, 10, no_stretching()), 12);
+    const WaveElevationOnFixedPoints mesh(std::vector<FlatDiscreteDirectionalWaveSpectrum>(1, wave.get_flat_spectrum()), std::vector<double>(), std::vector<double>());
+    ASSERT_TRUE(mesh.get_elevation(a.random<double>()).empty());
+}
@@ -0,0 +1,254 @@
+/*
+ * WaveElevationOnRegularGridTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include "WaveElevationOnRegularGridTest.hpp"
+#include "WaveElevationOnRegularGrid.hpp"
+#include "WaveElevationOnFixedPoints.hpp"
+#include "Airy.hpp"
+#include "BretschneiderSpectrum.hpp"
+#include "Cos2sDirectionalSpreading.hpp"
+#include "discretize.hpp"
+#include "Stretching.hpp"
+#include "YamlWaveModelInput.hpp"
+#include "InternalErrorException.hpp"
+
+#define _USE_MATH_DEFINE
+#include <cmath>
+#define PI M_PI
+
+WaveElevationOnRegularGridTest::WaveElevationOnRegularGridTest() : a(ssc::random_data_generator::DataGenerator(21225))
+{
+}
+
+WaveElevationOnRegularGridTest::~WaveElevationOnRegularGridTest()
+{
+}
+
+void WaveElevationOnRegularGridTest::SetUp()
+{
+}
+
+void WaveElevationOnRegularGridTest::TearDown()
+{
+}
+
+void add_component(FlatDiscreteDirectionalWaveSpectrum& spectrum, const double a, const double omega, const double kx, const double ky, const double phase);
+void add_component(FlatDiscreteDirectionalWaveSpectrum& spectrum, const double a, const double omega, const double kx, const double ky, const double phase)
+{
+    const double psi = std::atan2(ky, kx);
+    spectrum.a.push_back(a);
+    spectrum.omega.push_back(omega);
+    spectrum.psi.push_back(psi);
+    spectrum.cos_psi.push_back(std::cos(psi));
+    spectrum.sin_psi.push_back(std::sin(psi));
+    spectrum.k.push_back(std::hypot(kx, ky));
+    spectrum.phase.push_back(phase);
+}
+
+/**  \brief Spectrum whose wave numbers are multiples of 2*pi/(N*d), N being the FFT size
+  */
+FlatDiscreteDirectionalWaveSpectrum on_grid_spectrum(ssc::random_data_generator::DataGenerator& a, const double dx, const size_t Nx, const double dy, const size_t Ny, const size_t nb_of_components);
+FlatDiscreteDirectionalWaveSpectrum on_grid_spectrum(ssc::random_data_generator::DataGenerator& a, const double dx, const size_t Nx, const double dy, const size_t Ny, const size_t nb_of_components)
+{
+    FlatDiscreteDirectionalWaveSpectrum ret;
+    for (size_t i = 0 ; i < nb_of_components ; ++i)
+    {
+        const int p = a.random<int>().between(-(int)Nx/2, (int)Nx/2);
+        const int q = a.random<int>().between(-(int)Ny/2, (int)Ny/2);
+        add_component(ret, a.random<double>().between(0.01, 1), a.random<double>().between(0.1, 2), 2*PI*(double)p/(dx*(double)Nx), 2*PI*(double)q/(dy*(double)Ny), a.random<double>().between(0, 2*PI));
+    }
+    return ret;
+}
+
+std::vector<double> coordinates(const double x0, const double dx, const size_t nx, const double y0, const double dy, const size_t ny, const bool along_x);
+std::vector<double> coordinates(const double x0, const double dx, const size_t nx, const double y0, const double dy, const size_t ny, const bool along_x)
+{
+    std::vector<double> ret;
+    for (size_t j = 0 ; j < ny ; ++j)
+    {
+        for (size_t i = 0 ; i < nx ; ++i)
+        {
+            ret.push_back(along_x ? x0 + (double)i*dx : y0 + (double)j*dy);
+        }
+    }
+    return ret;
+}
+
+void check_against_direct_computation(const std::vector<FlatDiscreteDirectionalWaveSpectrum>& spectra, const double x0, const double dx, const size_t nx, const double y0, const double dy, const size_t ny, const double t);
+void check_against_direct_computation(const std::vector<FlatDiscreteDirectionalWaveSpectrum>& spectra, const double x0, const double dx, const size_t nx, const double y0, const double dy, const size_t ny, const double t)
+{
+    const WaveElevationOnRegularGrid grid(spectra, x0, dx, nx, y0, dy, ny);
+    const WaveElevationOnFixedPoints points(spectra, coordinates(x0, dx, nx, y0, dy, ny, true), coordinates(x0, dx, nx, y0, dy, ny, false));
+    const std::vector<double> eta = grid.get_elevation(t);
+    const std::vector<double> expected = points.get_elevation(t);
+    ASSERT_EQ(expected.size(), eta.size());
+    for (size_t i = 0 ; i < eta.size() ; ++i) ASSERT_NEAR(expected[i], eta[i], 1E-10) << "i = " << i << ", t = " << t;
+}
+
+TEST_F(WaveElevationOnRegularGridTest, example)
+{
+//! [WaveElevationOnRegularGridTest example]
+    // 50 x 20 grid, so the FFT is done on a 64 x 32 grid
+    const double dx = 2, dy = 5;
+    FlatDiscreteDirectionalWaveSpectrum spectrum;
+    add_component(spectrum, 1, 0.8, 2*PI*3/(dx*64), 2*PI*(-2)/(dy*32), 0.4);
+    add_component(spectrum, 0.5, 1.1, 2*PI*7/(dx*64), 2*PI*1/(dy*32), 1.9);
+    const std::vector<FlatDiscreteDirectionalWaveSpectrum> spectra(1, spectrum);
+    const WaveElevationOnRegularGrid grid(spectra, -50, dx, 50, 10, dy, 20);
+    const std::vector<double> eta = grid.get_elevation(30);
+//! [WaveElevationOnRegularGridTest example]
+//! [WaveElevationOnRegularGridTest expected output]
+    ASSERT_EQ(2, grid.get_nb_of_components_on_grid());
+    ASSERT_EQ(0, grid.get_nb_of_components_off_grid());
+    ASSERT_EQ(1000, eta.size());
+    for (size_t j = 0 ; j < 20 ; ++j)
+    {
+        for (size_t i = 0 ; i < 50 ; ++i)
+        {
+            const double x = -50 + (double)i*dx;
+            const double y = 10 + (double)j*dy;
+            double expected = 0;
+            for (size_t k = 0 ; k < 2 ; ++k)
+            {
+                expected -= spectrum.a[k]*std::sin(spectrum.k[k]*(x*spectrum.cos_psi[k] + y*spectrum.sin_psi[k]) - spectrum.omega[k]*30 + spectrum.phase[k]);
+            }
+            ASSERT_NEAR(expected, eta[j*50+i], 1E-10);
+        }
+    }
+//! [WaveElevationOnRegularGridTest expected output]
+}
+
+TEST_F(WaveElevationOnRegularGridTest, on_grid_components_should_be_exact)
+{
+    const double dx = a.random<double>().between(0.5, 5);
+    const double dy = a.random<double>().between(0.5, 5);
+    const std::vector<FlatDiscreteDirectionalWaveSpectrum> spectra(1, on_grid_spectrum(a, dx, 128, dy, 64, 500));
+    const WaveElevationOnRegularGrid grid(spectra, -100, dx, 100, 20, dy, 40);
+    ASSERT_EQ(500, grid.get_nb_of_components_on_grid());
+    for (size_t i = 0 ; i < 5 ; ++i)
+    {
+        check_against_direct_computation(spectra, -100, dx, 100, 20, dy, 40, a.random<double>().between(0, 3600));
+    }
+}
+
+TEST_F(WaveElevationOnRegularGridTest, off_grid_components_should_be_exact)
+{
+    YamlStretching ys;
+    ys.h = 0;
+    ys.delta = 1;
+    const Airy wave(discretize(BretschneiderSpectrum(3, 8), Cos2sDirectionalSpreading(PI/3, 2), 0.1, 3, 30, Stretching(ys)), 12);
+    const std::vector<FlatDiscreteDirectionalWaveSpectrum> spectra(1, wave.get_flat_spectrum());
+    const WaveElevationOnRegularGrid grid(spectra, -100, 3, 70, -50, 4, 30);
+    ASSERT_EQ(wave.get_flat_spectrum().a.size(), grid.get_nb_of_components_off_grid() + grid.get_nb_of_components_on_grid());
+    ASSERT_LT(0, grid.get_nb_of_components_off_grid());
+    check_against_direct_computation(spectra, -100, 3, 70, -50, 4, 30, a.random<double>().between(0, 3600));
+}
+
+TEST_F(WaveElevationOnRegularGridTest, mixed_spectra)
+{
+    YamlStretching ys;
+    ys.h = 0;
+    ys.delta = 1;
+    const Airy wave(discretize(BretschneiderSpectrum(3, 8), Cos2sDirectionalSpreading(PI/3, 2), 0.1, 3, 10, Stretching(ys)), 12);
+    std::vector<FlatDiscreteDirectionalWaveSpectrum> spectra;
+    spectra.push_back(on_grid_spectrum(a, 2, 32, 3, 16, 100));
+    spectra.push_back(wave.get_flat_spectrum());
+    const WaveElevationOnRegularGrid grid(spectra, 0, 2, 32, 0, 3, 9);
+    ASSERT_LE(100, grid.get_nb_of_components_on_grid());
+    ASSERT_LT(0, grid.get_nb_of_components_off_grid());
+    check_against_direct_computation(spectra, 0, 2, 32, 0, 3, 9, a.random<double>().between(0, 3600));
+}
+
+TEST_F(WaveElevationOnRegularGridTest, grids_with_a_single_line_or_column)
+{
+    const std::vector<FlatDiscreteDirectionalWaveSpectrum> spectra(1, on_grid_spectrum(a, 2, 64, 3, 64, 50));
+    check_against_direct_computation(spectra, 0, 2, 64, 7, 0, 1, a.random<double>().between(0, 3600));
+    check_against_direct_computation(spectra, 5, 0, 1, 0, 3, 64, a.random<double>().between(0, 3600));
+    check_against_direct_computation(spectra, 5, 0, 1, 7, 0, 1, a.random<double>().between(0, 3600));
+}
+
+TEST_F(WaveElevationOnRegularGridTest, should_throw_if_grid_is_empty)
+{
+    const std::vector<FlatDiscreteDirectionalWaveSpectrum> spectra(1, on_grid_spectrum(a, 2, 64, 3, 64, 5));
+    ASSERT_THROW(WaveElevationOnRegularGrid(spectra, 0, 1, 0, 0, 1, 10), InternalErrorException);
+    ASSERT_THROW(WaveElevationOnRegularGrid(spectra, 0, 1, 10, 0, 1, 0), InternalErrorException);
+}
+
+TEST_F(WaveElevationOnRegularGridTest, put_on_regular_grid_should_move_all_components_to_the_FFT_grid)
+{
+    YamlStretching ys;
+    ys.h = 0;
+    ys.delta = 1;
+    const Airy wave(discretize(BretschneiderSpectrum(3, 8), Cos2sDirectionalSpreading(PI/3, 2), 0.1, 3, 30, Stretching(ys)), 12);
+    //! [WaveElevationOnRegularGridTest put_on_regular_grid_example]
+    const FlatDiscreteDirectionalWaveSpectrum spectrum = put_on_regular_grid(wave.get_flat_spectrum(), 3, 70, 4, 30);
+    const std::vector<FlatDiscreteDirectionalWaveSpectrum> spectra(1, spectrum);
+    const WaveElevationOnRegularGrid grid(spectra, -100, 3, 70, -50, 4, 30);
+    //! [WaveElevationOnRegularGridTest put_on_regular_grid_example]
+    ASSERT_EQ(0, grid.get_nb_of_components_off_grid());
+    const FlatDiscreteDirectionalWaveSpectrum initial = wave.get_flat_spectrum();
+    ASSERT_EQ(initial.a.size(), spectrum.a.size());
+    const double dkx = 2*PI/(3*128);
+    const double dky = 2*PI/(4*32);
+    for (size_t i = 0 ; i < spectrum.a.size() ; ++i)
+    {
+        ASSERT_EQ(initial.a[i], spectrum.a[i]);
+        ASSERT_EQ(initial.phase[i], spectrum.phase[i]);
+        ASSERT_NEAR(initial.k[i]*initial.cos_psi[i], spectrum.k[i]*spectrum.cos_psi[i], dkx/2 + 1E-12) << "i = " << i;
+        ASSERT_NEAR(initial.k[i]*initial.sin_psi[i], spectrum.k[i]*spectrum.sin_psi[i], dky/2 + 1E-12) << "i = " << i;
+        ASSERT_NEAR(spectrum.omega[i]*spectrum.omega[i], 9.81*spectrum.k[i], 1E-10) << "i = " << i;
+        ASSERT_NEAR(std::cos(spectrum.psi[i]), spectrum.cos_psi[i], 1E-12);
+    }
+    check_against_direct_computation(spectra, -100, 3, 70, -50, 4, 30, a.random<double>().between(0, 3600));
+}
+
+TEST_F(WaveElevationOnRegularGridTest, directional_spectra_should_match_the_flat_spectrum_once_put_on_a_regular_grid)
+{
+    YamlStretching ys;
+    ys.h = 0;
+    ys.delta = 1;
+    Airy wave(discretize(BretschneiderSpectrum(3, 8), Cos2sDirectionalSpreading(PI/3, 2), 0.1, 3, 30, Stretching(ys)), 12);
+    ASSERT_EQ(1, wave.get_directional_spectra().size());
+    wave.put_on_regular_grid(3, 70, 4, 30);
+    const FlatDiscreteDirectionalWaveSpectrum flat = wave.get_flat_spectrum();
+    const std::vector<DiscreteDirectionalWaveSpectrum> spectra = wave.get_directional_spectra();
+    ASSERT_EQ(flat.a.size(), spectra.size());
+    for (size_t i = 0 ; i < spectra.size() ; ++i)
+    {
+        const FlatDiscreteDirectionalWaveSpectrum component = flatten(spectra[i]);
+        ASSERT_EQ(1, component.a.size());
+        ASSERT_NEAR(flat.a[i], component.a[0], 1E-12) << "i = " << i;
+        ASSERT_EQ(flat.omega[i], component.omega[0]) << "i = " << i;
+        ASSERT_EQ(flat.psi[i], component.psi[0]) << "i = " << i;
+        ASSERT_EQ(flat.k[i], component.k[0]) << "i = " << i;
+        ASSERT_EQ(flat.phase[i], component.phase[0]) << "i = " << i;
+    }
+    const double t = a.random<double>().between(0, 3600);
+    const std::vector<double> x{-100, 12.5, 107};
+    const std::vector<double> y{-50, 3, 66};
+    std::vector<double> eta(x.size(), 0);
+    for (const auto& spectrum:spectra)
+    {
+        const std::vector<double> eta_i = Airy(spectrum, spectrum.phase.at(0).at(0)).get_elevation(x, y, t); // Airy overwrites the phases
+        for (size_t j = 0 ; j < eta.size() ; ++j) eta[j] += eta_i[j];
+    }
+    const std::vector<double> expected = wave.get_elevation(x, y, t);
+    for (size_t j = 0 ; j < eta.size() ; ++j)
+    {
+        ASSERT_NEAR(expected[j], eta[j], 1E-10) << "j = " << j;
+    }
+}
+
+TEST_F(WaveElevationOnRegularGridTest, put_on_regular_grid_should_not_create_components_with_a_zero_wave_number)
+{
+    FlatDiscreteDirectionalWaveSpectrum spectrum;
+    add_component(spectrum, 1, 0.1, 1E-4, -2E-4, 0);
+    spectrum = put_on_regular_grid(spectrum, 1, 10, 1, 10);
+    ASSERT_DOUBLE_EQ(0, spectrum.k[0]*spectrum.cos_psi[0]);
+    ASSERT_DOUBLE_EQ(-2*PI/16, spectrum.k[0]*spectrum.sin_psi[0]);
+    ASSERT_DOUBLE_EQ(std::sqrt(9.81*2*PI/16), spectrum.omega[0]);
+}
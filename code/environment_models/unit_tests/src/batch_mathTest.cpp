@@ -0,0 +1,126 @@
+/*
+ * batch_mathTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include "batch_mathTest.hpp"
+#include "batch_math.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+batch_mathTest::batch_mathTest() : a(ssc::random_data_generator::DataGenerator(87542))
+{
+}
+
+batch_mathTest::~batch_mathTest()
+{
+}
+
+void batch_mathTest::SetUp()
+{
+}
+
+void batch_mathTest::TearDown()
+{
+}
+
+TEST_F(batch_mathTest, example)
+{
+//! [batch_mathTest example]
+    const std::vector<double> x{0, 0.5, 1, 2, 3};
+    std::vector<double> s(x.size()), c(x.size()), e(x.size());
+    batch_sincos(x.data(), s.data(), c.data(), x.size());
+    batch_exp(x.data(), e.data(), x.size());
+//! [batch_mathTest example]
+//! [batch_mathTest expected output]
+    for (size_t i = 0 ; i < x.size() ; ++i)
+    {
+        ASSERT_NEAR(std::sin(x[i]), s[i], BATCH_MATH_SINCOS_TOLERANCE);
+        ASSERT_NEAR(std::cos(x[i]), c[i], BATCH_MATH_SINCOS_TOLERANCE);
+        ASSERT_NEAR(std::exp(x[i]), e[i], BATCH_MATH_EXP_TOLERANCE*std::exp(x[i]));
+    }
+//! [batch_mathTest expected output]
+}
+
+TEST_F(batch_mathTest, sin_and_cos_should_be_within_the_documented_tolerance)
+{
+    const size_t n = 10000;
+    std::vector<double> x(n), s(n), c(n), s2(n);
+    for (size_t i = 0 ; i < n ; ++i) x[i] = a.random<double>().between(-1E5, 1E5);
+    batch_sincos(x.data(), s.data(), c.data(), n);
+    batch_sin(x.data(), s2.data(), n);
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        ASSERT_NEAR(std::sin(x[i]), s[i], BATCH_MATH_SINCOS_TOLERANCE) << "x = " << x[i];
+        ASSERT_NEAR(std::cos(x[i]), c[i], BATCH_MATH_SINCOS_TOLERANCE) << "x = " << x[i];
+        ASSERT_EQ(s[i], s2[i]) << "x = " << x[i];
+    }
+}
+
+TEST_F(batch_mathTest, sin_and_cos_should_be_exact_at_quadrant_boundaries)
+{
+    const std::vector<double> x{0, M_PI/2, M_PI, 3*M_PI/2, -M_PI/2, -M_PI};
+    std::vector<double> s(x.size()), c(x.size());
+    batch_sincos(x.data(), s.data(), c.data(), x.size());
+    for (size_t i = 0 ; i < x.size() ; ++i)
+    {
+        ASSERT_NEAR(std::sin(x[i]), s[i], BATCH_MATH_SINCOS_TOLERANCE);
+        ASSERT_NEAR(std::cos(x[i]), c[i], BATCH_MATH_SINCOS_TOLERANCE);
+    }
+}
+
+TEST_F(batch_mathTest, large_angles_should_be_delegated_to_the_standard_library)
+{
+    const std::vector<double> x{1, 2*BATCH_MATH_MAX_ANGLE, -1E12, 3};
+    std::vector<double> s(x.size()), c(x.size());
+    batch_sincos(x.data(), s.data(), c.data(), x.size());
+    for (size_t i = 0 ; i < x.size() ; ++i)
+    {
+        ASSERT_DOUBLE_EQ(std::sin(x[i]), s[i]);
+        ASSERT_DOUBLE_EQ(std::cos(x[i]), c[i]);
+    }
+}
+
+TEST_F(batch_mathTest, exp_should_be_within_the_documented_relative_tolerance)
+{
+    const size_t n = 10000;
+    std::vector<double> x(n), y(n);
+    for (size_t i = 0 ; i < n ; ++i) x[i] = a.random<double>().between(-700, 700);
+    batch_exp(x.data(), y.data(), n);
+    for (size_t i = 0 ; i < n ; ++i)
+    {
+        ASSERT_NEAR(std::exp(x[i]), y[i], BATCH_MATH_EXP_TOLERANCE*std::exp(x[i])) << "x = " << x[i];
+    }
+}
+
+TEST_F(batch_mathTest, exp_should_handle_underflows_overflows_and_nans)
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const std::vector<double> x{-1000, -709, 709.7, 710, nan, -HUGE_VAL, HUGE_VAL};
+    std::vector<double> y(x.size());
+    batch_exp(x.data(), y.data(), x.size());
+    ASSERT_EQ(0, y[0]);
+    ASSERT_EQ(0, y[1]);
+    ASSERT_NEAR(std::exp(709.7), y[2], BATCH_MATH_EXP_TOLERANCE*std::exp(709.7));
+    ASSERT_EQ(HUGE_VAL, y[3]);
+    ASSERT_TRUE(std::isnan(y[4]));
+    ASSERT_EQ(0, y[5]);
+    ASSERT_EQ(HUGE_VAL, y[6]);
+}
+
+TEST_F(batch_mathTest, exp_can_be_computed_in_place)
+{
+    std::vector<double> x{-2, -1, 0, 1, 2};
+    batch_exp(x.data(), x.data(), x.size());
+    for (int i = 0 ; i < 5 ; ++i) ASSERT_NEAR(std::exp(i-2), x[i], BATCH_MATH_EXP_TOLERANCE*std::exp(i-2));
+}
+
+TEST_F(batch_mathTest, instruction_set_should_be_known)
+{
+    const std::string s = batch_math_instruction_set();
+    ASSERT_TRUE((s == "avx512") or (s == "avx2") or (s == "generic")) << s;
+}
@@ -11,19 +11,24 @@
 #include <grpcpp/grpcpp.h>
 #include "model_exchange.grpc.pb.h"
 #include "model_exchange.pb.h"
-#include "XdynForME.hpp"
+#include "XdynForMEBatch.hpp"
 
 /*
  *
  */
 class ModelExchangeServiceImpl final : public ModelExchange::Service {
     public:
-        explicit ModelExchangeServiceImpl(const XdynForME& xdyn);
+        ModelExchangeServiceImpl(const std::string& yaml,
+                                 const size_t nb_of_threads //!< Maximum number of samples of a batch evaluated simultaneously (0 for ThreadPool::get_nb_of_threads())
+                                 );
         grpc::Status dx_dt_quaternion(grpc::ServerContext* context, const ModelExchangeRequestQuaternion* request, ModelExchangeResponse* response) override;
         grpc::Status dx_dt_euler_321(grpc::ServerContext* context, const ModelExchangeRequestEuler* request, ModelExchangeResponse* response) override;
+        grpc::Status dx_dt_quaternion_all_bodies(grpc::ServerContext* context, const ModelExchangeRequestQuaternionAllBodies* request, ModelExchangeResponseAllBodies* response) override;
+        grpc::Status dx_dt_euler_321_all_bodies(grpc::ServerContext* context, const ModelExchangeRequestEulerAllBodies* request, ModelExchangeResponseAllBodies* response) override;
+        grpc::Status dx_dt_quaternion_batch(grpc::ServerContext* context, const ModelExchangeRequestQuaternionBatch* request, ModelExchangeResponseBatch* response) override;
 
     private:
-        XdynForME xdyn;
+        XdynForMEBatch batch; //!< Also evaluates the requests of a single sample, so the model is only built once
 };
 
 #endif /* EXECUTABLES_INC_MODELEXCHANGESERVICEIMPL_HPP_ */
@@ -0,0 +1,31 @@
+/*
+ * XdynBatchCommandLineArguments.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef XDYNBATCHCOMMANDLINEARGUMENTS_HPP_
+#define XDYNBATCHCOMMANDLINEARGUMENTS_HPP_
+
+#include <string>
+#include <vector>
+
+struct XdynBatchCommandLineArguments
+{
+    XdynBatchCommandLineArguments();
+    std::vector<std::string> case_filenames;   //!< One simulation per file
+    std::vector<std::string> common_filenames; //!< Prepended to each case
+    std::string solver;
+    std::string output_format;                 //!< If not empty, each case writes all its states in a file named after the case
+    double initial_timestep;
+    double tstart;
+    double tend;
+    double absolute_tolerance;
+    double relative_tolerance;
+    size_t nb_of_threads;                      //!< 0 means one per hardware thread
+    bool catch_exceptions;
+    bool empty() const;
+};
+
+#endif /* XDYNBATCHCOMMANDLINEARGUMENTS_HPP_ */
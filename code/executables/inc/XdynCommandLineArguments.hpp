@@ -21,6 +21,8 @@ struct XdynCommandLineArguments
     double initial_timestep;
     double tstart;
     double tend;
+    double absolute_tolerance;
+    double relative_tolerance;
     bool catch_exceptions;
     bool empty() const;
 };
@@ -22,6 +22,7 @@ struct XdynForMECommandLineArguments
     bool show_help;
     bool show_websocket_debug_information;
     bool grpc;
+    size_t nb_of_threads; //!< Maximum number of samples of a batch evaluated simultaneously (0 means one per hardware thread)
 };
 
 
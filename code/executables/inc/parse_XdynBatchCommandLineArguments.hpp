@@ -0,0 +1,23 @@
+/*
+ * parse_XdynBatchCommandLineArguments.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef PARSE_XDYN_BATCH_COMMAND_LINE_ARGUMENTS_HPP
+#define PARSE_XDYN_BATCH_COMMAND_LINE_ARGUMENTS_HPP
+
+#include <string>
+
+struct XdynBatchCommandLineArguments;
+
+#include "boost/program_options.hpp"
+namespace po = boost::program_options;
+
+bool invalid(const XdynBatchCommandLineArguments& input);
+po::options_description get_options_description(XdynBatchCommandLineArguments& input_data);
+int parse_command_line_for_xdyn_batch(int argc, char **argv, XdynBatchCommandLineArguments& input_data);
+int fill_input_or_display_help(char *argv, XdynBatchCommandLineArguments& input_data);
+
+#endif /* PARSE_XDYN_BATCH_COMMAND_LINE_ARGUMENTS_HPP */
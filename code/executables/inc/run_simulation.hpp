@@ -0,0 +1,25 @@
+/*
+ * run_simulation.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef EXECUTABLES_INC_RUN_SIMULATION_HPP_
+#define EXECUTABLES_INC_RUN_SIMULATION_HPP_
+
+#include <string>
+
+struct XdynCommandLineArguments;
+class ListOfObservers;
+class Sim;
+
+void solve(const XdynCommandLineArguments& input_data, Sim& sys, ListOfObservers& observer);
+std::string input_data_serialize(const XdynCommandLineArguments& input_data);
+
+/**  \brief Builds the simulation described by yaml_input, its observers & runs it (used by xdyn & xdyn-batch)
+  *  \details Exceptions are not caught.
+  */
+void simulate(const XdynCommandLineArguments& input_data, const std::string& yaml_input);
+
+#endif /* EXECUTABLES_INC_RUN_SIMULATION_HPP_ */
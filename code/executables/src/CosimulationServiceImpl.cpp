@@ -102,10 +102,12 @@ YamlSimServerInputs from_grpc(grpc::ServerContext* , const CosimulationRequestEu
         std::map<std::string, double> commands(request->commands().begin(),
                 request->commands().end());
         server_inputs.commands = commands;
+        server_inputs.incremental = request->incremental();
         const size_t n = request->states().t_size();
         server_inputs.states.resize(n);
         for (size_t i = 0 ; i < n ; ++i)
         {
+            server_inputs.states[i].t = request->states().t(i);
             server_inputs.states[i].x = request->states().x(i);
             server_inputs.states[i].y = request->states().y(i);
             server_inputs.states[i].z = request->states().z(i);
@@ -139,10 +141,12 @@ YamlSimServerInputs from_grpc(grpc::ServerContext* , const CosimulationRequestQu
         std::map<std::string, double> commands(request->commands().begin(),
                 request->commands().end());
         server_inputs.commands = commands;
+        server_inputs.incremental = request->incremental();
         const size_t n = request->states().t_size();
         server_inputs.states.resize(n);
         for (size_t i = 0 ; i < n ; ++i)
         {
+            server_inputs.states[i].t = request->states().t(i);
             server_inputs.states[i].x = request->states().x(i);
             server_inputs.states[i].y = request->states().y(i);
             server_inputs.states[i].z = request->states().z(i);
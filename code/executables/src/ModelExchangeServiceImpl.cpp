@@ -8,12 +8,13 @@
 #include <sstream>
 #include <tuple>
 #include "BodyStates.hpp"
+#include "InvalidInputException.hpp"
 #include "ModelExchangeServiceImpl.hpp"
 #include "SimServerInputs.hpp"
 #include "YamlSimServerInputs.hpp"
 
-ModelExchangeServiceImpl::ModelExchangeServiceImpl(const XdynForME& xdyn_):
-xdyn(xdyn_)
+ModelExchangeServiceImpl::ModelExchangeServiceImpl(const std::string& yaml, const size_t nb_of_threads):
+batch(yaml, nb_of_threads)
 {}
 
 #define SIZE size()
@@ -27,8 +28,53 @@ xdyn(xdyn_)
     msg << "State '" << #state << "' has size " << n1 << ", whereas 't' has size " << n2 << ": this is a problem in the client code (caller of xdyn's gRPC server), not a problem with xdyn. Please ensure that '" << #state << "' and 't' have the same size in CosimulationRequest's 'States' type." << std::endl;\
 }
 
-grpc::Status check_states_size(const ModelExchangeRequestEuler* request);
-grpc::Status check_states_size(const ModelExchangeRequestEuler* request)
+grpc::Status to_status(const std::stringstream& msg);
+grpc::Status to_status(const std::stringstream& msg)
+{
+    if (msg.str().empty())
+    {
+        return grpc::Status::OK;
+    }
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, msg.str());
+}
+
+void check_states_size(const ModelExchangeStatesEuler& states, std::stringstream& msg);
+void check_states_size(const ModelExchangeStatesEuler& states, std::stringstream& msg)
+{
+    CHECK_SIZE(x);
+    CHECK_SIZE(y);
+    CHECK_SIZE(z);
+    CHECK_SIZE(u);
+    CHECK_SIZE(v);
+    CHECK_SIZE(w);
+    CHECK_SIZE(p);
+    CHECK_SIZE(q);
+    CHECK_SIZE(r);
+    CHECK_SIZE(phi);
+    CHECK_SIZE(theta);
+    CHECK_SIZE(psi);
+}
+
+void check_states_size(const ModelExchangeStatesQuaternion& states, std::stringstream& msg);
+void check_states_size(const ModelExchangeStatesQuaternion& states, std::stringstream& msg)
+{
+    CHECK_SIZE(x);
+    CHECK_SIZE(y);
+    CHECK_SIZE(z);
+    CHECK_SIZE(u);
+    CHECK_SIZE(v);
+    CHECK_SIZE(w);
+    CHECK_SIZE(p);
+    CHECK_SIZE(q);
+    CHECK_SIZE(r);
+    CHECK_SIZE(qr);
+    CHECK_SIZE(qi);
+    CHECK_SIZE(qj);
+    CHECK_SIZE(qk);
+}
+
+template <typename RequestType> grpc::Status check_states_size(const RequestType* request);
+template <typename RequestType> grpc::Status check_states_size(const RequestType* request)
 {
     std::stringstream msg;
     if (!request)
@@ -37,131 +83,185 @@ grpc::Status check_states_size(const ModelExchangeRequestEuler* request)
     }
     else
     {
-        const ModelExchangeStatesEuler states = request->states();
-        CHECK_SIZE(x);
-        CHECK_SIZE(y);
-        CHECK_SIZE(z);
-        CHECK_SIZE(u);
-        CHECK_SIZE(v);
-        CHECK_SIZE(w);
-        CHECK_SIZE(p);
-        CHECK_SIZE(q);
-        CHECK_SIZE(r);
-        CHECK_SIZE(phi);
-        CHECK_SIZE(theta);
-        CHECK_SIZE(psi);
+        check_states_size(request->states(), msg);
     }
-    if (msg.str().empty())
+    return to_status(msg);
+}
+
+template <typename RequestType> grpc::Status check_states_size_of_all_bodies(const RequestType* request, const size_t nb_of_bodies);
+template <typename RequestType> grpc::Status check_states_size_of_all_bodies(const RequestType* request, const size_t nb_of_bodies)
+{
+    std::stringstream msg;
+    if (!request)
     {
-        return grpc::Status::OK;
+        msg << "'request' is a NULL pointer in " << __PRETTY_FUNCTION__ << ", line " << __LINE__ << ": this is an implementation error in xdyn. You should contact xdyn's support team." << std::endl;
     }
-    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, msg.str());
+    else if ((size_t)request->states_size() != nb_of_bodies)
+    {
+        msg << "Received the states of " << request->states_size() << " bodies, but the YAML model has " << nb_of_bodies << " bodies: this is a problem in the client code (caller of xdyn's gRPC server), not a problem with xdyn. Please send the states of all bodies, in the same order as in the YAML file." << std::endl;
+    }
+    else
+    {
+        for (const auto& states:request->states())
+        {
+            check_states_size(states, msg);
+        }
+    }
+    return to_status(msg);
 }
 
-grpc::Status check_states_size(const ModelExchangeRequestQuaternion* request);
-grpc::Status check_states_size(const ModelExchangeRequestQuaternion* request)
+grpc::Status check_batch(const ModelExchangeRequestQuaternionBatch* request, const size_t nb_of_bodies);
+grpc::Status check_batch(const ModelExchangeRequestQuaternionBatch* request, const size_t nb_of_bodies)
 {
     std::stringstream msg;
     if (!request)
     {
         msg << "'request' is a NULL pointer in " << __PRETTY_FUNCTION__ << ", line " << __LINE__ << ": this is an implementation error in xdyn. You should contact xdyn's support team." << std::endl;
+        return to_status(msg);
     }
-    else
+    if ((request->history_size() != 0) and ((size_t)request->history_size() != nb_of_bodies))
     {
-        const ModelExchangeStatesQuaternion states = request->states();
-        CHECK_SIZE(x);
-        CHECK_SIZE(y);
-        CHECK_SIZE(z);
-        CHECK_SIZE(u);
-        CHECK_SIZE(v);
-        CHECK_SIZE(w);
-        CHECK_SIZE(p);
-        CHECK_SIZE(q);
-        CHECK_SIZE(r);
-        CHECK_SIZE(qr);
-        CHECK_SIZE(qi);
-        CHECK_SIZE(qj);
-        CHECK_SIZE(qk);
+        msg << "The shared history contains " << request->history_size() << " bodies, but the YAML model has " << nb_of_bodies << " bodies: this is a problem in the client code (caller of xdyn's gRPC server), not a problem with xdyn. Please send either no history or the history of all bodies, in the same order as in the YAML file." << std::endl;
+        return to_status(msg);
     }
-    if (msg.str().empty())
+    for (const auto& states:request->history())
     {
-        return grpc::Status::OK;
+        check_states_size(states, msg);
     }
-    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, msg.str());
+    for (int i = 0 ; i < request->samples_size() ; ++i)
+    {
+        const grpc::Status status = check_states_size_of_all_bodies(&request->samples(i), nb_of_bodies);
+        if (not status.ok())
+        {
+            msg << "Sample #" << i << ": " << status.error_message();
+        }
+        for (int j = 0 ; j < request->samples(i).states_size() ; ++j)
+        {
+            const ModelExchangeStatesQuaternion& states = request->samples(i).states(j);
+            if (states.t_size() == 0)
+            {
+                msg << "Sample #" << i << " does not contain any state for body #" << j << ": we need at least one to set the state at which the derivatives are computed." << std::endl;
+            }
+            else if (j < request->history_size())
+            {
+                // The shared history is put before the states of each sample, so it must end before them
+                const ModelExchangeStatesQuaternion& history = request->history(j);
+                if ((history.t_size() != 0) and (history.t(history.t_size()-1) >= states.t(0)))
+                {
+                    msg << "Sample #" << i << " starts at t = " << states.t(0) << " for body #" << j << ", but the shared history of this body ends at t = " << history.t(history.t_size()-1) << ": this is a problem in the client code (caller of xdyn's gRPC server), not a problem with xdyn. The dates of the shared history must be strictly before those of each sample." << std::endl;
+                }
+            }
+        }
+    }
+    return to_status(msg);
 }
 
-YamlSimServerInputs from_grpc(grpc::ServerContext* context, const ModelExchangeRequestEuler* request);
-YamlSimServerInputs from_grpc(grpc::ServerContext* , const ModelExchangeRequestEuler* request)
+YamlSimServerInputs from_grpc(const ModelExchangeStatesEuler& states, const google::protobuf::Map<std::string, double>& commands);
+YamlSimServerInputs from_grpc(const ModelExchangeStatesEuler& states, const google::protobuf::Map<std::string, double>& commands)
 {
     YamlSimServerInputs server_inputs;
     ssc::kinematics::EulerAngles angles;
     YamlRotation rot;
     rot.order_by = "angle";
     rot.convention = {"z", "y'", "x''"};
-    if (request)
+    server_inputs.Dt = 0; // Not used by XdynForME anyway
+    server_inputs.commands = std::map<std::string, double>(commands.begin(), commands.end());
+    const size_t n = states.t_size();
+    server_inputs.states.resize(n);
+    for (size_t i = 0 ; i < n ; ++i)
     {
-
-        server_inputs.Dt = 0; // Not used by XdynForME anyway
-        std::map<std::string, double> commands(request->commands().begin(),
-                request->commands().end());
-        server_inputs.commands = commands;
-        const size_t n = request->states().t_size();
-        server_inputs.states.resize(n);
-        for (size_t i = 0 ; i < n ; ++i)
-        {
-            server_inputs.states[i].x = request->states().x(i);
-            server_inputs.states[i].y = request->states().y(i);
-            server_inputs.states[i].z = request->states().z(i);
-            server_inputs.states[i].u = request->states().u(i);
-            server_inputs.states[i].v = request->states().v(i);
-            server_inputs.states[i].w = request->states().w(i);
-            server_inputs.states[i].p = request->states().p(i);
-            server_inputs.states[i].q = request->states().q(i);
-            server_inputs.states[i].r = request->states().r(i);
-            angles.phi = request->states().phi(i);
-            angles.theta = request->states().theta(i);
-            angles.psi = request->states().psi(i);
-            const auto quaternion = BodyStates::convert(angles, rot);
-            server_inputs.states[i].qr = std::get<0>(quaternion);
-            server_inputs.states[i].qi = std::get<1>(quaternion);
-            server_inputs.states[i].qj = std::get<2>(quaternion);
-            server_inputs.states[i].qk = std::get<3>(quaternion);
-        }
+        server_inputs.states[i].t = states.t(i);
+        server_inputs.states[i].x = states.x(i);
+        server_inputs.states[i].y = states.y(i);
+        server_inputs.states[i].z = states.z(i);
+        server_inputs.states[i].u = states.u(i);
+        server_inputs.states[i].v = states.v(i);
+        server_inputs.states[i].w = states.w(i);
+        server_inputs.states[i].p = states.p(i);
+        server_inputs.states[i].q = states.q(i);
+        server_inputs.states[i].r = states.r(i);
+        angles.phi = states.phi(i);
+        angles.theta = states.theta(i);
+        angles.psi = states.psi(i);
+        const auto quaternion = BodyStates::convert(angles, rot);
+        server_inputs.states[i].qr = std::get<0>(quaternion);
+        server_inputs.states[i].qi = std::get<1>(quaternion);
+        server_inputs.states[i].qj = std::get<2>(quaternion);
+        server_inputs.states[i].qk = std::get<3>(quaternion);
     }
     return server_inputs;
 }
 
-YamlSimServerInputs from_grpc(grpc::ServerContext* context, const ModelExchangeRequestQuaternion* request);
-YamlSimServerInputs from_grpc(grpc::ServerContext* , const ModelExchangeRequestQuaternion* request)
+YamlSimServerInputs from_grpc(const ModelExchangeStatesQuaternion& states, const google::protobuf::Map<std::string, double>& commands);
+YamlSimServerInputs from_grpc(const ModelExchangeStatesQuaternion& states, const google::protobuf::Map<std::string, double>& commands)
 {
     YamlSimServerInputs server_inputs;
-    if (request)
+    server_inputs.Dt = 0; // Not used by XdynForME anyway
+    server_inputs.commands = std::map<std::string, double>(commands.begin(), commands.end());
+    const size_t n = states.t_size();
+    server_inputs.states.resize(n);
+    for (size_t i = 0 ; i < n ; ++i)
     {
+        server_inputs.states[i].t = states.t(i);
+        server_inputs.states[i].x = states.x(i);
+        server_inputs.states[i].y = states.y(i);
+        server_inputs.states[i].z = states.z(i);
+        server_inputs.states[i].u = states.u(i);
+        server_inputs.states[i].v = states.v(i);
+        server_inputs.states[i].w = states.w(i);
+        server_inputs.states[i].p = states.p(i);
+        server_inputs.states[i].q = states.q(i);
+        server_inputs.states[i].r = states.r(i);
+        server_inputs.states[i].qr = states.qr(i);
+        server_inputs.states[i].qi = states.qi(i);
+        server_inputs.states[i].qj = states.qj(i);
+        server_inputs.states[i].qk = states.qk(i);
+    }
+    return server_inputs;
+}
+
+template <typename RequestType> std::vector<SimServerInputs> from_grpc(const RequestType* request, const double max_history_length);
+template <typename RequestType> std::vector<SimServerInputs> from_grpc(const RequestType* request, const double max_history_length)
+{
+    std::vector<SimServerInputs> ret;
+    ret.reserve(request->states_size());
+    for (const auto& states:request->states())
+    {
+        ret.push_back(SimServerInputs(from_grpc(states, request->commands()), max_history_length));
+    }
+    return ret;
+}
 
-        server_inputs.Dt = 0; // Not used by XdynForME anyway
-        std::map<std::string, double> commands(request->commands().begin(),
-                request->commands().end());
-        server_inputs.commands = commands;
-        const size_t n = request->states().t_size();
-        server_inputs.states.resize(n);
-        for (size_t i = 0 ; i < n ; ++i)
+std::vector<std::vector<SimServerInputs> > from_grpc(const ModelExchangeRequestQuaternionBatch* request, const double max_history_length);
+std::vector<std::vector<SimServerInputs> > from_grpc(const ModelExchangeRequestQuaternionBatch* request, const double max_history_length)
+{
+    std::vector<YamlSimServerInputs> history;
+    for (const auto& states:request->history())
+    {
+        history.push_back(from_grpc(states, request->commands()));
+    }
+    std::vector<std::vector<SimServerInputs> > ret;
+    ret.reserve(request->samples_size());
+    for (const auto& sample:request->samples())
+    {
+        std::vector<SimServerInputs> inputs;
+        inputs.reserve(sample.states_size());
+        for (int i = 0 ; i < sample.states_size() ; ++i)
         {
-            server_inputs.states[i].x = request->states().x(i);
-            server_inputs.states[i].y = request->states().y(i);
-            server_inputs.states[i].z = request->states().z(i);
-            server_inputs.states[i].u = request->states().u(i);
-            server_inputs.states[i].v = request->states().v(i);
-            server_inputs.states[i].w = request->states().w(i);
-            server_inputs.states[i].p = request->states().p(i);
-            server_inputs.states[i].q = request->states().q(i);
-            server_inputs.states[i].r = request->states().r(i);
-            server_inputs.states[i].qr = request->states().qr(i);
-            server_inputs.states[i].qi = request->states().qi(i);
-            server_inputs.states[i].qj = request->states().qj(i);
-            server_inputs.states[i].qk = request->states().qk(i);
+            YamlSimServerInputs body_inputs = from_grpc(sample.states(i), request->commands());
+            for (const auto& command:sample.commands())
+            {
+                body_inputs.commands[command.first] = command.second;
+            }
+            if (not(history.empty()))
+            {
+                body_inputs.states.insert(body_inputs.states.begin(), history[i].states.begin(), history[i].states.end());
+            }
+            inputs.push_back(SimServerInputs(body_inputs, max_history_length));
         }
+        ret.push_back(inputs);
     }
-    return server_inputs;
+    return ret;
 }
 
 std::tuple<double, double, double> get_euler_derivative(const StateType& state);
@@ -185,6 +285,30 @@ std::tuple<double, double, double> get_euler_derivative(const StateType& state)
     return std::tuple<double, double, double>(dphi_dt, dtheta_dt, dpsi_dt);
 }
 
+void to_grpc(const StateType& res, const size_t body_idx, const SimServerInputs& inputs, ModelExchangeStateDerivatives* d_dt);
+void to_grpc(const StateType& res, const size_t body_idx, const SimServerInputs& inputs, ModelExchangeStateDerivatives* d_dt)
+{
+    const size_t i = 13*body_idx;
+    d_dt->set_x(res[i+0]);
+    d_dt->set_y(res[i+1]);
+    d_dt->set_z(res[i+2]);
+    d_dt->set_u(res[i+3]);
+    d_dt->set_v(res[i+4]);
+    d_dt->set_w(res[i+5]);
+    d_dt->set_p(res[i+6]);
+    d_dt->set_q(res[i+7]);
+    d_dt->set_r(res[i+8]);
+    d_dt->set_qr(res[i+9]);
+    d_dt->set_qi(res[i+10]);
+    d_dt->set_qj(res[i+11]);
+    d_dt->set_qk(res[i+12]);
+    const std::tuple<double, double, double> deuler_dt = get_euler_derivative(inputs.state_at_t);
+    d_dt->set_phi(std::get<0>(deuler_dt));
+    d_dt->set_theta(std::get<1>(deuler_dt));
+    d_dt->set_psi(std::get<2>(deuler_dt));
+    d_dt->set_t(inputs.t);
+}
+
 grpc::Status to_grpc(grpc::ServerContext* context, const StateType& res, ModelExchangeResponse* response, const SimServerInputs& inputs);
 grpc::Status to_grpc(grpc::ServerContext* , const StateType& res, ModelExchangeResponse* response, const SimServerInputs& inputs)
 {
@@ -193,28 +317,70 @@ grpc::Status to_grpc(grpc::ServerContext* , const StateType& res, ModelExchangeR
         return grpc::Status(grpc::StatusCode::INTERNAL, "We didn't get 13 states back from XdynForME::calculate_dx_dt. This should never happen and is a bug in xdyn's gRPC implementation. Please contact xdyn's support team!");
     }
     ModelExchangeStateDerivatives* d_dt = new ModelExchangeStateDerivatives();
-    d_dt->set_x(res[0]);
-    d_dt->set_y(res[1]);
-    d_dt->set_z(res[2]);
-    d_dt->set_u(res[3]);
-    d_dt->set_v(res[4]);
-    d_dt->set_w(res[5]);
-    d_dt->set_p(res[6]);
-    d_dt->set_q(res[7]);
-    d_dt->set_r(res[8]);
-    d_dt->set_qr(res[9]);
-    d_dt->set_qi(res[10]);
-    d_dt->set_qj(res[11]);
-    d_dt->set_qk(res[12]);
-    const std::tuple<double, double, double> deuler_dt = get_euler_derivative(inputs.state_at_t);
-    d_dt->set_phi(std::get<0>(deuler_dt));
-    d_dt->set_theta(std::get<1>(deuler_dt));
-    d_dt->set_psi(std::get<2>(deuler_dt));
-    d_dt->set_t(inputs.t);
+    to_grpc(res, 0, inputs, d_dt);
     response->set_allocated_d_dt(d_dt);
     return grpc::Status::OK;
 }
 
+grpc::Status to_grpc(grpc::ServerContext* context, const StateType& res, ModelExchangeResponseAllBodies* response, const std::vector<SimServerInputs>& inputs);
+grpc::Status to_grpc(grpc::ServerContext* , const StateType& res, ModelExchangeResponseAllBodies* response, const std::vector<SimServerInputs>& inputs)
+{
+    if (res.size() != 13*inputs.size())
+    {
+        return grpc::Status(grpc::StatusCode::INTERNAL, "We didn't get 13 states per body back from XdynForME::calculate_dx_dt. This should never happen and is a bug in xdyn's gRPC implementation. Please contact xdyn's support team!");
+    }
+    for (size_t i = 0 ; i < inputs.size() ; ++i)
+    {
+        to_grpc(res, i, inputs[i], response->add_d_dt());
+    }
+    return grpc::Status::OK;
+}
+
+grpc::Status calculate_dx_dt(XdynForMEBatch& batch, const std::vector<std::vector<SimServerInputs> >& samples, std::vector<StateType>& dx_dt);
+grpc::Status calculate_dx_dt(XdynForMEBatch& batch, const std::vector<std::vector<SimServerInputs> >& samples, std::vector<StateType>& dx_dt)
+{
+    try
+    {
+        dx_dt = batch.calculate_dx_dt(samples);
+    }
+    catch (const InvalidInputException& e)
+    {
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, e.get_message());
+    }
+    return grpc::Status::OK;
+}
+
+grpc::Status calculate_dx_dt(XdynForMEBatch& batch, const std::vector<SimServerInputs>& inputs, StateType& dx_dt);
+grpc::Status calculate_dx_dt(XdynForMEBatch& batch, const std::vector<SimServerInputs>& inputs, StateType& dx_dt)
+{
+    // A batch of a single sample is evaluated by the first XdynForME of the batch, in the calling thread
+    std::vector<StateType> ret;
+    const grpc::Status status = calculate_dx_dt(batch, std::vector<std::vector<SimServerInputs> >(1, inputs), ret);
+    if (status.ok())
+    {
+        dx_dt = ret.front();
+    }
+    return status;
+}
+
+grpc::Status to_grpc(grpc::ServerContext* context, const std::vector<StateType>& res, ModelExchangeResponseBatch* response, const std::vector<std::vector<SimServerInputs> >& inputs);
+grpc::Status to_grpc(grpc::ServerContext* context, const std::vector<StateType>& res, ModelExchangeResponseBatch* response, const std::vector<std::vector<SimServerInputs> >& inputs)
+{
+    if (res.size() != inputs.size())
+    {
+        return grpc::Status(grpc::StatusCode::INTERNAL, "We didn't get one result per sample back from XdynForMEBatch::calculate_dx_dt. This should never happen and is a bug in xdyn's gRPC implementation. Please contact xdyn's support team!");
+    }
+    for (size_t i = 0 ; i < res.size() ; ++i)
+    {
+        const grpc::Status status = to_grpc(context, res[i], response->add_samples(), inputs[i]);
+        if (not status.ok())
+        {
+            return status;
+        }
+    }
+    return grpc::Status::OK;
+}
+
 grpc::Status ModelExchangeServiceImpl::dx_dt_euler_321(
         grpc::ServerContext* context,
         const ModelExchangeRequestEuler* request,
@@ -225,8 +391,13 @@ grpc::Status ModelExchangeServiceImpl::dx_dt_euler_321(
     {
         return precond;
     }
-    const SimServerInputs inputs(from_grpc(context, request), xdyn.get_Tmax());
-    const StateType output = xdyn.calculate_dx_dt(inputs);
+    const SimServerInputs inputs(from_grpc(request->states(), request->commands()), batch.get_Tmax());
+    StateType output;
+    const grpc::Status status = calculate_dx_dt(batch, std::vector<SimServerInputs>(1, inputs), output);
+    if (not status.ok())
+    {
+        return status;
+    }
     const grpc::Status postcond = to_grpc(context, output, response, inputs);
     return postcond;
 }
@@ -241,13 +412,78 @@ grpc::Status ModelExchangeServiceImpl::dx_dt_quaternion(
     {
         return precond;
     }
-    const YamlSimServerInputs inputs = from_grpc(context, request);
-    if (inputs.states.empty())
+    const YamlSimServerInputs yaml_inputs = from_grpc(request->states(), request->commands());
+    if (yaml_inputs.states.empty())
     {
         return grpc::Status(grpc::StatusCode::INTERNAL, "We didn't get any states as input (inputs.states is empty): we need at least one to set the initial conditions. This error was detected in ModelExchangeServiceImpl::dx_dt_quaternion");
     }
-    const double t = inputs.states.back().t;
-    const StateType output = xdyn.calculate_dx_dt(SimServerInputs(inputs, xdyn.get_Tmax()));
-    const grpc::Status postcond = to_grpc(context, output, response, t);
+    const SimServerInputs inputs(yaml_inputs, batch.get_Tmax());
+    StateType output;
+    const grpc::Status status = calculate_dx_dt(batch, std::vector<SimServerInputs>(1, inputs), output);
+    if (not status.ok())
+    {
+        return status;
+    }
+    const grpc::Status postcond = to_grpc(context, output, response, inputs);
     return postcond;
 }
+
+grpc::Status ModelExchangeServiceImpl::dx_dt_euler_321_all_bodies(
+        grpc::ServerContext* context,
+        const ModelExchangeRequestEulerAllBodies* request,
+        ModelExchangeResponseAllBodies* response)
+{
+    const grpc::Status precond = check_states_size_of_all_bodies(request, batch.get_nb_of_bodies());
+    if (not precond.ok())
+    {
+        return precond;
+    }
+    const std::vector<SimServerInputs> inputs = from_grpc(request, batch.get_Tmax());
+    StateType output;
+    const grpc::Status status = calculate_dx_dt(batch, inputs, output);
+    if (not status.ok())
+    {
+        return status;
+    }
+    return to_grpc(context, output, response, inputs);
+}
+
+grpc::Status ModelExchangeServiceImpl::dx_dt_quaternion_all_bodies(
+        grpc::ServerContext* context,
+        const ModelExchangeRequestQuaternionAllBodies* request,
+        ModelExchangeResponseAllBodies* response)
+{
+    const grpc::Status precond = check_states_size_of_all_bodies(request, batch.get_nb_of_bodies());
+    if (not precond.ok())
+    {
+        return precond;
+    }
+    const std::vector<SimServerInputs> inputs = from_grpc(request, batch.get_Tmax());
+    StateType output;
+    const grpc::Status status = calculate_dx_dt(batch, inputs, output);
+    if (not status.ok())
+    {
+        return status;
+    }
+    return to_grpc(context, output, response, inputs);
+}
+
+grpc::Status ModelExchangeServiceImpl::dx_dt_quaternion_batch(
+        grpc::ServerContext* context,
+        const ModelExchangeRequestQuaternionBatch* request,
+        ModelExchangeResponseBatch* response)
+{
+    const grpc::Status precond = check_batch(request, batch.get_nb_of_bodies());
+    if (not precond.ok())
+    {
+        return precond;
+    }
+    const std::vector<std::vector<SimServerInputs> > inputs = from_grpc(request, batch.get_Tmax());
+    std::vector<StateType> output;
+    const grpc::Status status = calculate_dx_dt(batch, inputs, output);
+    if (not status.ok())
+    {
+        return status;
+    }
+    return to_grpc(context, output, response, inputs);
+}
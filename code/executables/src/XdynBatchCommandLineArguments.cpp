@@ -0,0 +1,28 @@
+/*
+ * XdynBatchCommandLineArguments.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include "XdynBatchCommandLineArguments.hpp"
+
+XdynBatchCommandLineArguments::XdynBatchCommandLineArguments() : case_filenames(),
+                         common_filenames(),
+                         solver(),
+                         output_format(),
+                         initial_timestep(0),
+                         tstart(0),
+                         tend(0),
+                         absolute_tolerance(1E-6),
+                         relative_tolerance(1E-6),
+                         nb_of_threads(0),
+                         catch_exceptions(false)
+{
+}
+
+bool XdynBatchCommandLineArguments::empty() const
+{
+    return case_filenames.empty() and common_filenames.empty() and output_format.empty()
+            and (initial_timestep == 0) and (tstart == 0) and (tend == 0);
+}
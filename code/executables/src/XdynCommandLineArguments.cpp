@@ -14,6 +14,8 @@ XdynCommandLineArguments::XdynCommandLineArguments() : yaml_filenames(),
                          initial_timestep(0),
                          tstart(0),
                          tend(0),
+                         absolute_tolerance(1E-6),
+                         relative_tolerance(1E-6),
                          catch_exceptions(false)
 {
 }
@@ -13,7 +13,8 @@ XdynForMECommandLineArguments::XdynForMECommandLineArguments() : yaml_filenames(
                          verbose(false),
                          show_help(false),
                          show_websocket_debug_information(false),
-                         grpc(false)
+                         grpc(false),
+                         nb_of_threads(0)
 {
 }
 
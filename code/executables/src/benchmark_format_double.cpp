@@ -0,0 +1,51 @@
+/*
+ * benchmark_format_double.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+// Compares the time taken to format doubles with append_double (used by the text observers)
+// & with std::ostream (former formatting of CsvObserver). Only prints the timings: the
+// result depends on the machine & its load, so it is not checked.
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ssc/random_data_generator.hpp>
+
+#include "format_double.hpp"
+
+int main(int , char** )
+{
+    ssc::random_data_generator::DataGenerator a(12321);
+    std::vector<double> values(1000000);
+    for (auto& val:values) val = a.random<double>().between(-1000, 1000);
+    const auto start = std::chrono::steady_clock::now();
+    std::ostringstream os;
+    os << std::scientific; // 6 digits, not read back exactly
+    for (const auto val:values) os << val << ',';
+    const auto middle = std::chrono::steady_clock::now();
+    std::string text;
+    size_t size = 0;
+    for (const auto val:values)
+    {
+        append_double(text, val);
+        text += ',';
+        if (text.size() > 4096)
+        {
+            size += text.size();
+            text.clear();
+        }
+    }
+    size += text.size();
+    const auto end = std::chrono::steady_clock::now();
+    const double iostream_in_ms = std::chrono::duration<double, std::milli>(middle - start).count();
+    const double format_double_in_ms = std::chrono::duration<double, std::milli>(end - middle).count();
+    std::cout << "Formatting " << values.size() << " doubles: " << iostream_in_ms << " ms with std::ostream << std::scientific ("
+              << os.str().size() << " characters), " << format_double_in_ms << " ms with append_double (" << size << " characters)" << std::endl;
+    return 0;
+}
@@ -0,0 +1,93 @@
+/*
+ * parse_XdynBatchCommandLineArguments.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <iostream>
+#include <cstdlib> // EXIT_FAILURE, EXIT_SUCCESS
+
+#include "display_command_line_arguments.hpp"
+#include "parse_XdynBatchCommandLineArguments.hpp"
+#include "XdynBatchCommandLineArguments.hpp"
+
+#define DESCRIPTION "This is a ship simulator (batch version: runs several simulations in parallel)"
+
+bool invalid(const XdynBatchCommandLineArguments& input)
+{
+    if (input.empty()) return true;
+    if (input.case_filenames.empty())
+    {
+        std::cerr << "Error: no case defined: need at least one YAML file." << std::endl;
+        return true;
+    }
+    if (input.solver.empty())
+    {
+        std::cerr << "Error: no solver defined." << std::endl;
+        return true;
+    }
+    if (input.initial_timestep<=0)
+    {
+        std::cerr << "Error: initial time step is negative or zero." << std::endl;
+        return true;
+    }
+    if ((input.absolute_tolerance<=0) or (input.relative_tolerance<=0))
+    {
+        std::cerr << "Error: the tolerances of the adaptive solver should be strictly positive." << std::endl;
+        return true;
+    }
+    if (not(input.output_format.empty()) and (input.output_format != "csv") and (input.output_format != "tsv")
+            and (input.output_format != "json") and (input.output_format != "h5") and (input.output_format != "hdf5")
+            and (input.output_format != "bin"))
+    {
+        std::cerr << "Error: unknown output format '" << input.output_format << "': should be one of csv, tsv, json, h5, hdf5 or bin." << std::endl;
+        return true;
+    }
+    return false;
+}
+
+po::options_description get_options_description(XdynBatchCommandLineArguments& input_data)
+{
+    po::options_description desc("Options");
+    desc.add_options()
+        ("help,h",                                                                            "Show this help message")
+        ("yml,y",      po::value<std::vector<std::string> >(&input_data.case_filenames),      "Name(s) of the YAML file(s) describing each case: one simulation is run per file")
+        ("common,c",   po::value<std::vector<std::string> >(&input_data.common_filenames),    "Name(s) of the YAML file(s) shared by all cases (eg. bodies & environment), prepended to each case")
+        ("solver,s",   po::value<std::string>(&input_data.solver)->default_value("rk4"),      "Name of the solver: euler, rk4, rkck for Euler, Runge-Kutta 4 & Runge-Kutta-Cash-Karp respectively. rkck is an adaptive step solver.")
+        ("dt",         po::value<double>(&input_data.initial_timestep),                       "Initial time step (or value of the fixed time step for fixed step solvers). Outputs are always written every dt.")
+        ("atol",       po::value<double>(&input_data.absolute_tolerance)->default_value(1E-6), "Absolute tolerance of the adaptive step solver (rkck)")
+        ("rtol",       po::value<double>(&input_data.relative_tolerance)->default_value(1E-6), "Relative tolerance of the adaptive step solver (rkck)")
+        ("tstart",     po::value<double>(&input_data.tstart)->default_value(0),               "Date corresponding to the beginning of the simulation (in seconds)")
+        ("tend",       po::value<double>(&input_data.tend),                                   "Last time step")
+        ("output,o",   po::value<std::string>(&input_data.output_format),                     "If set, each case writes all its states to a file named after the case, with this extension.\nPossible values are csv, tsv, json, hdf5, h5, bin")
+        ("threads,j",  po::value<size_t>(&input_data.nb_of_threads)->default_value(0),        "Number of simulations run simultaneously (0 for one per hardware thread)")
+        ("debug,d",                                                                           "Used by the application's support team to help error diagnosis. Allows us to pinpoint the exact location in code where the error occurred (do not catch exceptions), eg. for use in a debugger.")
+    ;
+    return desc;
+}
+
+int parse_command_line_for_xdyn_batch(int argc, char **argv, XdynBatchCommandLineArguments& input_data)
+{
+    const po::options_description desc = get_options_description(input_data);
+    const BooleanArguments has = parse_input(argc, argv, desc);
+    input_data.catch_exceptions = not(has.debug);
+    if (has.help)
+    {
+        print_usage(std::cout, desc, argv[0], DESCRIPTION);
+        return EXIT_SUCCESS;
+    }
+    else if (invalid(input_data))
+    {
+        print_usage(std::cout, desc, argv[0], DESCRIPTION);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+int fill_input_or_display_help(char *argv, XdynBatchCommandLineArguments& input_data)
+{
+    const po::options_description desc = get_options_description(input_data);
+    print_usage(std::cout, desc, argv, DESCRIPTION);
+    return EXIT_SUCCESS;
+}
@@ -33,6 +33,11 @@ bool invalid(const XdynCommandLineArguments& input)
         std::cerr << "Error: initial time step is negative or zero." << std::endl;
         return true;
     }
+    if ((input.absolute_tolerance<=0) or (input.relative_tolerance<=0))
+    {
+        std::cerr << "Error: the tolerances of the adaptive solver should be strictly positive." << std::endl;
+        return true;
+    }
     return false;
 }
 
@@ -42,11 +47,13 @@ po::options_description attach_command_line_arguments_to_options_description(Xdy
     desc.add_options()
         ("help,h",                                                                       "Show this help message")
         ("yml,y",      po::value<std::vector<std::string> >(&input_data.yaml_filenames), "Name(s) of the YAML file(s)")
-        ("solver,s",   po::value<std::string>(&input_data.solver)->default_value("rk4"), "Name of the solver: euler, rk4, rkck for Euler, Runge-Kutta 4 & Runge-Kutta-Cash-Karp respectively.")
-        ("dt",         po::value<double>(&input_data.initial_timestep),                  "Initial time step (or value of the fixed time step for fixed step solvers)")
+        ("solver,s",   po::value<std::string>(&input_data.solver)->default_value("rk4"), "Name of the solver: euler, rk4, rkck for Euler, Runge-Kutta 4 & Runge-Kutta-Cash-Karp respectively. rkck is an adaptive step solver.")
+        ("dt",         po::value<double>(&input_data.initial_timestep),                  "Initial time step (or value of the fixed time step for fixed step solvers). Outputs are always written every dt.")
+        ("atol",       po::value<double>(&input_data.absolute_tolerance)->default_value(1E-6), "Absolute tolerance of the adaptive step solver (rkck)")
+        ("rtol",       po::value<double>(&input_data.relative_tolerance)->default_value(1E-6), "Relative tolerance of the adaptive step solver (rkck)")
         ("tstart",     po::value<double>(&input_data.tstart)->default_value(0),          "Date corresponding to the beginning of the simulation (in seconds)")
         ("tend",       po::value<double>(&input_data.tend),                              "Last time step")
-        ("output,o",   po::value<std::string>(&input_data.output_filename),              "Name of the output file where all computed data will be exported.\nPossible values/extensions are csv, tsv, json, hdf5, h5, ws")
+        ("output,o",   po::value<std::string>(&input_data.output_filename),              "Name of the output file where all computed data will be exported.\nPossible values/extensions are csv, tsv, json, hdf5, h5, bin, ws")
         ("waves,w",    po::value<std::string>(&input_data.wave_output),                  "Name of the output file where the wave heights will be stored ('output' section of the YAML file). In case output is made to a HDF5 file or web sockets, this option appends the wave height to the main output")
         ("debug,d",                                                                      "Used by the application's support team to help error diagnosis. Allows us to pinpoint the exact location in code where the error occurred (do not catch exceptions), eg. for use in a debugger.")
     ;
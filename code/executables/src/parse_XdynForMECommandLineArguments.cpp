@@ -48,6 +48,7 @@ po::options_description get_options_description(XdynForMECommandLineArguments& i
         ("port,p",     po::value<short unsigned int>(&input_data.port),                  "port for the websocket server. Available values are 1024-65535 (2^16, but port 0 is reserved and unavailable and ports in range 1-1023 are privileged (application needs to be run as root to have access to those ports)")
         ("debug,d",                                                                      "Used by the application's support team to help error diagnosis. Allows us to pinpoint the exact location in code where the error occurred (do not catch exceptions), eg. for use in a debugger.")
         ("grpc,g",                                                                       "Launch a gRPC server instead of the (default) JSON+websocket server.")
+        ("threads,j",  po::value<size_t>(&input_data.nb_of_threads)->default_value(0),   "Maximum number of samples evaluated simultaneously by the gRPC method dx_dt_quaternion_batch (0 for one per hardware thread)")
     ;
     return desc;
 }
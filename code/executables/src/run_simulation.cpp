@@ -0,0 +1,127 @@
+/*
+ * run_simulation.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <ssc/solver.hpp>
+
+#include "build_observers_description.hpp"
+#include "h5_tools.hpp"
+#include "run_simulation.hpp"
+#include "simulator_api.hpp"
+#include "stl_io_hdf5.hpp"
+#include "SurfaceElevationInterface.hpp"
+#include "XdynCommandLineArguments.hpp"
+
+void solve(const XdynCommandLineArguments& input_data, Sim& sys, ListOfObservers& observer)
+{
+    if (input_data.solver=="euler")
+    {
+        ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, input_data.tstart, input_data.tend, input_data.initial_timestep, observer);
+    }
+    else if (input_data.solver=="rk4")
+    {
+        ssc::solver::quicksolve<ssc::solver::RK4Stepper>(sys, input_data.tstart, input_data.tend, input_data.initial_timestep, observer);
+    }
+    else if (input_data.solver=="rkck")
+    {
+        AdaptiveRKCK::Parameters parameters;
+        parameters.absolute_tolerance = input_data.absolute_tolerance;
+        parameters.relative_tolerance = input_data.relative_tolerance;
+        ForceStates force_states = [&sys](std::vector<double>&states, const double t){sys.force_states(states, t);};
+        adaptive_quicksolve(sys, input_data.tstart, input_data.tend, input_data.initial_timestep, observer, force_states, parameters);
+    }
+    else
+    {
+        ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, input_data.tstart, input_data.tend, input_data.initial_timestep, observer);
+    }
+}
+
+void serialize_context_if_necessary_new(ListOfObservers& observers, const Sim& sys);
+void serialize_context_if_necessary_new(ListOfObservers& observers, const Sim& sys)
+{
+    const auto env = sys.get_env();
+    const auto w = env.w;
+    if (w)
+    {
+        for (auto observer:observers.get())
+        {
+            w->serialize_wave_spectra_before_simulation(observer);
+        }
+    }
+}
+
+void serialize_context_if_necessary(std::vector<YamlOutput>& observers, const Sim& sys, const std::string& yaml_input, const std::string& prog_command);
+void serialize_context_if_necessary(std::vector<YamlOutput>& observers, const Sim& sys, const std::string& yaml_input, const std::string& prog_command)
+{
+    for (const auto observer:observers)
+    {
+        if(observer.format=="hdf5")
+        {
+            if (not(prog_command.empty()))
+            {
+                H5_Tools::write(observer.filename, "/inputs/command", prog_command);
+            }
+            if (not(yaml_input.empty()))
+            {
+                H5_Tools::write(observer.filename, "/inputs/yaml/input", yaml_input);
+            }
+
+            for (const auto& bodies : sys.get_bodies())
+            {
+                const auto& states = bodies->get_states();
+                const auto& name = states.name;
+                const auto& mesh = states.mesh;
+                if (mesh->nb_of_static_nodes>0)
+                {
+                    writeMeshToHdf5File(observer.filename,
+                                        "/inputs/meshes/"+name,
+                                        mesh->nodes,
+                                        mesh->facets);
+                }
+            }
+        }
+    }
+}
+
+std::string input_data_serialize(const XdynCommandLineArguments& inputData)
+{
+    std::stringstream s;
+    s << "xdyn ";
+    if (not inputData.yaml_filenames.empty()) s << "-y ";
+    for (const auto& f:inputData.yaml_filenames)
+    {
+        s << f << " ";
+    }
+    s << " --tstart " << inputData.tstart<<" ";
+    s << " --tend " << inputData.tend<<" ";
+    s << " --dt " << inputData.initial_timestep<<" ";
+    s << " --solver "<<inputData.solver;
+    if (inputData.solver=="rkck")
+    {
+        s << " --atol " << inputData.absolute_tolerance << " --rtol " << inputData.relative_tolerance;
+    }
+    if (not(inputData.output_filename.empty()))
+    {
+        s << " -o " << inputData.output_filename;
+    }
+    if (not(inputData.wave_output.empty()))
+    {
+        s << " -w " << inputData.wave_output;
+    }
+    return s.str();
+}
+
+void simulate(const XdynCommandLineArguments& input_data, const std::string& yaml_input)
+{
+    auto sys = get_system(yaml_input, input_data.tstart);
+    auto observers_description = build_observers_description(yaml_input, input_data);
+    const bool write_asynchronously = true;
+    ListOfObservers observers(observers_description, write_asynchronously);
+    serialize_context_if_necessary(observers_description, sys, yaml_input, input_data_serialize(input_data));
+    serialize_context_if_necessary_new(observers, sys);
+    solve(input_data, sys, observers);
+    observers.flush();
+}
@@ -0,0 +1,204 @@
+/*
+ * xdyn_batch.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <atomic>
+#include <cstdlib> // EXIT_FAILURE, EXIT_SUCCESS
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <google/protobuf/stubs/common.h>
+
+#include <ssc/check_ssc_version.hpp>
+#include <ssc/text_file_reader.hpp>
+
+#include "build_observers_description.hpp"
+#include "InputCache.hpp"
+#include "InvalidInputException.hpp"
+#include "parse_XdynBatchCommandLineArguments.hpp"
+#include "report_xdyn_exceptions_to_user.hpp"
+#include "run_simulation.hpp"
+#include "ThreadPool.hpp"
+#include "XdynBatchCommandLineArguments.hpp"
+#include "XdynCommandLineArguments.hpp"
+
+CHECK_SSC_VERSION(8,0)
+
+/** \brief Everything a worker thread needs to run one simulation (nothing is shared between cases
+ *         except what is in the InputCache)
+ */
+struct Case
+{
+    Case() : name(), yaml(), input_data()
+    {
+    }
+    std::string name;                   //!< Name of the case's YAML file (used in error messages)
+    std::string yaml;                   //!< Common YAML files + case file
+    XdynCommandLineArguments input_data; //!< Same as if the case was run by xdyn
+};
+
+std::string output_filename(const std::string& case_filename, const std::string& output_format);
+std::string output_filename(const std::string& case_filename, const std::string& output_format)
+{
+    const size_t last_dot = case_filename.find_last_of('.');
+    const size_t last_slash = case_filename.find_last_of("/\\");
+    const bool has_extension = (last_dot != std::string::npos) and ((last_slash == std::string::npos) or (last_dot > last_slash));
+    return (has_extension ? case_filename.substr(0, last_dot) : case_filename) + "." + output_format;
+}
+
+Case build_case(const XdynBatchCommandLineArguments& input, const std::string& case_filename);
+Case build_case(const XdynBatchCommandLineArguments& input, const std::string& case_filename)
+{
+    Case ret;
+    ret.name = case_filename;
+    ret.input_data.yaml_filenames = input.common_filenames;
+    ret.input_data.yaml_filenames.push_back(case_filename);
+    ret.input_data.solver = input.solver;
+    ret.input_data.initial_timestep = input.initial_timestep;
+    ret.input_data.tstart = input.tstart;
+    ret.input_data.tend = input.tend;
+    ret.input_data.absolute_tolerance = input.absolute_tolerance;
+    ret.input_data.relative_tolerance = input.relative_tolerance;
+    ret.input_data.catch_exceptions = input.catch_exceptions;
+    if (not(input.output_format.empty()))
+    {
+        ret.input_data.output_filename = output_filename(case_filename, input.output_format);
+    }
+    ret.yaml = ssc::text_file_reader::TextFileReader(ret.input_data.yaml_filenames).get_contents();
+    return ret;
+}
+
+/** \brief Checks that the cases can run simultaneously (before any simulation starts)
+ *  \details Each case should write to its own files & HDF5 outputs can only be used with a single
+ *           thread (the HDF5 library is usually not built in thread-safe mode).
+ */
+void check_outputs(const std::vector<Case>& cases, const size_t nb_of_threads);
+void check_outputs(const std::vector<Case>& cases, const size_t nb_of_threads)
+{
+    std::set<std::string> filenames;
+    for (const auto& c:cases)
+    {
+        for (const auto& output:build_observers_description(c.yaml, c.input_data))
+        {
+            if (output.format == "ws") continue;
+            if (((output.format == "hdf5") or (output.format == "h5")) and (nb_of_threads > 1))
+            {
+                THROW(__PRETTY_FUNCTION__, InvalidInputException, "Case '" << c.name << "' writes to HDF5 file '" << output.filename
+                        << "' but the HDF5 library cannot be used by several threads simultaneously: use another output format or run the cases with '-j 1'.");
+            }
+            if (output.filename.empty() and (cases.size() > 1))
+            {
+                THROW(__PRETTY_FUNCTION__, InvalidInputException, "Case '" << c.name << "' writes " << output.format
+                        << " to the standard output: outputs of all cases would be mixed. Please specify an output filename in the 'output' section of the YAML file or use the -o flag.");
+            }
+            if (not(output.filename.empty()) and not(filenames.insert(output.filename).second))
+            {
+                THROW(__PRETTY_FUNCTION__, InvalidInputException, "Output file '" << output.filename << "' is written by several cases (last one is '" << c.name << "'): each case should have its own output files.");
+            }
+        }
+    }
+}
+
+size_t get_nb_of_threads(const XdynBatchCommandLineArguments& input);
+size_t get_nb_of_threads(const XdynBatchCommandLineArguments& input)
+{
+    size_t n = input.nb_of_threads;
+    if (n == 0) n = std::thread::hardware_concurrency();
+    if (n == 0) n = 1;
+    return std::min(n, input.case_filenames.size());
+}
+
+/** \brief Runs all cases on nb_of_threads threads
+ *  \details Cases are handed out one at a time (shared atomic index) so a thread that finishes a short
+ *           case immediately picks the next one: no need for work stealing since each task is a complete simulation.
+ *  \returns Number of cases that failed
+ */
+size_t run_cases(const std::vector<Case>& cases, const size_t nb_of_threads, const bool catch_exceptions);
+size_t run_cases(const std::vector<Case>& cases, const size_t nb_of_threads, const bool catch_exceptions)
+{
+    std::atomic<size_t> next_case(0);
+    std::atomic<size_t> nb_of_failures(0);
+    std::mutex output_mutex;
+    const auto worker = [&cases, &next_case, &nb_of_failures, &output_mutex, catch_exceptions]()
+    {
+        for (size_t i = next_case++ ; i < cases.size() ; i = next_case++)
+        {
+            const Case& c = cases[i];
+            const auto f = [&c](){simulate(c.input_data, c.yaml);};
+            const auto report_error = [&c, &nb_of_failures, &output_mutex](const std::string& s)
+            {
+                nb_of_failures++;
+                std::lock_guard<std::mutex> lock(output_mutex);
+                std::cerr << "Case '" << c.name << "' failed:" << std::endl << s << std::endl;
+            };
+            if (catch_exceptions) report_xdyn_exceptions_to_user(f, report_error);
+            else                  f();
+        }
+    };
+    std::vector<std::thread> threads;
+    for (size_t i = 0 ; i < nb_of_threads ; ++i)
+    {
+        threads.push_back(std::thread(worker));
+    }
+    for (auto& thread:threads)
+    {
+        thread.join();
+    }
+    return nb_of_failures;
+}
+
+int run(const XdynBatchCommandLineArguments& input);
+int run(const XdynBatchCommandLineArguments& input)
+{
+    if (input.case_filenames.empty()) return EXIT_SUCCESS;
+    const size_t nb_of_threads = get_nb_of_threads(input);
+    std::vector<Case> cases;
+    bool valid = true;
+    const auto prepare = [&input, &cases, nb_of_threads]()
+    {
+        for (const auto& case_filename:input.case_filenames) cases.push_back(build_case(input, case_filename));
+        check_outputs(cases, nb_of_threads);
+    };
+    if (input.catch_exceptions) report_xdyn_exceptions_to_user(prepare, [&valid](const std::string& s){valid = false; std::cerr << s;});
+    else                        prepare();
+    if (not(valid)) return EXIT_FAILURE;
+    // Parsed HDB & STL files & retardation functions are shared by all cases
+    InputCache::enable();
+    // Cases already keep all cores busy: facet loops are not parallelized on top of that
+    if (nb_of_threads > 1) ThreadPool::set_nb_of_threads(1);
+    const size_t nb_of_failures = run_cases(cases, nb_of_threads, input.catch_exceptions);
+    InputCache::disable();
+    if (nb_of_failures)
+    {
+        std::cerr << nb_of_failures << " case(s) out of " << cases.size() << " failed." << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char** argv)
+{
+    XdynBatchCommandLineArguments input_data;
+    int error = 0;
+    try
+    {
+        if (argc==1) return fill_input_or_display_help(argv[0], input_data);
+        error = parse_command_line_for_xdyn_batch(argc, argv, input_data);
+    }
+    catch(boost::program_options::error& e)
+    {
+      std::cerr << "The command line you supplied is not valid: " << e.what() << std::endl << "Use --help to get the list of available parameters." << std::endl;
+      return -1;
+    }
+    if (error)
+    {
+        return error;
+    }
+    const auto ret = run(input_data);
+    google::protobuf::ShutdownProtobufLibrary();
+    return ret;
+}
@@ -125,8 +125,7 @@ void start_grpc_server(const XdynForMECommandLineArguments& input_data)
     const std::string server_address = ss.str();
     const ssc::text_file_reader::TextFileReader yaml_reader(input_data.yaml_filenames);
     const auto yaml = yaml_reader.get_contents();
-    XdynForME xdyn(yaml);
-    ModelExchangeServiceImpl service(xdyn);
+    ModelExchangeServiceImpl service(yaml, input_data.nb_of_threads);
     grpc::ServerBuilder builder;
     builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
     builder.RegisterService(&service);
@@ -16,7 +16,8 @@
        << "    x: {value: 0.696, unit: m}\n"
        << "    y: {value: 0, unit: m}\n"
        << "    z: {value: 1.418, unit: m}\n"
-       << "mirror for 180 to 360: true\n";
+       << "mirror for 180 to 360: true\n"
+       << "heading tolerance for RAO cache: {value: 1, unit: deg}\n"; // Optional
  */
 struct YamlDiffraction
 {
@@ -24,6 +25,7 @@ struct YamlDiffraction
     std::string     hdb_filename;
     YamlCoordinates calculation_point;
     bool            mirror;
+    double          heading_tolerance_for_rao_cache; //!< Width of the heading bins of the RAO cache (in radians). 0 if the RAO are interpolated at each time step.
 };
 
 #endif /* YAMLDIFFRACTION_HPP_ */
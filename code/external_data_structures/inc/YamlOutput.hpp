@@ -19,6 +19,10 @@ struct YamlOutput
     std::string address;
     short unsigned int port;
     std::vector<std::string> data;
+    std::string compression; //!< HDF5 only: "none" (default) or "deflate" (shuffle + deflate filters)
+    std::string layout;      //!< HDF5 only: "columns" (default: one dataset per variable) or "table" (all scalars in one 2D dataset)
+    std::string waves_precision; //!< HDF5 only: "double" (default) or "float" (wave elevations stored as 32-bit floats)
+    size_t waves_decimation;     //!< HDF5 only: only one wave field out of 'waves_decimation' is written (default: 1)
 };
 
 #endif /* YAMLOUTPUT_HPP_ */
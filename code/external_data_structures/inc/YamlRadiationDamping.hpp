@@ -10,7 +10,7 @@
 
 #include <string>
 
-enum class TypeOfQuadrature {RECTANGLE, TRAPEZOIDAL, SIMPSON, GAUSS_KRONROD, BURCHER, CLENSHAW_CURTIS, FILON};
+enum class TypeOfQuadrature {RECTANGLE, TRAPEZOIDAL, SIMPSON, GAUSS_KRONROD, BURCHER, CLENSHAW_CURTIS, FILON, PRONY, RETARDATION_GRID};
 
 #include "YamlCoordinates.hpp"
 
@@ -21,6 +21,7 @@ struct YamlRadiationDamping
     TypeOfQuadrature    type_of_quadrature_for_cos_transform;                 //!< What integration algorithm to use to compute retardation functions?
     TypeOfQuadrature    type_of_quadrature_for_convolution;                   //!< What integration algorithm to use to compute the radiation forces (convolution)?
     size_t              nb_of_points_for_retardation_function_discretization; //!< How many points to use to compute the spline interpolating the retardation functions?
+    size_t              nb_of_exponentials_for_prony;                         //!< How many exponentials to use to approximate each retardation function (only used if the convolution type is 'prony')
     double              omega_min;                                            //!< Lower bound of the cosine integral used to calculate the retardation functions from the radiation dampings
     double              omega_max;                                            //!< Upper bound of the cosine integral used to calculate the retardation functions from the radiation dampings
     double              tau_min;                                              //!< Lower bound of the convolution integral, to calculate Fr
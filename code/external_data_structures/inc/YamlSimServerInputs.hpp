@@ -9,6 +9,7 @@ struct YamlSimServerInputs
     double Dt;
     std::vector<YamlState> states;
     std::map<std::string, double> commands;
+    bool incremental; //!< If true, 'states' only holds the samples since the previous request (the server keeps the history)
 };
 
 
@@ -19,6 +19,7 @@ struct YamlDiscretization
     double omega_min;       //!< First angular frequency (in rad/s)
     double omega_max;       //!< Last angular frequency (in rad/s)
     double energy_fraction; //!< Between 0 and 1: sum(S(omega[i]).S(psi[j]),taken into account)/sum(S(omega[i]).S(psi[j]),total)
+    bool periodic;          //!< If true, the wave vectors are moved to the FFT grid of the output mesh (cf. WaveModel::put_on_regular_grid)
 };
 
 struct YamlStretching
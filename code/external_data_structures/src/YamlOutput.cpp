@@ -7,6 +7,6 @@
 
 #include "YamlOutput.hpp"
 
-YamlOutput::YamlOutput() : filename(), format(), address(), port(), data()
+YamlOutput::YamlOutput() : filename(), format(), address(), port(), data(), compression("none"), layout("columns"), waves_precision("double"), waves_decimation(1)
 {
 }
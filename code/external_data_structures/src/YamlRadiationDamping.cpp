@@ -11,6 +11,7 @@ YamlRadiationDamping::YamlRadiationDamping() : hdb_filename(),
                                                type_of_quadrature_for_cos_transform(),
                                                type_of_quadrature_for_convolution(),
                                                nb_of_points_for_retardation_function_discretization(0),
+                                               nb_of_exponentials_for_prony(8),
                                                omega_min(0),
                                                omega_max(0),
                                                tau_min(0),
@@ -27,7 +27,11 @@ class ExactHydrostaticForceModel : public FastHydrostaticForceModel
 
     private:
         ExactHydrostaticForceModel();
-        EPoint get_application_point(const FacetIterator& that_facet, const BodyStates& states, const double zG) const;
+        ssc::kinematics::Wrench integrate(const FacetIterator& begin_facet,
+                                          const FacetIterator& end_facet,
+                                          const BodyStates& states,
+                                          const double t
+                                         ) const;
 };
 
 #endif /* EXACTHYDROSTATICFORCEMODEL_HPP_ */
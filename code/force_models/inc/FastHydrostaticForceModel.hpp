@@ -14,17 +14,6 @@ class FastHydrostaticForceModel : public ImmersedSurfaceForceModel
 {
     public:
         FastHydrostaticForceModel(const std::string& body_name, const EnvironmentAndFrames& env);
-        std::function<DF(const FacetIterator &,
-                         const size_t,
-                         const EnvironmentAndFrames &,
-                         const BodyStates &,
-                         const double
-                        )> get_dF(const FacetIterator& begin_facet,
-                                  const FacetIterator& end_facet,
-                                  const EnvironmentAndFrames& env,
-                                  const BodyStates& states,
-                                  const double t
-                                 ) const;
         std::string get_name() const;
         static std::string model_name();
         double gz() const;
@@ -32,10 +21,34 @@ class FastHydrostaticForceModel : public ImmersedSurfaceForceModel
     protected:
         FastHydrostaticForceModel(const std::string& force_name, const std::string& body_name, const EnvironmentAndFrames& env);
 
+        /**  \brief Sums the hydrostatic pressure forces rho*g*zG*dS over the facets
+          *  \details C(that_facet, states, zG) is the application point of the force on each facet
+          *           (a template parameter so the fast & exact models each get their own inlined loop)
+          */
+        template <typename ApplicationPoint> ssc::kinematics::Wrench hydrostatic_force(const FacetIterator& begin_facet,
+                                                                                       const FacetIterator& end_facet,
+                                                                                       const BodyStates& states,
+                                                                                       const ApplicationPoint& C) const
+        {
+            const ZGCalculator& zg = *zg_calculator;
+            const double rho_g = env.rho*env.g;
+            return sum_over_facets(begin_facet, end_facet, states, [&zg, &states, &C, rho_g](const FacetIterator& that_facet, const size_t)
+            {
+                if (that_facet->area == 0) return DF(EPoint(0,0,0),EPoint(0,0,0));
+                const double zG = zg.get_zG_in_NED(that_facet->centre_of_gravity);
+                const EPoint dS = that_facet->area*that_facet->unit_normal;
+                return DF(-rho_g*zG*dS, C(that_facet, states, zG));
+            });
+        }
+
     private:
         FastHydrostaticForceModel();
         void extra_observations(Observer& observer) const;
-        virtual EPoint get_application_point(const FacetIterator& that_facet, const BodyStates& states, const double zG) const;
+        ssc::kinematics::Wrench integrate(const FacetIterator& begin_facet,
+                                          const FacetIterator& end_facet,
+                                          const BodyStates& states,
+                                          const double t
+                                         ) const;
         double pe(const BodyStates& states, const std::vector<double>& x, const EnvironmentAndFrames& env) const;
 };
 
@@ -23,21 +23,15 @@ class FroudeKrylovForceModel : public ImmersedSurfaceForceModel
 {
     public:
         FroudeKrylovForceModel(const std::string& body_name, const EnvironmentAndFrames& env);
-        std::function<DF(const FacetIterator &,
-                         const size_t,
-                         const EnvironmentAndFrames &,
-                         const BodyStates &,
-                         const double
-                        )> get_dF(const FacetIterator& begin_facet,
-                                  const FacetIterator& end_facet,
-                                  const EnvironmentAndFrames& env,
-                                  const BodyStates& states,
-                                  const double t
-                                 ) const;
         static std::string model_name();
 
     private:
         FroudeKrylovForceModel();
+        ssc::kinematics::Wrench integrate(const FacetIterator& begin_facet,
+                                          const FacetIterator& end_facet,
+                                          const BodyStates& states,
+                                          const double t
+                                         ) const;
         double pe(const BodyStates& states, const std::vector<double>& x, const EnvironmentAndFrames& env) const;
 };
 
@@ -30,17 +30,6 @@ class GMForceModel : public ImmersedSurfaceForceModel
             ForceParser try_to_parse;
         };
         GMForceModel(const Yaml& data, const std::string& body_name, const EnvironmentAndFrames& env);
-        std::function<DF(const FacetIterator &,
-                         const size_t,
-                         const EnvironmentAndFrames &,
-                         const BodyStates &,
-                         const double
-                        )> get_dF(const FacetIterator& begin_facet,
-                                  const FacetIterator& end_facet,
-                                  const EnvironmentAndFrames& env,
-                                  const BodyStates& states,
-                                  const double t
-                                 ) const;
         static Yaml parse(const std::string& yaml);
         ssc::kinematics::Wrench operator()(const BodyStates& states, const double t) const;
         void extra_observations(Observer& ) const;
@@ -49,6 +38,11 @@ class GMForceModel : public ImmersedSurfaceForceModel
 
     private:
         GMForceModel();
+        ssc::kinematics::Wrench integrate(const FacetIterator& begin_facet,
+                                          const FacetIterator& end_facet,
+                                          const BodyStates& states,
+                                          const double t
+                                         ) const;
         double get_gz_for_shifted_states(const BodyStates& states, const double t) const;
         BodyStates get_shifted_states(const BodyStates& states,
                 const double t) const;
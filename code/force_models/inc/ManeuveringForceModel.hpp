@@ -16,6 +16,7 @@
 #include "ControllableForceModel.hpp"
 #include "YamlPosition.hpp"
 #include "ManeuveringInternal.hpp"
+#include "maneuvering_bytecode.hpp"
 
 
 #include TR1INC(memory)
@@ -42,7 +43,10 @@ class ManeuveringForceModel : public ControllableForceModel
     private:
         ManeuveringForceModel();
         std::map<std::string, maneuvering::NodePtr> m;
-        TR1(shared_ptr)<ssc::data_source::DataSource> ds;
+        maneuvering::Program program;               //!< Flat version of the expressions in 'm', evaluated by get_force
+        std::vector<std::string> command_names;     //!< Inputs of 'program': commands of this model & other identifiers read from the command listener
+        mutable std::vector<double> command_values; //!< In the order of command_names
+        mutable std::vector<double> outputs;        //!< X, Y, Z, K, M, N
 };
 
 #endif /* MANEUVERINGFORCEMODEL_HPP_ */
@@ -24,7 +24,7 @@ class RadiationDampingForceModel : public ForceModel
         struct Input
         {
             Input() : hdb(), yaml(){}
-            TR1(shared_ptr)<HDBParser> hdb;
+            TR1(shared_ptr)<const HDBParser> hdb;
             YamlRadiationDamping yaml;
         };
         RadiationDampingForceModel(const Input& input, const std::string& body_name, const EnvironmentAndFrames& env);
@@ -36,8 +36,9 @@ class RadiationDampingForceModel : public ForceModel
     private:
         RadiationDampingForceModel();
         class Impl;
-        TR1(shared_ptr)<Impl> pimpl;
-
+        TR1(shared_ptr)<const Impl> pimpl;
+        struct State;
+        mutable TR1(shared_ptr)<State> state; //!< Convolution states & work buffers, updated by each call to operator()
 };
 
 #endif /* RadiationDampingForceModel_HPP_ */
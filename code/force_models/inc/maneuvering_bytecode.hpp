@@ -0,0 +1,88 @@
+/*
+ * maneuvering_bytecode.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+
+#ifndef MANEUVERING_BYTECODE_HPP_
+#define MANEUVERING_BYTECODE_HPP_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "ManeuveringInternal.hpp"
+#include "YamlRotation.hpp"
+
+namespace maneuvering
+{
+    enum class OpCode {TIME, INPUT, STATE, COS, SIN, ABS, LOG, EXP, SQRT, SUM, DIFFERENCE, MULTIPLY, DIVIDE, POW};
+
+    struct Instruction
+    {
+        Instruction();
+        Instruction(const OpCode op, const StateType state, const size_t lhs, const size_t rhs, const size_t out);
+        OpCode op;
+        StateType state; //!< Only used by OpCode::STATE
+        size_t lhs;      //!< Register of the first operand (index of the input for OpCode::INPUT, register of the date for OpCode::STATE)
+        size_t rhs;      //!< Register of the second operand (binary operators only)
+        size_t out;      //!< Register where the result is stored
+    };
+
+    /** \brief Flat version of the expressions of a maneuvering model
+     *  \details The expression trees are lowered once (by build_program) into a list of instructions
+     *           working on registers. Variables, commands & environmental constants are resolved
+     *           to register or input indices at build time, constant sub-expressions are evaluated
+     *           once & identical sub-expressions (eg. u(t) appearing in several coefficients) are
+     *           only computed once. Evaluating the model is then a single loop over the instructions,
+     *           with no memory allocation & no lookup by name.
+     *  \addtogroup force_models
+     *  \ingroup force_models
+     *  \section ex1 Example
+     *  \snippet force_models/unit_tests/src/maneuvering_bytecodeTest.cpp maneuvering_bytecodeTest example
+     */
+    class Program
+    {
+        public:
+            Program(const std::vector<Instruction>& instructions, //!< Sorted so that each operand is computed before it is used
+                    const std::vector<double>& registers,         //!< Initial content of the registers (holds the constants)
+                    const std::vector<size_t>& outputs,           //!< Register of each output
+                    const std::vector<std::string>& inputs,       //!< Name of each value expected by 'evaluate'
+                    const YamlRotation& rot                       //!< Used to compute the Euler angles
+                    );
+
+            /**  \brief Computes all outputs (in the order given to build_program)
+              *  \details Not thread-safe: the registers are shared by all calls.
+              */
+            void evaluate(const BodyStates& states, const double t, const std::vector<double>& input_values, std::vector<double>& outputs) const;
+            std::vector<std::string> get_input_names() const;
+            size_t get_nb_of_instructions() const;
+            size_t get_nb_of_registers() const;
+
+        private:
+            Program();
+            std::vector<Instruction> instructions;
+            std::vector<size_t> outputs;
+            std::vector<std::string> inputs;
+            YamlRotation rot;
+            mutable std::vector<double> registers;
+    };
+
+    /**  \brief Lowers the expressions needed to compute 'outputs' into a Program
+      *  \details Identifiers are resolved (in that order) to the other expressions, to the inputs
+      *           (the commands) & to the parameters (eg. g, nu & rho). The remaining identifiers
+      *           (eg. commands of other models) are appended to the inputs of the program (cf.
+      *           Program::get_input_names). Circular definitions throw an InvalidInputException.
+      *           Expressions the outputs do not depend on are ignored.
+      */
+    Program build_program(const std::map<std::string, NodePtr>& expressions,
+                          const std::vector<std::string>& outputs,
+                          const std::vector<std::string>& inputs,
+                          const std::map<std::string, double>& parameters,
+                          const YamlRotation& rot);
+}
+
+
+#endif  /* MANEUVERING_BYTECODE_HPP_ */
@@ -10,6 +10,7 @@
 #include "Body.hpp"
 #include "DiffractionInterpolator.hpp"
 #include "HDBParser.hpp"
+#include "InputCache.hpp"
 #include "InvalidInputException.hpp"
 #include "SurfaceElevationInterface.hpp"
 #include "yaml.h"
@@ -17,9 +18,10 @@
 #include "yaml2eigen.hpp"
 
 #include <ssc/interpolation.hpp>
-#include <ssc/text_file_reader.hpp>
+#include <ssc/yaml_parser.hpp>
 
 #include <array>
+#include <cmath>
 #define TWOPI 6.283185307179586232
 
 std::string DiffractionForceModel::model_name() { return "diffraction";}
@@ -27,7 +29,7 @@ std::string DiffractionForceModel::model_name() { return "diffraction";}
 HDBParser hdb_from_file(const std::string& filename);
 HDBParser hdb_from_file(const std::string& filename)
 {
-    return HDBParser(ssc::text_file_reader::TextFileReader(filename).get_contents());
+    return *InputCache::hdb(filename);
 }
 
 void check_all_omegas_are_within_bounds(const double min_bound, const std::vector<std::vector<double> >& vector_to_check, const double max_bound);
@@ -69,6 +71,26 @@ std::vector<std::vector<double> > convert_to_periods(std::vector<std::vector<dou
     return angular_frequencies;
 }
 
+typedef std::array<std::vector<std::vector<double> >, 6> RAOTable; // [degree of freedom][spectrum][(period, incidence) pair]
+
+RAOTable allocate_rao_table(const std::vector<std::vector<double> >& periods_for_each_direction);
+RAOTable allocate_rao_table(const std::vector<std::vector<double> >& periods_for_each_direction)
+{
+    RAOTable ret;
+    for (auto& rao_for_each_spectrum:ret)
+    {
+        for (const auto& periods:periods_for_each_direction) rao_for_each_spectrum.push_back(std::vector<double>(periods.size(), 0));
+    }
+    return ret;
+}
+
+size_t get_nb_of_heading_bins(const double heading_tolerance);
+size_t get_nb_of_heading_bins(const double heading_tolerance)
+{
+    if (heading_tolerance <= 0) return 0;
+    // Bins are narrower than the tolerance & divide the circle evenly
+    return (size_t)std::ceil(TWOPI/heading_tolerance - 1E-9);
+}
 
 class DiffractionForceModel::Impl
 {
@@ -79,7 +101,16 @@ class DiffractionForceModel::Impl
         H0(data.calculation_point.x,data.calculation_point.y,data.calculation_point.z),
         rao(DiffractionInterpolator(hdb,std::vector<double>(),std::vector<double>(),data.mirror)),
         periods_for_each_direction(),
-        psis()
+        psis(),
+        rao_modules(),
+        rao_phases(),
+        heading_bin(0),
+        cached_modules(),
+        cached_phases(),
+        bin_is_cached(),
+        cartesian_rao(),
+        psi_of_cartesian_rao(std::nan("")),
+        ned_to_body(env.transforms->get_handle("NED", body_name))
         {
             if (env.w.use_count()>0)
             {
@@ -116,59 +147,119 @@ class DiffractionForceModel::Impl
             pos.coordinates = data.calculation_point;
             const auto from_internal_frame_to_a_known_frame = make_transform(pos, body_name, env.rot);
             env.k->add(from_internal_frame_to_a_known_frame);
+            rao_modules = allocate_rao_table(periods_for_each_direction);
+            rao_phases = allocate_rao_table(periods_for_each_direction);
+            for (const auto& periods:periods_for_each_direction) cartesian_rao.push_back(CartesianRAO(periods.size()));
+            const size_t nb_of_heading_bins = get_nb_of_heading_bins(data.heading_tolerance_for_rao_cache);
+            if (nb_of_heading_bins)
+            {
+                heading_bin = TWOPI/(double)nb_of_heading_bins;
+                cached_modules.resize(nb_of_heading_bins);
+                cached_phases.resize(nb_of_heading_bins);
+                bin_is_cached.resize(nb_of_heading_bins, false);
+            }
+        }
+
+        /**  \brief Interpolates the RAO (module & phase) for each degree of freedom, each spectrum & each (period, incidence) pair
+          */
+        void interpolate_raos(const double psi, RAOTable& modules, RAOTable& phases)
+        {
+            for (size_t degree_of_freedom_idx = 0 ; degree_of_freedom_idx < 6 ; ++degree_of_freedom_idx) // For each degree of freedom (X, Y, Z, K, M, N)
+            {
+                for (size_t spectrum_idx = 0 ; spectrum_idx < periods_for_each_direction.size() ; ++spectrum_idx) // For each directional spectrum
+                {
+                    const size_t nb_of_period_incidence_pairs = periods_for_each_direction[spectrum_idx].size();
+                    for (size_t omega_beta_idx = 0 ; omega_beta_idx < nb_of_period_incidence_pairs ; ++omega_beta_idx) // For each incidence and each period (omega[i[omega_beta_idx]], beta[j[omega_beta_idx]])
+                    {
+                        // Wave incidence
+                        const double beta = psi - psis.at(spectrum_idx).at(omega_beta_idx);
+                        // Interpolate RAO module for this axis, period and incidence
+                        modules[degree_of_freedom_idx][spectrum_idx][omega_beta_idx] = rao.interpolate_module(degree_of_freedom_idx, periods_for_each_direction[spectrum_idx][omega_beta_idx], beta);
+                        // Interpolate RAO phase for this axis, period and incidence
+                        phases[degree_of_freedom_idx][spectrum_idx][omega_beta_idx] = -rao.interpolate_phase(degree_of_freedom_idx, periods_for_each_direction[spectrum_idx][omega_beta_idx], beta);
+                    }
+                }
+            }
+        }
+
+        void cache_bin(const size_t bin_idx)
+        {
+            if (not(bin_is_cached[bin_idx]))
+            {
+                cached_modules[bin_idx] = allocate_rao_table(periods_for_each_direction);
+                cached_phases[bin_idx] = allocate_rao_table(periods_for_each_direction);
+                interpolate_raos((double)bin_idx*heading_bin, cached_modules[bin_idx], cached_phases[bin_idx]);
+                bin_is_cached[bin_idx] = true;
+            }
+        }
+
+        /**  \brief Linear interpolation between the two heading bins surrounding psi
+          *  \details Phases are interpolated along the shortest arc, so a jump of 2 pi between the bins does not matter
+          */
+        void blend_cached_raos(const double psi)
+        {
+            const double u = psi/heading_bin;
+            const double k = std::floor(u);
+            const double alpha = u - k;
+            const double nb_of_bins = (double)bin_is_cached.size();
+            const size_t left = (size_t)(k - nb_of_bins*std::floor(k/nb_of_bins)); // psi is not necessarily in [0, 2 pi[
+            const size_t right = (left + 1) % bin_is_cached.size();
+            cache_bin(left);
+            cache_bin(right);
+            for (size_t degree_of_freedom_idx = 0 ; degree_of_freedom_idx < 6 ; ++degree_of_freedom_idx)
+            {
+                for (size_t spectrum_idx = 0 ; spectrum_idx < rao_modules[degree_of_freedom_idx].size() ; ++spectrum_idx)
+                {
+                    const std::vector<double>& left_modules = cached_modules[left][degree_of_freedom_idx][spectrum_idx];
+                    const std::vector<double>& right_modules = cached_modules[right][degree_of_freedom_idx][spectrum_idx];
+                    const std::vector<double>& left_phases = cached_phases[left][degree_of_freedom_idx][spectrum_idx];
+                    const std::vector<double>& right_phases = cached_phases[right][degree_of_freedom_idx][spectrum_idx];
+                    std::vector<double>& modules = rao_modules[degree_of_freedom_idx][spectrum_idx];
+                    std::vector<double>& phases = rao_phases[degree_of_freedom_idx][spectrum_idx];
+                    for (size_t i = 0 ; i < modules.size() ; ++i)
+                    {
+                        modules[i] = left_modules[i] + alpha*(right_modules[i] - left_modules[i]);
+                        phases[i] = left_phases[i] + alpha*std::remainder(right_phases[i] - left_phases[i], TWOPI);
+                    }
+                }
+            }
         }
 
         ssc::kinematics::Wrench evaluate(const ssc::kinematics::Point& G, const std::string& body_name, const double t, const double psi)
         {
             ssc::kinematics::Wrench ret;
             ssc::kinematics::Vector6d w;
-            auto T = env.k->get("NED", body_name);
+            auto T = env.transforms->get(env.k, ned_to_body);
             T.swap();
             const ssc::kinematics::Point position_in_ned_for_the_wave_model = T*ssc::kinematics::Point(body_name,H0);
             ssc::kinematics::Point point_of_application_in_body_frame(body_name,H0);
-            std::array<std::vector<std::vector<double> >, 6 > rao_modules;
-            std::array<std::vector<std::vector<double> >, 6 > rao_phases;
             if (env.w.use_count()>0)
             {
-                const size_t nb_of_spectra = periods_for_each_direction.size();
-                if (not(periods_for_each_direction.empty()))
-                {
-                    // Resize for each degree of freedom
-                    for (size_t k = 0 ; k < 6 ; ++k)
-                    {
-                        rao_modules[k].resize(nb_of_spectra);
-                        rao_phases[k].resize(nb_of_spectra);
-                    }
-                }
-                for (size_t degree_of_freedom_idx = 0 ; degree_of_freedom_idx < 6 ; ++degree_of_freedom_idx) // For each degree of freedom (X, Y, Z, K, M, N)
+                // The RAO only depend on the heading, which often does not change between two evaluations
+                if (psi != psi_of_cartesian_rao)
                 {
-                    for (size_t spectrum_idx = 0 ; spectrum_idx < nb_of_spectra ; ++spectrum_idx) // For each directional spectrum
+                    if (heading_bin > 0) blend_cached_raos(psi);
+                    else                 interpolate_raos(psi, rao_modules, rao_phases);
+                    for (size_t spectrum_idx = 0 ; spectrum_idx < cartesian_rao.size() ; ++spectrum_idx)
                     {
-                        const size_t nb_of_period_incidence_pairs = periods_for_each_direction[spectrum_idx].size();
-                        rao_modules[degree_of_freedom_idx][spectrum_idx].resize(nb_of_period_incidence_pairs);
-                        rao_phases[degree_of_freedom_idx][spectrum_idx].resize(nb_of_period_incidence_pairs);
-                        for (size_t omega_beta_idx = 0 ; omega_beta_idx < nb_of_period_incidence_pairs ; ++omega_beta_idx) // For each incidence and each period (omega[i[omega_beta_idx]], beta[j[omega_beta_idx]])
+                        for (size_t degree_of_freedom_idx = 0 ; degree_of_freedom_idx < 6 ; ++degree_of_freedom_idx)
                         {
-                            // Wave incidence
-                            const double beta = psi - psis.at(spectrum_idx).at(omega_beta_idx);
-                            // Interpolate RAO module for this axis, period and incidence
-                            rao_modules[degree_of_freedom_idx][spectrum_idx][omega_beta_idx] = rao.interpolate_module(degree_of_freedom_idx, periods_for_each_direction[spectrum_idx][omega_beta_idx], beta);
-                            // Interpolate RAO phase for this axis, period and incidence
-                            rao_phases[degree_of_freedom_idx][spectrum_idx][omega_beta_idx] = -rao.interpolate_phase(degree_of_freedom_idx, periods_for_each_direction[spectrum_idx][omega_beta_idx], beta);
+                            cartesian_rao[spectrum_idx].set(degree_of_freedom_idx, rao_modules[degree_of_freedom_idx][spectrum_idx], rao_phases[degree_of_freedom_idx][spectrum_idx]);
                         }
                     }
-                    try
-                    {
-                        w((int)degree_of_freedom_idx) = env.w->evaluate_rao(position_in_ned_for_the_wave_model.x(),
-                                                        position_in_ned_for_the_wave_model.y(),
-                                                        t,
-                                                        rao_modules[degree_of_freedom_idx],
-                                                        rao_phases[degree_of_freedom_idx]);
-                    }
-                    catch (const ssc::exception_handling::Exception& e)
-                    {
-                        THROW(__PRETTY_FUNCTION__, ssc::exception_handling::Exception, "This simulation uses the diffraction force model which evaluates a Response Amplitude Operator using a wave model. During this evaluation, the following problem occurred:\n" << e.get_message());
-                    }
+                    psi_of_cartesian_rao = psi;
+                }
+                try
+                {
+                    const std::array<double, 6> F = env.w->evaluate_rao_6dof(position_in_ned_for_the_wave_model.x(),
+                                                                             position_in_ned_for_the_wave_model.y(),
+                                                                             t,
+                                                                             cartesian_rao);
+                    for (size_t degree_of_freedom_idx = 0 ; degree_of_freedom_idx < 6 ; ++degree_of_freedom_idx) w((int)degree_of_freedom_idx) = F[degree_of_freedom_idx];
+                }
+                catch (const ssc::exception_handling::Exception& e)
+                {
+                    THROW(__PRETTY_FUNCTION__, ssc::exception_handling::Exception, "This simulation uses the diffraction force model which evaluates a Response Amplitude Operator using a wave model. During this evaluation, the following problem occurred:\n" << e.get_message());
                 }
             }
             const auto ww = express_aquaplus_wrench_in_xdyn_coordinates(w);
@@ -205,6 +296,15 @@ class DiffractionForceModel::Impl
         DiffractionInterpolator rao;
         std::vector<std::vector<double> > periods_for_each_direction;
         std::vector<std::vector<double> > psis;
+        RAOTable rao_modules;                 //!< Modules passed to the wave model (allocated once)
+        RAOTable rao_phases;                  //!< Phases passed to the wave model (allocated once)
+        double heading_bin;                   //!< Width of the heading bins of the cache (0 if there is no cache)
+        std::vector<RAOTable> cached_modules; //!< RAO modules for each heading bin (empty until the bin is needed)
+        std::vector<RAOTable> cached_phases;  //!< RAO phases for each heading bin (empty until the bin is needed)
+        std::vector<bool> bin_is_cached;
+        std::vector<CartesianRAO> cartesian_rao; //!< rao_modules & rao_phases converted for SurfaceElevationInterface::evaluate_rao_6dof, for each spectrum
+        double psi_of_cartesian_rao;             //!< Heading at which cartesian_rao was computed (NaN before the first evaluation)
+        size_t ned_to_body;                      //!< Handle of the transform from NED to the body frame (in env.transforms)
 
 };
 
@@ -234,5 +334,13 @@ DiffractionForceModel::Input DiffractionForceModel::parse(const std::string& yam
     node["hdb"]                             >> ret.hdb_filename;
     node["calculation point in body frame"] >> ret.calculation_point;
     node["mirror for 180 to 360"]           >> ret.mirror;
+    if (const YAML::Node* tolerance = node.FindValue("heading tolerance for RAO cache"))
+    {
+        ssc::yaml_parser::parse_uv(*tolerance, ret.heading_tolerance_for_rao_cache);
+        if (ret.heading_tolerance_for_rao_cache < 0)
+        {
+            THROW(__PRETTY_FUNCTION__, InvalidInputException, "'heading tolerance for RAO cache' should be positive (or zero to disable the cache), but got " << ret.heading_tolerance_for_rao_cache*360/TWOPI << "°");
+        }
+    }
     return ret;
 }
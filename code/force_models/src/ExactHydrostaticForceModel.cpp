@@ -19,9 +19,13 @@ ExactHydrostaticForceModel::ExactHydrostaticForceModel(const std::string& body_n
     }
 }
 
-EPoint ExactHydrostaticForceModel::get_application_point(const FacetIterator& that_facet,
-                                                         const BodyStates& states,
-                                                         const double zG) const
+ssc::kinematics::Wrench ExactHydrostaticForceModel::integrate(const FacetIterator& begin_facet,
+                                                              const FacetIterator& end_facet,
+                                                              const BodyStates& states,
+                                                              const double) const
 {
-    return exact_application_point(that_facet,states.g_in_mesh_frame,zG,states.intersector->mesh->all_nodes,states.intersector->all_relative_immersions);
+    return hydrostatic_force(begin_facet, end_facet, states, [](const FacetIterator& that_facet, const BodyStates& states_, const double zG)
+    {
+        return exact_application_point(that_facet,states_.g_in_mesh_frame,zG,states_.intersector->mesh->all_nodes,states_.intersector->all_relative_immersions);
+    });
 }
@@ -27,7 +27,7 @@ FastHydrostaticForceModel::FastHydrostaticForceModel(const std::string& force_na
 
 double FastHydrostaticForceModel::gz() const
 {
-    return calculate_gz(env.k->get("NED", get_body_name()), get_force_in_ned_frame());
+    return calculate_gz(env.transforms->get(env.k, ned_to_body), get_force_in_ned_frame());
 }
 
 std::string FastHydrostaticForceModel::get_name() const
@@ -35,30 +35,15 @@ std::string FastHydrostaticForceModel::get_name() const
     return this->model_name();
 }
 
-EPoint FastHydrostaticForceModel::get_application_point(const FacetIterator& that_facet, const BodyStates&, const double) const
+ssc::kinematics::Wrench FastHydrostaticForceModel::integrate(const FacetIterator& begin_facet,
+                                                             const FacetIterator& end_facet,
+                                                             const BodyStates& states,
+                                                             const double) const
 {
-    return that_facet->centre_of_gravity; // In Body frame
-}
-
-std::function<SurfaceForceModel::DF(const FacetIterator &, const size_t, const EnvironmentAndFrames &, const BodyStates &, const double)>
-    FastHydrostaticForceModel::get_dF(const FacetIterator& begin_facet,
-                                      const FacetIterator& end_facet,
-                                      const EnvironmentAndFrames& env,
-                                      const BodyStates& states,
-                                      const double t) const
-{
-    return [this](const FacetIterator &that_facet,
-                  const size_t that_facet_index,
-                  const EnvironmentAndFrames &env,
-                  const BodyStates &states,
-                  const double t)
+    return hydrostatic_force(begin_facet, end_facet, states, [](const FacetIterator& that_facet, const BodyStates&, const double)
     {
-        if (that_facet->area == 0) return DF(EPoint(0,0,0),EPoint(0,0,0));
-        const double zG = zg_calculator->get_zG_in_NED(that_facet->centre_of_gravity);
-        const EPoint dS = that_facet->area*that_facet->unit_normal;
-        const EPoint C = get_application_point(that_facet, states, zG);
-        return DF(-env.rho*env.g*zG*dS,C);
-    };
+        return that_facet->centre_of_gravity; // In Body frame
+    });
 }
 
 double FastHydrostaticForceModel::pe(const BodyStates& states, const std::vector<double>&, const EnvironmentAndFrames& env) const
@@ -71,5 +56,9 @@ double FastHydrostaticForceModel::pe(const BodyStates& states, const std::vector
 
 void FastHydrostaticForceModel::extra_observations(Observer& observer) const
 {
-    observer.write(gz(),DataAddressing(std::vector<std::string>{"efforts",get_body_name(),get_name(),get_body_name(),"GZ"},std::string("GZ(")+get_name()+","+get_body_name()+")"));
+    if (extra_observations_addressing.empty())
+    {
+        extra_observations_addressing.push_back(DataAddressing(std::vector<std::string>{"efforts",get_body_name(),get_name(),get_body_name(),"GZ"},std::string("GZ(")+get_name()+","+get_body_name()+")"));
+    }
+    observer.write(gz(),extra_observations_addressing[0]);
 }
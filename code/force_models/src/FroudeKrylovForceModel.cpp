@@ -20,12 +20,10 @@ FroudeKrylovForceModel::FroudeKrylovForceModel(const std::string& body_name_, co
     }
 }
 
-std::function<SurfaceForceModel::DF(const FacetIterator &, const size_t, const EnvironmentAndFrames &, const BodyStates &, const double)>
-    FroudeKrylovForceModel::get_dF(const FacetIterator &begin_facet,
-                                   const FacetIterator &end_facet,
-                                   const EnvironmentAndFrames &env,
-                                   const BodyStates &states,
-                                   const double t) const
+ssc::kinematics::Wrench FroudeKrylovForceModel::integrate(const FacetIterator& begin_facet,
+                                                          const FacetIterator& end_facet,
+                                                          const BodyStates& states,
+                                                          const double t) const
 {
     // Compute average elevation for each facet
     std::vector<double> average_eta_per_facet;
@@ -61,17 +59,12 @@ std::function<SurfaceForceModel::DF(const FacetIterator &, const size_t, const E
         THROW(__PRETTY_FUNCTION__, ssc::exception_handling::Exception, "This simulation uses the Froude-Krylov force model which uses the dynamic pressures calculated by a wave model. When querying the wave model for these dynamic pressures, the following problem occurred:\n" << e.get_message());
     }
 
-    return [pdyn](const FacetIterator &that_facet,
-                  const size_t that_facet_index,
-                  const EnvironmentAndFrames &env,
-                  const BodyStates &states,
-                  const double t)
+    return sum_over_facets(begin_facet, end_facet, states, [&pdyn](const FacetIterator& that_facet, const size_t that_facet_index)
     {
         // Calculate facet area and centre of gravity
         const EPoint dS = that_facet->area * that_facet->unit_normal;
-        const ssc::kinematics::Point C(states.M->get_frame(), that_facet->centre_of_gravity);
-        return SurfaceForceModel::DF(-pdyn.at(that_facet_index) * dS, C.v);
-    };
+        return SurfaceForceModel::DF(-pdyn[that_facet_index] * dS, that_facet->centre_of_gravity);
+    });
 }
 
 double FroudeKrylovForceModel::pe(const BodyStates& , const std::vector<double>& , const EnvironmentAndFrames& ) const
@@ -121,8 +121,13 @@ ssc::kinematics::Wrench GMForceModel::operator()(const BodyStates& states, const
 
 void GMForceModel::extra_observations(Observer& observer) const
 {
-    observer.write(*GM,DataAddressing(std::vector<std::string>{"efforts",get_body_name(),get_name(),"GM"},std::string("GM(") + get_body_name() + ")"));
-    observer.write(*GZ,DataAddressing(std::vector<std::string>{"efforts",get_body_name(),get_name(),"GM"},std::string("GZ(") + get_body_name() + ")"));
+    if (extra_observations_addressing.empty())
+    {
+        extra_observations_addressing.push_back(DataAddressing(std::vector<std::string>{"efforts",get_body_name(),get_name(),"GM"},std::string("GM(") + get_body_name() + ")"));
+        extra_observations_addressing.push_back(DataAddressing(std::vector<std::string>{"efforts",get_body_name(),get_name(),"GM"},std::string("GZ(") + get_body_name() + ")"));
+    }
+    observer.write(*GM,extra_observations_addressing[0]);
+    observer.write(*GZ,extra_observations_addressing[1]);
 }
 
 double GMForceModel::pe(const BodyStates& , const std::vector<double>& , const EnvironmentAndFrames& ) const
@@ -130,19 +135,14 @@ double GMForceModel::pe(const BodyStates& , const std::vector<double>& , const E
     return 0;
 }
 
-std::function<GMForceModel::DF(const FacetIterator &, const size_t, const EnvironmentAndFrames &, const BodyStates &, const double)>
-    GMForceModel::get_dF(const FacetIterator& begin_facet,
-                         const FacetIterator& end_facet,
-                         const EnvironmentAndFrames& env,
-                         const BodyStates& states,
-                         const double t) const
+ssc::kinematics::Wrench GMForceModel::integrate(const FacetIterator& begin_facet,
+                                                const FacetIterator& end_facet,
+                                                const BodyStates& states,
+                                                const double) const
 {
-    return [](const FacetIterator &,
-              const size_t,
-              const EnvironmentAndFrames &,
-              const BodyStates &,
-              const double t)
+    // Never called: operator() is overloaded & uses the underlying hydrostatic force model
+    return sum_over_facets(begin_facet, end_facet, states, [](const FacetIterator&, const size_t)
     {
-        return GMForceModel::DF(EPoint(), EPoint());
-    };
+        return GMForceModel::DF(EPoint(0,0,0), EPoint(0,0,0));
+    });
 }
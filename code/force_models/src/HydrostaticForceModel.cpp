@@ -72,9 +72,16 @@ ssc::kinematics::Point HydrostaticForceModel::get_centre_of_buoyancy() const
 
 void HydrostaticForceModel::extra_observations(Observer& observer) const
 {
-    observer.write(centre_of_buoyancy->operator()(0),DataAddressing(std::vector<std::string>{"efforts",get_body_name(),get_name(),"Bx"},std::string("Bx")));
-    observer.write(centre_of_buoyancy->operator()(1),DataAddressing(std::vector<std::string>{"efforts",get_body_name(),get_name(),"By"},std::string("By")));
-    observer.write(centre_of_buoyancy->operator()(2),DataAddressing(std::vector<std::string>{"efforts",get_body_name(),get_name(),"Bz"},std::string("Bz")));
+    if (extra_observations_addressing.empty())
+    {
+        extra_observations_addressing.push_back(DataAddressing(std::vector<std::string>{"efforts",get_body_name(),get_name(),"Bx"},std::string("Bx")));
+        extra_observations_addressing.push_back(DataAddressing(std::vector<std::string>{"efforts",get_body_name(),get_name(),"By"},std::string("By")));
+        extra_observations_addressing.push_back(DataAddressing(std::vector<std::string>{"efforts",get_body_name(),get_name(),"Bz"},std::string("Bz")));
+        extra_observations_addressing.push_back(DataAddressing(std::vector<std::string>{"efforts",get_body_name(),get_name(),get_body_name(),"GZ"},std::string("GZ(")+get_name()+","+get_body_name()+")"));
+    }
+    observer.write(centre_of_buoyancy->operator()(0),extra_observations_addressing[0]);
+    observer.write(centre_of_buoyancy->operator()(1),extra_observations_addressing[1]);
+    observer.write(centre_of_buoyancy->operator()(2),extra_observations_addressing[2]);
     const double gz = calculate_gz(*this, env);
-    observer.write(gz,DataAddressing(std::vector<std::string>{"efforts",get_body_name(),get_name(),get_body_name(),"GZ"},std::string("GZ(")+get_name()+","+get_body_name()+")"));
+    observer.write(gz,extra_observations_addressing[3]);
 }
@@ -9,7 +9,6 @@
 #include "external_data_structures_parsers.hpp"
 #include "ManeuveringForceModel.hpp"
 #include "maneuvering_compiler.hpp"
-#include "maneuvering_DataSource_builder.hpp"
 #include "yaml.h"
 #include "yaml2eigen.hpp"
 #include "InvalidInputException.hpp"
@@ -67,37 +66,52 @@ ManeuveringForceModel::Yaml ManeuveringForceModel::parse(const std::string& yaml
     return ret;
 }
 
+std::map<std::string, maneuvering::NodePtr> compile_expressions(const std::map<std::string, std::string>& var2expr, const YamlRotation& rot);
+std::map<std::string, maneuvering::NodePtr> compile_expressions(const std::map<std::string, std::string>& var2expr, const YamlRotation& rot)
+{
+    std::map<std::string, maneuvering::NodePtr> ret;
+    for (const auto& v2e:var2expr)
+    {
+        ret[v2e.first] = maneuvering::compile(v2e.second, rot);
+    }
+    return ret;
+}
+
+std::map<std::string, double> get_environmental_constants(const EnvironmentAndFrames& env);
+std::map<std::string, double> get_environmental_constants(const EnvironmentAndFrames& env)
+{
+    std::map<std::string, double> ret;
+    ret["g"] = env.g;
+    ret["nu"] = env.nu;
+    ret["rho"] = env.rho;
+    return ret;
+}
+
 ManeuveringForceModel::ManeuveringForceModel(const Yaml& data, const std::string& body_name_, const EnvironmentAndFrames& env_) :
         ControllableForceModel(data.name, data.commands, data.frame_of_reference, body_name_, env_),
-        m(),
-        ds(new ssc::data_source::DataSource())
+        m(compile_expressions(data.var2expr, env_.rot)),
+        program(maneuvering::build_program(m, {"X","Y","Z","K","M","N"}, data.commands, get_environmental_constants(env_), env_.rot)),
+        command_names(program.get_input_names()),
+        command_values(command_names.size(), 0),
+        outputs(6, 0)
 {
     env.k->add(make_transform(data.frame_of_reference, data.name, env.rot));
-    for (auto var2expr:data.var2expr)
-    {
-        m[var2expr.first] = maneuvering::compile(var2expr.second, env.rot);
-    }
-    ds->set("g", env.g);
-    ds->set("nu", env.nu);
-    ds->set("rho", env.rho);
-    maneuvering::build_ds(*ds, m);
 }
 
 ssc::kinematics::Vector6d ManeuveringForceModel::get_force(const BodyStates& states, const double t, const std::map<std::string,double>& commands) const
 {
-    ds->check_in(__PRETTY_FUNCTION__);
-    ds->set("states", states);
-    ds->set("t", t);
-    for (const auto command:commands) ds->set(command.first, command.second);
-
-    ssc::kinematics::Vector6d tau = ssc::kinematics::Vector6d::Zero();
-    tau(0) = ds->get<double>("X");
-    tau(1) = ds->get<double>("Y");
-    tau(2) = ds->get<double>("Z");
-    tau(3) = ds->get<double>("K");
-    tau(4) = ds->get<double>("M");
-    tau(5) = ds->get<double>("N");
-    ds->check_out();
+    for (size_t i = 0 ; i < command_names.size() ; ++i)
+    {
+        const auto it = commands.find(command_names[i]);
+        if (it == commands.end())
+        {
+            THROW(__PRETTY_FUNCTION__, InvalidInputException, "Unable to find '" << command_names[i] << "' used by maneuvering model '" << get_name() << "': it is neither an expression of the model, nor a command, nor g, nu or rho.");
+        }
+        command_values[i] = it->second;
+    }
+    program.evaluate(states, t, command_values, outputs);
+    ssc::kinematics::Vector6d tau;
+    for (size_t i = 0 ; i < 6 ; ++i) tau(i) = outputs[i];
     return tau;
 }
 
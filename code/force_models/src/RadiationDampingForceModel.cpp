@@ -10,12 +10,14 @@
 #include "Body.hpp"
 #include "HDBParser.hpp"
 #include "History.hpp"
+#include "InputCache.hpp"
 #include "InvalidInputException.hpp"
 #include "RadiationDampingBuilder.hpp"
+#include "RecursiveConvolution.hpp"
+#include "ResampledHistory.hpp"
 #include "external_data_structures_parsers.hpp"
 
 #include <ssc/macros.hpp>
-#include <ssc/text_file_reader.hpp>
 
 #include <ssc/yaml_parser.hpp>
 
@@ -23,6 +25,7 @@
 
 #include <cassert>
 #include <array>
+#include <iomanip>
 
 #define _USE_MATH_DEFINE
 #include <cmath>
@@ -88,23 +91,37 @@ class CSVWriter
 
 };
 
+typedef std::array<const History*, 6> VelocityHistories; //!< Borrowed from BodyStates (u, v, w, p, q, r)
+
+struct RadiationDampingForceModel::State
+{
+    State() : recursive_convolutions(), resampled_velocities()
+    {
+    }
+    std::vector<RecursiveConvolution::State> recursive_convolutions; //!< Row-major (i,k)
+    std::vector<ResampledHistory> resampled_velocities;              //!< u, v, w, p, q, r sampled at each tau
+};
+
 class RadiationDampingForceModel::Impl
 {
     public:
-        Impl(const TR1(shared_ptr)<HDBParser>& parser, const YamlRadiationDamping& yaml) : hdb{parser}, builder(RadiationDampingBuilder(yaml.type_of_quadrature_for_convolution, yaml.type_of_quadrature_for_cos_transform)), K(),
+        Impl(const TR1(shared_ptr)<const HDBParser>& parser, const YamlRadiationDamping& yaml) : hdb{parser}, builder(RadiationDampingBuilder(yaml.type_of_quadrature_for_convolution, yaml.type_of_quadrature_for_cos_transform)), K(),
         omega(parser->get_radiation_damping_angular_frequencies()), taus(), n(yaml.nb_of_points_for_retardation_function_discretization), Tmin(yaml.tau_min), Tmax(yaml.tau_max),
-        H0(yaml.calculation_point_in_body_frame.x,yaml.calculation_point_in_body_frame.y,yaml.calculation_point_in_body_frame.y)
+        H0(yaml.calculation_point_in_body_frame.x,yaml.calculation_point_in_body_frame.y,yaml.calculation_point_in_body_frame.y),
+        use_recursive_convolution(yaml.type_of_quadrature_for_convolution == TypeOfQuadrature::PRONY), recursive_convolutions(),
+        use_retardation_grid(yaml.type_of_quadrature_for_convolution == TypeOfQuadrature::RETARDATION_GRID), K_on_grid()
         {
             CSVWriter omega_writer(std::cerr, "omega", omega);
             taus = builder.build_regular_intervals(Tmin,Tmax,n);
             CSVWriter tau_writer(std::cerr, "tau", taus);
 
+            const auto K_values = get_K_values(yaml);
             for (size_t i = 0 ; i < 6 ; ++i)
             {
                 for (size_t j = 0 ; j < 6 ; ++j)
                 {
                     const auto Br = get_Br(i,j);
-                    K[i][j] = get_K(Br);
+                    K[i][j] = builder.build_interpolator(taus, K_values->at(6*i+j));
                     if (yaml.output_Br_and_K)
                     {
                         omega_writer.add("Br",Br,i+1,j+1);
@@ -119,6 +136,70 @@ class RadiationDampingForceModel::Impl
                 std::cerr << std::endl << "Debugging information for retardation functions K:" << std::endl;
                 tau_writer.print();
             }
+            if (use_recursive_convolution)
+            {
+                build_recursive_convolutions(yaml.nb_of_exponentials_for_prony, yaml.output_Br_and_K);
+            }
+            if (use_retardation_grid)
+            {
+                build_retardation_grid();
+            }
+        }
+
+        void build_retardation_grid()
+        {
+            for (size_t i = 0 ; i < 6 ; ++i)
+            {
+                for (size_t j = 0 ; j < 6 ; ++j)
+                {
+                    K_on_grid[i][j].reserve(taus.size());
+                    for (const auto tau:taus) K_on_grid[i][j].push_back(K[i][j](tau));
+                }
+            }
+        }
+
+        void build_recursive_convolutions(const size_t nb_of_exponentials, const bool print_all_errors)
+        {
+            // Fit error is measured against the retardation functions obtained by quadrature, on a finer grid
+            const std::vector<double> taus_for_error = builder.build_regular_intervals(Tmin, Tmax, 10*n);
+            double max_error = 0;
+            size_t i_max = 0;
+            size_t j_max = 0;
+            for (size_t i = 0 ; i < 6 ; ++i)
+            {
+                for (size_t j = 0 ; j < 6 ; ++j)
+                {
+                    const ExponentialSum approximation = prony(K[i][j], taus, nb_of_exponentials);
+                    recursive_convolutions.push_back(RecursiveConvolution(approximation));
+                    const double error = relative_fit_error(K[i][j], approximation, taus_for_error);
+                    if (print_all_errors)
+                    {
+                        std::cerr << "Relative error of Prony approximation of K_" << i+1 << j+1 << ": " << error << std::endl;
+                    }
+                    if (error > max_error)
+                    {
+                        max_error = error;
+                        i_max = i;
+                        j_max = j;
+                    }
+                }
+            }
+            if (print_all_errors)
+            {
+                std::cerr << "Radiation damping: largest relative error of the Prony approximation of the retardation functions (with "
+                          << nb_of_exponentials << " exponentials) is " << max_error << " (for K_" << i_max+1 << j_max+1 << ")" << std::endl;
+            }
+        }
+
+        RadiationDampingForceModel::State get_initial_state() const
+        {
+            RadiationDampingForceModel::State ret;
+            for (const auto& convolution:recursive_convolutions) ret.recursive_convolutions.push_back(convolution.get_initial_state());
+            if (use_retardation_grid)
+            {
+                for (size_t k = 0 ; k < 6 ; ++k) ret.resampled_velocities.push_back(ResampledHistory(taus));
+            }
+            return ret;
         }
 
         std::function<double(double)> get_Br(const size_t i, const size_t j) const
@@ -126,18 +207,50 @@ class RadiationDampingForceModel::Impl
             return builder.build_interpolator(omega,hdb->get_radiation_damping_coeff(i,j));
         }
 
-        std::function<double(double)> get_K(const std::function<double(double)>& Br) const
+        std::vector<std::vector<double> > compute_K_values() const
         {
-            return builder.build_retardation_function(Br,taus,1E-3,omega.front(),omega.back());
+            std::vector<std::vector<double> > ret;
+            for (size_t i = 0 ; i < 6 ; ++i)
+            {
+                for (size_t j = 0 ; j < 6 ; ++j)
+                {
+                    ret.push_back(builder.get_retardation_function_values(get_Br(i,j),taus,1E-3,omega.front(),omega.back()));
+                }
+            }
+            return ret;
         }
 
-        double get_convolution_for_axis(const size_t i, const BodyStates& states)
+        /**  \brief Retardation functions evaluated at each tau (row-major (i,j))
+          *  \details The cos transforms only depend on the HDB file & on the discretization so they can be shared
+          *           by all simulations using the same inputs (if the InputCache is enabled, eg. by xdyn-batch).
+          */
+        TR1(shared_ptr)<const std::vector<std::vector<double> > > get_K_values(const YamlRadiationDamping& yaml) const
+        {
+            const std::function<std::vector<std::vector<double> >()> compute = [this](){return compute_K_values();};
+            if (yaml.hdb_filename.empty())
+            {
+                return TR1(shared_ptr)<const std::vector<std::vector<double> > >(new std::vector<std::vector<double> >(compute()));
+            }
+            std::stringstream key;
+            key << std::setprecision(17) << yaml.hdb_filename << '|' << (int)yaml.type_of_quadrature_for_cos_transform << '|' << Tmin << '|' << Tmax << '|' << n;
+            return InputCache::tables(key.str(), compute);
+        }
+
+        double get_convolution_for_axis(const size_t i, const VelocityHistories& velocities, RadiationDampingForceModel::State& state) const
         {
             double K_X_dot = 0;
             for (size_t k = 0 ; k < 6 ; ++k)
             {
-                const History his = get_velocity_history_from_index(k, states);
-                if (his.get_duration() >= Tmin)
+                const History& his = *velocities[k];
+                if (use_recursive_convolution)
+                {
+                    K_X_dot += recursive_convolutions[6*i+k](his, state.recursive_convolutions[6*i+k]);
+                }
+                else if (use_retardation_grid)
+                {
+                    K_X_dot += state.resampled_velocities[k].convolution(K_on_grid[i][k]);
+                }
+                else if (his.get_duration() >= Tmin)
                 {
                     // Integrate up to Tmax if possible, but never exceed the history length
                     const double co = builder.convolution(his, K[i][k], Tmin, std::min(Tmax, his.get_duration()));
@@ -147,31 +260,27 @@ class RadiationDampingForceModel::Impl
             return K_X_dot;
         }
 
-        History get_velocity_history_from_index(const size_t i, const BodyStates& states) const
+        VelocityHistories get_velocity_histories(const BodyStates& states) const
         {
-            switch(i)
-            {
-                case 0: return states.u;
-                case 1: return states.v;
-                case 2: return states.w;
-                case 3: return states.p;
-                case 4: return states.q;
-                case 5: return states.r;
-                default: return History();
-            }
+            return {{&states.u, &states.v, &states.w, &states.p, &states.q, &states.r}};
         }
 
-        ssc::kinematics::Wrench get_wrench(const BodyStates& states)
+        ssc::kinematics::Wrench get_wrench(const BodyStates& states, RadiationDampingForceModel::State& state) const
         {
             ssc::kinematics::Vector6d W;
-            const ssc::kinematics::Point H(states.name,H0);
-
-            W(0) = -get_convolution_for_axis(0, states);
-            W(1) = -get_convolution_for_axis(1, states);
-            W(2) = -get_convolution_for_axis(2, states);
-            W(3) = -get_convolution_for_axis(3, states);
-            W(4) = -get_convolution_for_axis(4, states);
-            W(5) = -get_convolution_for_axis(5, states);
+            const VelocityHistories velocities = get_velocity_histories(states);
+            if (use_retardation_grid)
+            {
+                // Resampled once & shared by all six axes
+                for (size_t k = 0 ; k < 6 ; ++k) state.resampled_velocities[k].resample(*velocities[k], Tmax);
+            }
+
+            W(0) = -get_convolution_for_axis(0, velocities, state);
+            W(1) = -get_convolution_for_axis(1, velocities, state);
+            W(2) = -get_convolution_for_axis(2, velocities, state);
+            W(3) = -get_convolution_for_axis(3, velocities, state);
+            W(4) = -get_convolution_for_axis(4, velocities, state);
+            W(5) = -get_convolution_for_axis(5, velocities, state);
             return ssc::kinematics::Wrench(states.name,W);
         }
 
@@ -182,7 +291,7 @@ class RadiationDampingForceModel::Impl
 
     private:
         Impl();
-        TR1(shared_ptr)<HDBParser> hdb;
+        TR1(shared_ptr)<const HDBParser> hdb;
         RadiationDampingBuilder builder;
         std::array<std::array<std::function<double(double)>,6>, 6> K;
         std::vector<double> omega;
@@ -191,11 +300,15 @@ class RadiationDampingForceModel::Impl
         double Tmin;
         double Tmax;
         Eigen::Vector3d H0;
+        bool use_recursive_convolution;
+        std::vector<RecursiveConvolution> recursive_convolutions; //!< Row-major (i,k)
+        bool use_retardation_grid;
+        std::array<std::array<std::vector<double>,6>, 6> K_on_grid; //!< Retardation functions evaluated at each tau
 };
 
 
 RadiationDampingForceModel::RadiationDampingForceModel(const RadiationDampingForceModel::Input& input, const std::string& body_name_, const EnvironmentAndFrames& ) : ForceModel("radiation damping", body_name_),
-pimpl(new Impl(input.hdb, input.yaml))
+pimpl(new Impl(input.hdb, input.yaml)), state(new State(pimpl->get_initial_state()))
 {
 }
 
@@ -206,7 +319,7 @@ double RadiationDampingForceModel::get_Tmax() const
 
 ssc::kinematics::Wrench RadiationDampingForceModel::operator()(const BodyStates& states, const double ) const
 {
-    return pimpl->get_wrench(states);
+    return pimpl->get_wrench(states, *state);
 }
 
 TypeOfQuadrature parse_type_of_quadrature_(const std::string& s);
@@ -219,9 +332,11 @@ TypeOfQuadrature parse_type_of_quadrature_(const std::string& s)
     else if (s == "burcher")         return TypeOfQuadrature::BURCHER;
     else if (s == "clenshaw-curtis") return TypeOfQuadrature::CLENSHAW_CURTIS;
     else if (s == "filon")           return TypeOfQuadrature::FILON;
+    else if (s == "prony")           return TypeOfQuadrature::PRONY;
+    else if (s == "retardation grid") return TypeOfQuadrature::RETARDATION_GRID;
     else
     {
-        THROW(__PRETTY_FUNCTION__, InvalidInputException, "Unkown quadrature type: " << s << ". Should be one of 'gauss-kronrod', 'rectangle', ' simpson', 'trapezoidal', 'burcher', 'clenshaw-curtis' or 'filon'.";);
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "Unkown quadrature type: " << s << ". Should be one of 'gauss-kronrod', 'rectangle', ' simpson', 'trapezoidal', 'burcher', 'clenshaw-curtis', 'filon', 'prony' (convolution only) or 'retardation grid' (convolution only).";);
     }
     return TypeOfQuadrature::FILON;
 }
@@ -239,9 +354,17 @@ RadiationDampingForceModel::Input RadiationDampingForceModel::parse(const std::s
     std::string s;
     node["type of quadrature for cos transform"] >> s;
     input.type_of_quadrature_for_cos_transform = parse_type_of_quadrature_(s);
+    if ((input.type_of_quadrature_for_cos_transform == TypeOfQuadrature::PRONY) or (input.type_of_quadrature_for_cos_transform == TypeOfQuadrature::RETARDATION_GRID))
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "'" << s << "' can only be used for 'type of quadrature for convolution', not for 'type of quadrature for cos transform'.");
+    }
     node["type of quadrature for convolution"] >> s;
     input.type_of_quadrature_for_convolution = parse_type_of_quadrature_(s);
     node["nb of points for retardation function discretization"] >> input.nb_of_points_for_retardation_function_discretization;
+    if (const YAML::Node* nb_of_exponentials = node.FindValue("nb of exponentials for prony"))
+    {
+        *nb_of_exponentials >> input.nb_of_exponentials_for_prony;
+    }
     ssc::yaml_parser::parse_uv(node["omega min"], input.omega_min);
     ssc::yaml_parser::parse_uv(node["omega max"], input.omega_max);
     ssc::yaml_parser::parse_uv(node["tau min"], input.tau_min);
@@ -250,8 +373,7 @@ RadiationDampingForceModel::Input RadiationDampingForceModel::parse(const std::s
     node["calculation point in body frame"] >> input.calculation_point_in_body_frame;
     if (parse_hdb)
     {
-        const TR1(shared_ptr)<HDBParser> hdb(new HDBParser(ssc::text_file_reader::TextFileReader(std::vector<std::string>(1,input.hdb_filename)).get_contents()));
-        ret.hdb = hdb;
+        ret.hdb = InputCache::hdb(input.hdb_filename);
     }
     ret.yaml = input;
     return ret;
@@ -0,0 +1,342 @@
+/*
+ * maneuvering_bytecode.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <tuple>
+
+#include "maneuvering_bytecode.hpp"
+#include "InternalErrorException.hpp"
+#include "InvalidInputException.hpp"
+
+using namespace maneuvering;
+
+Instruction::Instruction() : op(OpCode::TIME), state(StateType::X), lhs(0), rhs(0), out(0)
+{
+}
+
+Instruction::Instruction(const OpCode op_, const StateType state_, const size_t lhs_, const size_t rhs_, const size_t out_) :
+        op(op_), state(state_), lhs(lhs_), rhs(rhs_), out(out_)
+{
+}
+
+namespace maneuvering
+{
+    // Used both by the evaluation & by the constant folding, so both give exactly the same results
+    inline double apply(const OpCode op, const double x, const double y);
+    inline double apply(const OpCode op, const double x, const double y)
+    {
+        switch(op)
+        {
+            case OpCode::COS:        return cos(x);
+            case OpCode::SIN:        return sin(x);
+            case OpCode::ABS:        return std::abs(x);
+            case OpCode::LOG:        return std::log(x);
+            case OpCode::EXP:        return std::exp(x);
+            case OpCode::SQRT:       return std::sqrt(x);
+            case OpCode::SUM:        return x + y;
+            case OpCode::DIFFERENCE: return x - y;
+            case OpCode::MULTIPLY:   return x * y;
+            case OpCode::DIVIDE:     return x / y;
+            case OpCode::POW:        return std::pow(x, y);
+            default:                 break;
+        }
+        return std::nan("");
+    }
+
+    double get_state(const BodyStates& states, const StateType s, const double tau, const YamlRotation& rot);
+    double get_state(const BodyStates& states, const StateType s, const double tau, const YamlRotation& rot)
+    {
+        switch(s)
+        {
+            case StateType::X :    return states.x(tau);
+            case StateType::Y :    return states.y(tau);
+            case StateType::Z :    return states.z(tau);
+            case StateType::U :    return states.u(tau);
+            case StateType::V :    return states.v(tau);
+            case StateType::W :    return states.w(tau);
+            case StateType::P :    return states.p(tau);
+            case StateType::Q :    return states.q(tau);
+            case StateType::R :    return states.r(tau);
+            case StateType::QR :   return states.qr(tau);
+            case StateType::QI :   return states.qi(tau);
+            case StateType::QJ :   return states.qj(tau);
+            case StateType::QK :   return states.qk(tau);
+            default:               break;
+        }
+        const ssc::kinematics::RotationMatrix R = Eigen::Quaternion<double>(states.qr(tau),states.qi(tau),states.qj(tau),states.qk(tau)).matrix();
+        const ssc::kinematics::EulerAngles angles = BodyStates::convert(R, rot);
+        if (s == StateType::PHI) return angles.phi;
+        if (s == StateType::THETA) return angles.theta;
+        return angles.psi;
+    }
+}
+
+Program::Program(const std::vector<Instruction>& instructions_, const std::vector<double>& registers_, const std::vector<size_t>& outputs_, const std::vector<std::string>& inputs_, const YamlRotation& rot_) :
+        instructions(instructions_),
+        outputs(outputs_),
+        inputs(inputs_),
+        rot(rot_),
+        registers(registers_)
+{
+}
+
+void Program::evaluate(const BodyStates& states, const double t, const std::vector<double>& input_values, std::vector<double>& ret) const
+{
+    if (input_values.size() != inputs.size())
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "Program expects " << inputs.size() << " inputs, but received " << input_values.size());
+    }
+    double* r = registers.data();
+    for (const auto& instruction:instructions)
+    {
+        switch(instruction.op)
+        {
+            case OpCode::TIME:  r[instruction.out] = t;                                                                       break;
+            case OpCode::INPUT: r[instruction.out] = input_values[instruction.lhs];                                           break;
+            case OpCode::STATE: r[instruction.out] = get_state(states, instruction.state, t - r[instruction.lhs], rot);       break;
+            default:            r[instruction.out] = apply(instruction.op, r[instruction.lhs], r[instruction.rhs]);          break;
+        }
+    }
+    ret.resize(outputs.size());
+    for (size_t i = 0 ; i < outputs.size() ; ++i) ret[i] = r[outputs[i]];
+}
+
+std::vector<std::string> Program::get_input_names() const
+{
+    return inputs;
+}
+
+size_t Program::get_nb_of_instructions() const
+{
+    return instructions.size();
+}
+
+size_t Program::get_nb_of_registers() const
+{
+    return registers.size();
+}
+
+namespace maneuvering
+{
+    class Lowering : public AbstractNodeVisitor
+    {
+        public:
+            Lowering(const std::map<std::string, NodePtr>& expressions_, const std::vector<std::string>& inputs_, const std::map<std::string, double>& parameters_) :
+                expressions(expressions_),
+                inputs(),
+                input_names(inputs_),
+                parameters(parameters_),
+                instructions(),
+                registers(),
+                is_constant(),
+                constants(),
+                already_computed(),
+                variables(),
+                being_resolved(),
+                result(0)
+            {
+                for (size_t i = 0 ; i < inputs_.size() ; ++i) inputs[inputs_[i]] = i;
+            }
+
+            size_t lower(const NodePtr& node)
+            {
+                node->accept(*this);
+                return result;
+            }
+
+            size_t lower(const std::string& name)
+            {
+                const auto it = variables.find(name);
+                if (it != variables.end()) return it->second;
+                const auto expression = expressions.find(name);
+                size_t ret = 0;
+                if (expression != expressions.end())
+                {
+                    if (being_resolved.count(name))
+                    {
+                        THROW(__PRETTY_FUNCTION__, InvalidInputException, "Circular definition in maneuvering model: '" << name << "' depends on itself.");
+                    }
+                    being_resolved.insert(name);
+                    ret = lower(expression->second);
+                    being_resolved.erase(name);
+                }
+                else if (inputs.count(name))
+                {
+                    ret = emit(OpCode::INPUT, StateType::X, inputs[name], 0);
+                }
+                else if (parameters.count(name))
+                {
+                    ret = constant(parameters.find(name)->second);
+                }
+                else
+                {
+                    // Can only be known at run time (eg. a command of another model)
+                    inputs[name] = input_names.size();
+                    input_names.push_back(name);
+                    ret = emit(OpCode::INPUT, StateType::X, inputs[name], 0);
+                }
+                variables[name] = ret;
+                return ret;
+            }
+
+            std::vector<Instruction> get_instructions() const
+            {
+                return instructions;
+            }
+
+            std::vector<double> get_registers() const
+            {
+                return registers;
+            }
+
+            std::vector<std::string> get_input_names() const
+            {
+                return input_names;
+            }
+
+            void visit(const UnknownIdentifier& f)
+            {
+                result = lower(f.get_name());
+            }
+
+            void visit(const Time& )
+            {
+                result = emit(OpCode::TIME, StateType::X, 0, 0);
+            }
+
+            void visit(const State<StateType::X>& f)     {result = state(StateType::X, f);}
+            void visit(const State<StateType::Y>& f)     {result = state(StateType::Y, f);}
+            void visit(const State<StateType::Z>& f)     {result = state(StateType::Z, f);}
+            void visit(const State<StateType::U>& f)     {result = state(StateType::U, f);}
+            void visit(const State<StateType::V>& f)     {result = state(StateType::V, f);}
+            void visit(const State<StateType::W>& f)     {result = state(StateType::W, f);}
+            void visit(const State<StateType::P>& f)     {result = state(StateType::P, f);}
+            void visit(const State<StateType::Q>& f)     {result = state(StateType::Q, f);}
+            void visit(const State<StateType::R>& f)     {result = state(StateType::R, f);}
+            void visit(const State<StateType::PHI>& f)   {result = state(StateType::PHI, f);}
+            void visit(const State<StateType::THETA>& f) {result = state(StateType::THETA, f);}
+            void visit(const State<StateType::PSI>& f)   {result = state(StateType::PSI, f);}
+            void visit(const State<StateType::QR>& f)    {result = state(StateType::QR, f);}
+            void visit(const State<StateType::QI>& f)    {result = state(StateType::QI, f);}
+            void visit(const State<StateType::QJ>& f)    {result = state(StateType::QJ, f);}
+            void visit(const State<StateType::QK>& f)    {result = state(StateType::QK, f);}
+
+            void visit(const Binary& f)
+            {
+                const auto children = f.get_children();
+                const size_t lhs = lower(children.at(0));
+                const size_t rhs = lower(children.at(1));
+                result = emit(get_opcode(f), StateType::X, lhs, rhs);
+            }
+
+            void visit(const Unary& f)
+            {
+                const size_t operand = lower(f.get_operand());
+                result = emit(get_opcode(f), StateType::X, operand, operand);
+            }
+
+            void visit(const Constant& f)
+            {
+                result = constant(f.get_max());
+            }
+
+        private:
+            Lowering();
+
+            size_t state(const StateType s, const Unary& f)
+            {
+                return emit(OpCode::STATE, s, lower(f.get_operand()), 0);
+            }
+
+            size_t constant(const double val)
+            {
+                std::uint64_t bits;
+                std::memcpy(&bits, &val, sizeof(double));
+                const auto it = constants.find(bits);
+                if (it != constants.end()) return it->second;
+                registers.push_back(val);
+                is_constant.push_back(true);
+                constants[bits] = registers.size()-1;
+                return registers.size()-1;
+            }
+
+            size_t emit(const OpCode op, const StateType s, const size_t lhs, const size_t rhs)
+            {
+                const bool depends_on_time_states_or_inputs = (op == OpCode::TIME) or (op == OpCode::INPUT) or (op == OpCode::STATE);
+                if (not(depends_on_time_states_or_inputs) and is_constant.at(lhs) and is_constant.at(rhs))
+                {
+                    return constant(apply(op, registers[lhs], registers[rhs]));
+                }
+                const auto key = std::make_tuple((int)op, (int)s, lhs, rhs);
+                const auto it = already_computed.find(key);
+                if (it != already_computed.end()) return it->second;
+                registers.push_back(0);
+                is_constant.push_back(false);
+                instructions.push_back(Instruction(op, s, lhs, rhs, registers.size()-1));
+                already_computed[key] = registers.size()-1;
+                return registers.size()-1;
+            }
+
+            OpCode get_opcode(const Unary& f) const
+            {
+                if (dynamic_cast<const Cos*>(&f))  return OpCode::COS;
+                if (dynamic_cast<const Sin*>(&f))  return OpCode::SIN;
+                if (dynamic_cast<const Abs*>(&f))  return OpCode::ABS;
+                if (dynamic_cast<const Log*>(&f))  return OpCode::LOG;
+                if (dynamic_cast<const Exp*>(&f))  return OpCode::EXP;
+                if (dynamic_cast<const Sqrt*>(&f)) return OpCode::SQRT;
+                THROW(__PRETTY_FUNCTION__, InternalErrorException, "Unary operator cannot be converted to bytecode");
+                return OpCode::TIME;
+            }
+
+            OpCode get_opcode(const Binary& f) const
+            {
+                if (dynamic_cast<const Sum*>(&f))        return OpCode::SUM;
+                if (dynamic_cast<const Difference*>(&f)) return OpCode::DIFFERENCE;
+                if (dynamic_cast<const Multiply*>(&f))   return OpCode::MULTIPLY;
+                if (dynamic_cast<const Divide*>(&f))     return OpCode::DIVIDE;
+                if (dynamic_cast<const Pow*>(&f))        return OpCode::POW;
+                THROW(__PRETTY_FUNCTION__, InternalErrorException, "Binary operator cannot be converted to bytecode");
+                return OpCode::TIME;
+            }
+
+            std::map<std::string, NodePtr> expressions;
+            std::map<std::string, size_t> inputs;
+            std::vector<std::string> input_names;
+            std::map<std::string, double> parameters;
+            std::vector<Instruction> instructions;
+            std::vector<double> registers;
+            std::vector<bool> is_constant;
+            std::map<std::uint64_t, size_t> constants;                            //!< Bit pattern of the constant -> register (so NaN constants are shared too)
+            std::map<std::tuple<int,int,size_t,size_t>, size_t> already_computed; //!< Common sub-expression elimination
+            std::map<std::string, size_t> variables;
+            std::set<std::string> being_resolved;
+            size_t result;
+    };
+}
+
+Program maneuvering::build_program(const std::map<std::string, NodePtr>& expressions,
+                                   const std::vector<std::string>& outputs,
+                                   const std::vector<std::string>& inputs,
+                                   const std::map<std::string, double>& parameters,
+                                   const YamlRotation& rot)
+{
+    Lowering lowering(expressions, inputs, parameters);
+    std::vector<size_t> output_registers;
+    for (const auto& output:outputs)
+    {
+        if (expressions.find(output) == expressions.end())
+        {
+            THROW(__PRETTY_FUNCTION__, InvalidInputException, "Maneuvering model does not define '" << output << "'.");
+        }
+        output_registers.push_back(lowering.lower(output));
+    }
+    return Program(lowering.get_instructions(), lowering.get_registers(), output_registers, lowering.get_input_names(), rot);
+}
@@ -0,0 +1,25 @@
+/*
+ * maneuvering_bytecodeTest.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+
+#ifndef MANEUVERING_BYTECODETEST_HPP_
+#define MANEUVERING_BYTECODETEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator/DataGenerator.hpp>
+
+class maneuvering_bytecodeTest : public ::testing::Test
+{
+    protected:
+        maneuvering_bytecodeTest();
+        virtual ~maneuvering_bytecodeTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif  /* MANEUVERING_BYTECODETEST_HPP_ */
@@ -9,6 +9,8 @@
 #include "BodyWithSurfaceForces.hpp"
 #include "DefaultSurfaceElevation.hpp"
 #include "FroudeKrylovForceModel.hpp"
+#include "FastHydrostaticForceModel.hpp"
+#include "ThreadPool.hpp"
 #include "generate_body_for_tests.hpp"
 #include "TriMeshTestData.hpp"
 #include "MeshIntersector.hpp"
@@ -22,6 +24,8 @@
 #include "YamlWaveModelInput.hpp"
 #include "Stretching.hpp"
 
+#include <thread>
+
 #define _USE_MATH_DEFINE
 #include <cmath>
 #define PI M_PI
@@ -43,6 +47,42 @@ void FroudeKrylovForceModelTest::SetUp()
 
 void FroudeKrylovForceModelTest::TearDown()
 {
+    ThreadPool::set_nb_of_threads(std::thread::hardware_concurrency());
+}
+
+namespace
+{
+    // Cube of edge 1 centred on the origin, each face being split in 2*n*n triangles oriented outwards
+    VectorOfVectorOfPoints finely_meshed_cube(const size_t n)
+    {
+        VectorOfVectorOfPoints mesh;
+        const double h = 1./(double)n;
+        for (size_t axis = 0 ; axis < 3 ; ++axis)
+        {
+            for (const double side:{-1., 1.})
+            {
+                EPoint normal(0,0,0);
+                normal(axis) = side;
+                EPoint u(0,0,0);
+                u((axis+1)%3) = 1;
+                const EPoint v = normal.cross(u); // So u x v = normal
+                const EPoint origin = 0.5*(normal - u - v);
+                for (size_t i = 0 ; i < n ; ++i)
+                {
+                    for (size_t j = 0 ; j < n ; ++j)
+                    {
+                        const EPoint P00 = origin + (double)i*h*u + (double)j*h*v;
+                        const EPoint P10 = P00 + h*u;
+                        const EPoint P11 = P10 + h*v;
+                        const EPoint P01 = P00 + h*v;
+                        mesh.push_back(VectorOfPoints({P00, P10, P11}));
+                        mesh.push_back(VectorOfPoints({P00, P11, P01}));
+                    }
+                }
+            }
+        }
+        return mesh;
+    }
 }
 
 TR1(shared_ptr)<WaveModel> FroudeKrylovForceModelTest::get_wave_model() const
@@ -183,3 +223,47 @@ TEST_F(FroudeKrylovForceModelTest, validation_against_sos_stab)
     ASSERT_NEAR(0, Ffk.M(), EPS);
     ASSERT_NEAR(0, Ffk.N(), EPS);
 }
+
+TEST_F(FroudeKrylovForceModelTest, wrenches_should_not_depend_on_the_number_of_threads)
+{
+    const EnvironmentAndFrames env = get_environment_and_frames(get_wave_model());
+    // 800 facets on the immersed face alone, so the sums are split in several chunks
+    const VectorOfVectorOfPoints points = finely_meshed_cube(20);
+    ASSERT_LT(2*FACETS_PER_CHUNK, points.size()/6);
+
+    BodyStates states = get_body(BODY, points)->get_states();
+    states.G = ssc::kinematics::Point("NED",0.1,-0.2,0.05);
+    BodyPtr body(new BodyWithSurfaceForces(states, 0, BlockedDOF("")));
+    const double t = 2.5;
+    body->update_intersection_with_free_surface(env, t);
+
+    const FroudeKrylovForceModel Ffk(BODY, env);
+    const FastHydrostaticForceModel Fhs(BODY, env);
+    ThreadPool::set_nb_of_threads(1);
+    const ssc::kinematics::Wrench fk = Ffk(body->get_states(), t);
+    const ssc::kinematics::Wrench hs = Fhs(body->get_states(), t);
+    ASSERT_NE(0, fk.X());
+    ASSERT_NE(0, hs.Z());
+    for (size_t nb_of_threads = 2 ; nb_of_threads < 6 ; ++nb_of_threads)
+    {
+        ThreadPool::set_nb_of_threads(nb_of_threads);
+        for (size_t i = 0 ; i < 3 ; ++i)
+        {
+            const ssc::kinematics::Wrench fk_n = Ffk(body->get_states(), t);
+            const ssc::kinematics::Wrench hs_n = Fhs(body->get_states(), t);
+            // Exact equality: the chunks are always summed in the same order
+            ASSERT_EQ(fk.X(), fk_n.X()) << "nb_of_threads = " << nb_of_threads;
+            ASSERT_EQ(fk.Y(), fk_n.Y()) << "nb_of_threads = " << nb_of_threads;
+            ASSERT_EQ(fk.Z(), fk_n.Z()) << "nb_of_threads = " << nb_of_threads;
+            ASSERT_EQ(fk.K(), fk_n.K()) << "nb_of_threads = " << nb_of_threads;
+            ASSERT_EQ(fk.M(), fk_n.M()) << "nb_of_threads = " << nb_of_threads;
+            ASSERT_EQ(fk.N(), fk_n.N()) << "nb_of_threads = " << nb_of_threads;
+            ASSERT_EQ(hs.X(), hs_n.X()) << "nb_of_threads = " << nb_of_threads;
+            ASSERT_EQ(hs.Y(), hs_n.Y()) << "nb_of_threads = " << nb_of_threads;
+            ASSERT_EQ(hs.Z(), hs_n.Z()) << "nb_of_threads = " << nb_of_threads;
+            ASSERT_EQ(hs.K(), hs_n.K()) << "nb_of_threads = " << nb_of_threads;
+            ASSERT_EQ(hs.M(), hs_n.M()) << "nb_of_threads = " << nb_of_threads;
+            ASSERT_EQ(hs.N(), hs_n.N()) << "nb_of_threads = " << nb_of_threads;
+        }
+    }
+}
@@ -11,6 +11,7 @@
 
 #include <ssc/integrate.hpp>
 
+#include "allocation_counter.hpp"
 #include "BodyStates.hpp"
 #include "hdb_data.hpp"
 #include "hdb_test.hpp"
@@ -18,6 +19,7 @@
 #include "RadiationDampingForceModel.hpp"
 #include "RadiationDampingForceModelTest.hpp"
 #include "EnvironmentAndFrames.hpp"
+#include "InvalidInputException.hpp"
 #include "yaml_data.hpp"
 
 #define EPS 5E-2
@@ -80,6 +82,35 @@ TEST_F(RadiationDampingForceModelTest, parser)
     ASSERT_DOUBLE_EQ(1.418, r.calculation_point_in_body_frame.z);
 }
 
+TEST_F(RadiationDampingForceModelTest, can_parse_prony_convolution)
+{
+    std::string yaml = test_data::radiation_damping();
+    yaml.replace(yaml.find("clenshaw-curtis"), std::string("clenshaw-curtis").size(), "prony");
+    YamlRadiationDamping r = RadiationDampingForceModel::parse(yaml,false).yaml;
+    ASSERT_EQ(TypeOfQuadrature::PRONY, r.type_of_quadrature_for_convolution);
+    ASSERT_EQ(8, r.nb_of_exponentials_for_prony);
+    yaml += "nb of exponentials for prony: 12\n";
+    r = RadiationDampingForceModel::parse(yaml,false).yaml;
+    ASSERT_EQ(12, r.nb_of_exponentials_for_prony);
+}
+
+TEST_F(RadiationDampingForceModelTest, prony_cannot_be_used_for_the_cos_transform)
+{
+    std::string yaml = test_data::radiation_damping();
+    yaml.replace(yaml.find("simpson"), std::string("simpson").size(), "prony");
+    ASSERT_THROW(RadiationDampingForceModel::parse(yaml,false), InvalidInputException);
+}
+
+TEST_F(RadiationDampingForceModelTest, can_parse_retardation_grid_convolution)
+{
+    std::string yaml = test_data::radiation_damping();
+    yaml.replace(yaml.find("clenshaw-curtis"), std::string("clenshaw-curtis").size(), "retardation grid");
+    const YamlRadiationDamping r = RadiationDampingForceModel::parse(yaml,false).yaml;
+    ASSERT_EQ(TypeOfQuadrature::RETARDATION_GRID, r.type_of_quadrature_for_convolution);
+    yaml.replace(yaml.find("simpson"), std::string("simpson").size(), "retardation grid");
+    ASSERT_THROW(RadiationDampingForceModel::parse(yaml,false), InvalidInputException);
+}
+
 void record(BodyStates& states, const double t, const double value);
 void record(BodyStates& states, const double t, const double value)
 {
@@ -227,3 +258,90 @@ TEST_F(RadiationDampingForceModelTest, matrix_product_should_be_done_properly)
     ASSERT_NEAR(conv * (51*u0 + 52*v0 + 53*w0 + 54*p0 + 55*q0 + 56*r0), Frad.M(), 10*EPS);
     ASSERT_NEAR(conv * (61*u0 + 62*v0 + 63*w0 + 64*p0 + 65*q0 + 66*r0), Frad.N(), 10*EPS);
 }
+
+TEST_F(RadiationDampingForceModelTest, recursive_convolution_should_be_close_to_quadrature)
+{
+    RadiationDampingForceModel::Input input;
+    input.hdb = get_hdb_data();
+    input.yaml = get_yaml_data(false);
+    // Retardation function must have decayed at tau max because the recursive convolution does not truncate it
+    input.yaml.tau_max = 60;
+    input.yaml.nb_of_points_for_retardation_function_discretization = 100;
+    const RadiationDampingForceModel F_quadrature(input, "", EnvironmentAndFrames());
+    input.yaml.type_of_quadrature_for_convolution = TypeOfQuadrature::PRONY;
+    std::stringstream debug;
+    std::streambuf* orig = std::cerr.rdbuf(debug.rdbuf());
+    const RadiationDampingForceModel F_prony(input, "", EnvironmentAndFrames());
+    std::cerr.rdbuf(orig);
+    ASSERT_NE(std::string::npos, debug.str().find("Prony approximation"));
+    BodyStates states(100);
+    for (size_t i = 0 ; i <= 1000 ; ++i)
+    {
+        const double t = (double)i*0.1;
+        record(states, t, cos(0.3*t), sin(0.2*t), 1, 0, 0, 0);
+    }
+    const auto F1 = F_quadrature(states, 100);
+    const auto F2 = F_prony(states, 100);
+    ASSERT_NEAR(F1.X(), F2.X(), 2E-2*std::abs(F1.X()));
+    ASSERT_NEAR(F1.Y(), F2.Y(), 2E-2*std::abs(F1.Y()));
+    ASSERT_NEAR(F1.Z(), F2.Z(), 2E-2*std::abs(F1.Z()));
+}
+
+TEST_F(RadiationDampingForceModelTest, retardation_grid_convolution_should_be_close_to_quadrature)
+{
+    RadiationDampingForceModel::Input input;
+    input.hdb = get_hdb_data();
+    input.yaml = get_yaml_data(false);
+    input.yaml.nb_of_points_for_retardation_function_discretization = 200;
+    const RadiationDampingForceModel F_quadrature(input, "", EnvironmentAndFrames());
+    input.yaml.type_of_quadrature_for_convolution = TypeOfQuadrature::RETARDATION_GRID;
+    const RadiationDampingForceModel F_grid(input, "", EnvironmentAndFrames());
+    BodyStates states(100);
+    for (size_t i = 0 ; i <= 1000 ; ++i)
+    {
+        const double t = (double)i*0.1;
+        record(states, t, cos(0.3*t), sin(0.2*t), 1, 0, 0, 0);
+        if (i % 37 == 0)
+        {
+            const auto F1 = F_quadrature(states, t);
+            const auto F2 = F_grid(states, t);
+            ASSERT_NEAR(F1.X(), F2.X(), 1E-2*(1+std::abs(F1.X()))) << "t = " << t;
+            ASSERT_NEAR(F1.Y(), F2.Y(), 1E-2*(1+std::abs(F1.Y()))) << "t = " << t;
+            ASSERT_NEAR(F1.Z(), F2.Z(), 1E-2*(1+std::abs(F1.Z()))) << "t = " << t;
+        }
+    }
+}
+
+TEST_F(RadiationDampingForceModelTest, evaluating_the_force_should_not_allocate_any_memory)
+{
+    RadiationDampingForceModel::Input input;
+    input.hdb = get_hdb_data();
+    input.yaml = get_yaml_data(false);
+    input.yaml.type_of_quadrature_for_convolution = TypeOfQuadrature::RETARDATION_GRID;
+    const RadiationDampingForceModel F_grid(input, "", EnvironmentAndFrames());
+    input.yaml.type_of_quadrature_for_convolution = TypeOfQuadrature::PRONY;
+    input.yaml.nb_of_exponentials_for_prony = 4;
+    std::stringstream debug;
+    std::streambuf* orig = std::cerr.rdbuf(debug.rdbuf());
+    const RadiationDampingForceModel F_prony(input, "", EnvironmentAndFrames());
+    std::cerr.rdbuf(orig);
+    BodyStates states(100);
+    for (size_t i = 0 ; i <= 200 ; ++i)
+    {
+        const double t = (double)i*0.1;
+        record(states, t, cos(0.3*t), sin(0.2*t), 1, 0, 0, 0);
+    }
+    //! [RadiationDampingForceModelTest allocation_counter_example]
+    size_t nb_of_allocations_for_grid = 0;
+    size_t nb_of_allocations_for_prony = 0;
+    {
+        const AllocationCounter counter;
+        F_grid(states, 20);
+        nb_of_allocations_for_grid = counter.get_nb_of_allocations();
+        F_prony(states, 20);
+        nb_of_allocations_for_prony = counter.get_nb_of_allocations() - nb_of_allocations_for_grid;
+    }
+    ASSERT_EQ(0, nb_of_allocations_for_grid);
+    ASSERT_EQ(0, nb_of_allocations_for_prony);
+    //! [RadiationDampingForceModelTest allocation_counter_example]
+}
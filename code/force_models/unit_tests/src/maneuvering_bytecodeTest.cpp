@@ -0,0 +1,122 @@
+/*
+ * maneuvering_bytecodeTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+
+#include "maneuvering_bytecodeTest.hpp"
+#include "maneuvering_bytecode.hpp"
+#include "maneuvering_compiler.hpp"
+#include "InvalidInputException.hpp"
+
+maneuvering_bytecodeTest::maneuvering_bytecodeTest() : a(ssc::random_data_generator::DataGenerator(8754))
+{
+}
+
+maneuvering_bytecodeTest::~maneuvering_bytecodeTest()
+{
+}
+
+void maneuvering_bytecodeTest::SetUp()
+{
+}
+
+void maneuvering_bytecodeTest::TearDown()
+{
+}
+
+TEST_F(maneuvering_bytecodeTest, example)
+{
+//! [maneuvering_bytecodeTest example]
+    std::map<std::string, maneuvering::NodePtr> m;
+    m["X"] = maneuvering::compile("2*Y+sqrt(x(t))", YamlRotation());
+    m["Y"] = maneuvering::compile("y(t)^2", YamlRotation());
+    const auto program = maneuvering::build_program(m, {"X","Y"}, {}, {}, YamlRotation());
+
+    BodyStates states;
+    states.x.record(10, 1024);
+    states.y.record(10, 400);
+    std::vector<double> outputs;
+    program.evaluate(states, 10, {}, outputs);
+//! [maneuvering_bytecodeTest example]
+//! [maneuvering_bytecodeTest expected output]
+    ASSERT_EQ(2, outputs.size());
+    ASSERT_DOUBLE_EQ(320032, outputs[0]);
+    ASSERT_DOUBLE_EQ(160000, outputs[1]);
+//! [maneuvering_bytecodeTest expected output]
+}
+
+TEST_F(maneuvering_bytecodeTest, constant_sub_expressions_are_only_evaluated_once)
+{
+    std::map<std::string, maneuvering::NodePtr> m;
+    m["X"] = maneuvering::compile("0.5*rho*L^2", YamlRotation());
+    m["L"] = maneuvering::compile("2*3", YamlRotation());
+    std::map<std::string, double> parameters;
+    parameters["rho"] = 1000;
+    const auto program = maneuvering::build_program(m, {"X"}, {}, parameters, YamlRotation());
+    ASSERT_EQ(0, program.get_nb_of_instructions());
+    std::vector<double> outputs;
+    program.evaluate(BodyStates(), a.random<double>(), {}, outputs);
+    ASSERT_DOUBLE_EQ(18000, outputs.at(0));
+}
+
+TEST_F(maneuvering_bytecodeTest, common_sub_expressions_are_only_evaluated_once)
+{
+    std::map<std::string, maneuvering::NodePtr> m;
+    m["X"] = maneuvering::compile("u(t)*abs(u(t))", YamlRotation());
+    m["Y"] = maneuvering::compile("2*u(t)*abs(u(t)) + u_", YamlRotation());
+    m["u_"] = maneuvering::compile("u(t)", YamlRotation());
+    const auto program = maneuvering::build_program(m, {"X","Y"}, {}, {}, YamlRotation());
+    // t, u(t), abs(u(t)), u(t)*abs(u(t)), 2*u(t), 2*u(t)*abs(u(t)) & the sum
+    ASSERT_EQ(7, program.get_nb_of_instructions());
+    BodyStates states;
+    states.u.record(0, -3);
+    states.u.record(10, 5);
+    std::vector<double> outputs;
+    program.evaluate(states, 10, {}, outputs);
+    ASSERT_DOUBLE_EQ(25, outputs.at(0));
+    ASSERT_DOUBLE_EQ(55, outputs.at(1));
+}
+
+TEST_F(maneuvering_bytecodeTest, commands_are_read_from_the_inputs)
+{
+    std::map<std::string, maneuvering::NodePtr> m;
+    m["X"] = maneuvering::compile("beta*x(t-5) + 2*alpha", YamlRotation());
+    const auto program = maneuvering::build_program(m, {"X"}, {"alpha", "beta"}, {}, YamlRotation());
+    BodyStates states;
+    states.x.record(0, 1);
+    states.x.record(5, 3);
+    states.x.record(10, 7);
+    std::vector<double> outputs;
+    program.evaluate(states, 10, {4, 100}, outputs);
+    ASSERT_DOUBLE_EQ(308, outputs.at(0));
+    program.evaluate(states, 10, {1, 10}, outputs);
+    ASSERT_DOUBLE_EQ(32, outputs.at(0));
+}
+
+TEST_F(maneuvering_bytecodeTest, unknown_identifiers_are_appended_to_the_inputs)
+{
+    std::map<std::string, maneuvering::NodePtr> m;
+    m["X"] = maneuvering::compile("2*foo + bar + g", YamlRotation());
+    m["Y"] = maneuvering::compile("baz", YamlRotation()); // Not an output: ignored
+    std::map<std::string, double> parameters;
+    parameters["g"] = 9.81;
+    const auto program = maneuvering::build_program(m, {"X"}, {"bar", "a"}, parameters, YamlRotation());
+    const std::vector<std::string> expected_inputs = {"bar", "a", "foo"};
+    ASSERT_EQ(expected_inputs, program.get_input_names());
+    std::vector<double> outputs;
+    program.evaluate(BodyStates(), 0, {1, 2, 3}, outputs);
+    ASSERT_DOUBLE_EQ(16.81, outputs.at(0));
+    ASSERT_THROW(maneuvering::build_program(m, {"Z"}, {}, {}, YamlRotation()), InvalidInputException);
+}
+
+TEST_F(maneuvering_bytecodeTest, circular_definitions_are_detected_when_building_the_program)
+{
+    std::map<std::string, maneuvering::NodePtr> m;
+    m["X"] = maneuvering::compile("2*A", YamlRotation());
+    m["A"] = maneuvering::compile("u(t)+B", YamlRotation());
+    m["B"] = maneuvering::compile("sin(A)", YamlRotation());
+    ASSERT_THROW(maneuvering::build_program(m, {"X"}, {}, {}, YamlRotation()), InvalidInputException);
+}
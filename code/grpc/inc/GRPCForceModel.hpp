@@ -24,18 +24,20 @@ class GRPCForceModel : public ControllableForceModel
         };
         GRPCForceModel(const Input& input, const std::string& body_name, const EnvironmentAndFrames& env);
         ssc::kinematics::Vector6d get_force(const BodyStates& states, const double t, const std::map<std::string,double>& commands) const;
+        bool computes_force_asynchronously() const;
         static Input parse(const std::string& yaml);
         static std::string model_name();
         double get_Tmax() const;
 
     private:
         void extra_observations(Observer& observer) const;
+        void start_force(const BodyStates& states, const double t, const std::map<std::string,double>& commands);
         GRPCForceModel(); // Disabled
         class Impl;
         TR1(shared_ptr)<Impl> pimpl;
         GRPCForceModel(const TR1(shared_ptr)<Impl>& pimpl, const std::string& body_name, const EnvironmentAndFrames& env);
         EnvironmentAndFrames env;
-
+        mutable std::map<std::string,DataAddressing> extra_observations_addressing; //!< Built as the model returns new extra observations
 };
 
 
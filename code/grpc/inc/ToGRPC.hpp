@@ -26,10 +26,17 @@ class ToGRPC
         SpectrumResponse* from_discrete_directional_wave_spectra(const std::vector<DiscreteDirectionalWaveSpectrum>& spectra) const;
         WaveInformation* from_wave_information(const WaveRequest& wave_request, const double t, const EnvironmentAndFrames& env) const;
         States* from_state(const BodyStates& state, const double max_history_length, const EnvironmentAndFrames& env) const;
+        /**  \brief Only the samples of the history recorded at or after t0 (for the deltas sent by ForceStreamRequest)
+          */
+        States* from_state_since(const BodyStates& state, const double t0, const EnvironmentAndFrames& env) const;
         ForceRequest from_force_request(States* states, const std::map<std::string, double >& commands, WaveInformation* wave_information, const std::string& instance_name) const;
+        ForceStreamRequest from_force_stream_request(States* new_states, const bool reset_history, const std::map<std::string, double >& commands, WaveInformation* wave_information, const std::string& instance_name) const;
         SetForceParameterRequest from_yaml(const std::string& yaml, const std::string body_name, const std::string& instance_name) const;
 
     private:
+        /**  \brief Samples first, first+1, ..., state.x.size()-1 of the history
+          */
+        States* from_samples(const BodyStates& state, const int first, const EnvironmentAndFrames& env) const;
         void copy_from_double_vector(const std::vector<double>& origin, ::google::protobuf::RepeatedField< double >* destination) const;
         void copy_from_string_vector(const std::vector<std::string>& origin, ::google::protobuf::RepeatedPtrField< std::string >* destination) const;
         GRPCForceModel::Input input;
@@ -150,10 +150,42 @@ class GRPCForceModel::Impl
             , from_grpc(FromGRPC())
             , commands()
             , force_frame()
+            , use_force_stream(false)
+            , stream_context()
+            , stream()
+            , has_sent_states(false)
+            , last_sent_date()
+            , last_sent_revision(0)
+            , next_wave_request()
+            , has_next_wave_request(false)
+            , stream_write_failed(false)
+            , completion_queue()
+            , pending_request()
+            , has_pending_force(false)
+            , pending_force_date()
         {
             set_parameters(input.yaml, body_name, input.name);
         }
 
+        ~Impl()
+        {
+            try
+            {
+                if (has_pending_force) wait_for_force();
+            }
+            catch (...)
+            {
+                // The result was not needed anyway
+            }
+            close_stream();
+            completion_queue.Shutdown();
+            void* tag = nullptr;
+            bool ok = false;
+            while (completion_queue.Next(&tag, &ok))
+            {
+            }
+        }
+
         GRPCForceModel::Input get_input() const
         {
             return input;
@@ -176,6 +208,7 @@ class GRPCForceModel::Impl
             force_frame.coordinates.x = response.x();
             force_frame.coordinates.y = response.y();
             force_frame.coordinates.z = response.z();
+            use_force_stream = response.use_force_stream();
         }
 
         WaveRequest required_wave_information(const double t, const double x, const double y, const double z) const
@@ -188,16 +221,35 @@ class GRPCForceModel::Impl
             return from_grpc.to_wave_request(response);
         }
 
+        /**  \brief Sends the request without waiting for the response (retrieved by the next call to 'force' at the same instant)
+          */
+        void start(const double t, const BodyStates& state, const std::map<std::string,double>& commands, const EnvironmentAndFrames& env, const std::string& instance_name)
+        {
+            if (has_pending_force) wait_for_force(); // Result not used
+            if (use_force_stream)
+            {
+                send_on_stream(t, state, commands, env, instance_name);
+            }
+            else
+            {
+                pending_request.reset(new PendingRequest());
+                const auto states = to_grpc.from_state(state, max_history_length, env);
+                const auto wave_information = get_wave_information(t, state.x(0), state.y(0), state.z(0), env);
+                pending_request->reader = stub->PrepareAsyncforce(&pending_request->context, to_grpc.from_force_request(states, commands, wave_information, instance_name), &completion_queue);
+                pending_request->reader->StartCall();
+                pending_request->reader->Finish(&pending_request->response, &pending_request->status, pending_request.get());
+            }
+            has_pending_force = true;
+            pending_force_date = t;
+        }
+
         ssc::kinematics::Vector6d force(const double t, const BodyStates& state, const std::map<std::string,double>& commands, const EnvironmentAndFrames& env, const std::string& instance_name)
         {
-            ForceResponse response;
-            grpc::ClientContext context;
-            const auto states = to_grpc.from_state(state, max_history_length, env);
-            const auto wave_information = get_wave_information(t, state.x(0), state.y(0), state.z(0), env);
-            const grpc::Status status = stub->force(&context, to_grpc.from_force_request(states, commands, wave_information, instance_name), &response);
-            throw_if_invalid_status(input, "force", status);
-            extra_observations = std::map<std::string,double>(response.extra_observations().begin(),response.extra_observations().end());
-            return from_grpc.to_force(response);
+            if (not(has_pending_force) or (pending_force_date != t))
+            {
+                start(t, state, commands, env, instance_name);
+            }
+            return wait_for_force();
         }
 
         double get_Tmax() const
@@ -222,6 +274,113 @@ class GRPCForceModel::Impl
 
     private:
         Impl(); // Disabled
+
+        /**  \brief Response to the request sent by 'start'
+          */
+        ssc::kinematics::Vector6d wait_for_force()
+        {
+            has_pending_force = false;
+            if (use_force_stream)
+            {
+                return read_from_stream();
+            }
+            void* tag = nullptr;
+            bool ok = false;
+            const bool got_response = completion_queue.Next(&tag, &ok);
+            const std::unique_ptr<PendingRequest> request(std::move(pending_request));
+            if (not(got_response) or not(ok))
+            {
+                THROW(__PRETTY_FUNCTION__, GRPCError, "an error occurred when using the distant force model '" + input.name + "' defined via gRPC (method 'force'): no response was received. Check that the server is running and accessible from the URL defined in the YAML file: " + input.url);
+            }
+            throw_if_invalid_status(input, "force", request->status);
+            extra_observations = std::map<std::string,double>(request->response.extra_observations().begin(),request->response.extra_observations().end());
+            return from_grpc.to_force(request->response);
+        }
+
+        /**  \brief Same as 'start', but using the 'force_stream' rpc method
+          *  \details The stream is opened on the first call & kept open until the model is destroyed. Only the
+          *           samples recorded since the previous call are sent & the points at which the model needs
+          *           wave information are returned with each force (instead of a 'required_wave_information' call).
+          */
+        void send_on_stream(const double t, const BodyStates& state, const std::map<std::string,double>& commands, const EnvironmentAndFrames& env, const std::string& instance_name)
+        {
+            if (not(stream))
+            {
+                stream_context.reset(new grpc::ClientContext());
+                stream = stub->force_stream(stream_context.get());
+            }
+            bool reset_history = false;
+            States* new_states = get_new_states(state, env, reset_history);
+            WaveInformation* wave_information = get_wave_information_for_stream(t, state.x(0), state.y(0), state.z(0), env);
+            const ForceStreamRequest request = to_grpc.from_force_stream_request(new_states, reset_history, commands, wave_information, instance_name);
+            stream_write_failed = not(stream->Write(request));
+        }
+
+        ssc::kinematics::Vector6d read_from_stream()
+        {
+            ForceStreamResponse response;
+            if (stream_write_failed or not(stream->Read(&response)))
+            {
+                const grpc::Status status = close_stream();
+                throw_if_invalid_status(input, "force_stream", status);
+                THROW(__PRETTY_FUNCTION__, GRPCError, "an error occurred when using the distant force model '" + input.name + "' defined via gRPC (method 'force_stream'): the server closed the stream. Check that the server is running and accessible from the URL defined in the YAML file: " + input.url);
+            }
+            if (needs_wave_outputs)
+            {
+                next_wave_request = from_grpc.to_wave_request(response.required_wave_information());
+                has_next_wave_request = true;
+            }
+            extra_observations = std::map<std::string,double>(response.force().extra_observations().begin(),response.force().extra_observations().end());
+            return from_grpc.to_force(response.force());
+        }
+
+        /**  \brief Whole history for the first request (or if the history was rewritten), new samples otherwise
+          *  \details The history is rewritten if samples were undone since the previous request (eg. by
+          *           Sim::restore_states_histories between the stages of an adaptive step): the server may
+          *           then hold samples xdyn discarded, even if the date did not go back.
+          */
+        States* get_new_states(const BodyStates& state, const EnvironmentAndFrames& env, bool& reset_history)
+        {
+            const double t = state.x.get_current_time();
+            reset_history = (max_history_length == 0) or not(has_sent_states) or (t < last_sent_date) or (state.x.get_revision() != last_sent_revision);
+            States* ret = reset_history ? to_grpc.from_state(state, max_history_length, env)
+                                        // The latest sample sent may have been overwritten since (eg. by the intermediate steps of RK4)
+                                        : to_grpc.from_state_since(state, last_sent_date, env);
+            has_sent_states = true;
+            last_sent_date = t;
+            last_sent_revision = state.x.get_revision();
+            return ret;
+        }
+
+        WaveInformation* get_wave_information_for_stream(const double t, const double x, const double y, const double z, const EnvironmentAndFrames& env)
+        {
+            if (needs_wave_outputs)
+            {
+                if (not(has_next_wave_request))
+                {
+                    next_wave_request = required_wave_information(t, x, y, z);
+                    has_next_wave_request = true;
+                }
+                return to_grpc.from_wave_information(next_wave_request, t, env);
+            }
+            return new WaveInformation();
+        }
+
+        grpc::Status close_stream()
+        {
+            grpc::Status status;
+            if (stream)
+            {
+                stream->WritesDone();
+                status = stream->Finish();
+            }
+            stream.reset();
+            stream_context.reset();
+            has_sent_states = false;
+            has_next_wave_request = false;
+            return status;
+        }
+
         WaveInformation* get_wave_information(const double t, const double x, const double y, const double z, const EnvironmentAndFrames& env) const
         {
             if (needs_wave_outputs)
@@ -241,6 +400,27 @@ class GRPCForceModel::Impl
         FromGRPC from_grpc;
         std::vector<std::string> commands;
         YamlPosition force_frame;
+        bool use_force_stream;
+        std::unique_ptr<grpc::ClientContext> stream_context; //!< Must outlive 'stream'
+        std::unique_ptr<grpc::ClientReaderWriter<ForceStreamRequest, ForceStreamResponse> > stream;
+        bool has_sent_states;                                //!< Has the history been sent on the current stream?
+        double last_sent_date;                               //!< Date of the latest sample sent on the stream
+        size_t last_sent_revision;                           //!< History::get_revision of the states when they were last sent
+        WaveRequest next_wave_request;                       //!< Returned by the model with the latest force
+        bool has_next_wave_request;
+        bool stream_write_failed;                            //!< If true, the response will never come
+        struct PendingRequest
+        {
+            PendingRequest() : context(), response(), status(), reader() {}
+            grpc::ClientContext context;
+            ForceResponse response;
+            grpc::Status status;
+            std::unique_ptr<grpc::ClientAsyncResponseReader<ForceResponse> > reader;
+        };
+        grpc::CompletionQueue completion_queue;              //!< Only one request in it at a time (the models run concurrently, not the requests of a model)
+        std::unique_ptr<PendingRequest> pending_request;     //!< Unary request sent by 'start' (if not using the stream)
+        bool has_pending_force;                              //!< Has 'start' been called since the latest response was read?
+        double pending_force_date;
 };
 
 std::string GRPCForceModel::model_name() {return "grpc";}
@@ -269,11 +449,22 @@ GRPCForceModel::GRPCForceModel(const GRPCForceModel::Input& input, const std::st
 GRPCForceModel::GRPCForceModel(const TR1(shared_ptr)<Impl>& pimpl_, const std::string& body_name_, const EnvironmentAndFrames& env_) :
         ControllableForceModel(pimpl_->get_input().name, pimpl_->get_commands(), pimpl_->get_transformation_to_model_frame(), body_name_, env_),
         pimpl(pimpl_),
-        env(env_)
+        env(env_),
+        extra_observations_addressing()
 
 {
 }
 
+bool GRPCForceModel::computes_force_asynchronously() const
+{
+    return true;
+}
+
+void GRPCForceModel::start_force(const BodyStates& states, const double t, const std::map<std::string,double>& commands)
+{
+    pimpl->start(t, states, commands, env, get_name());
+}
+
 ssc::kinematics::Vector6d GRPCForceModel::get_force(const BodyStates& states, const double t, const std::map<std::string,double>& commands) const
 {
     const auto ret = pimpl->force(t, states, commands, env, get_name());
@@ -283,9 +474,15 @@ ssc::kinematics::Vector6d GRPCForceModel::get_force(const BodyStates& states, co
 void GRPCForceModel::extra_observations(Observer& observer) const
 {
     const auto extra_observations = pimpl->get_extra_observations();
-    for (const auto observation : extra_observations)
+    for (const auto& observation : extra_observations)
     {
-        observer.write(observation.second, DataAddressing(std::vector<std::string>{"efforts",get_body_name(),get_name(),observation.first},observation.first + std::string("(") + get_body_name() + ")"));
+        auto addressing = extra_observations_addressing.find(observation.first);
+        if (addressing == extra_observations_addressing.end())
+        {
+            const DataAddressing a(std::vector<std::string>{"efforts",get_body_name(),get_name(),observation.first},observation.first + std::string("(") + get_body_name() + ")");
+            addressing = extra_observations_addressing.insert(std::make_pair(observation.first, a)).first;
+        }
+        observer.write(observation.second, addressing->second);
     }
 }
 
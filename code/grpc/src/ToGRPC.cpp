@@ -8,6 +8,8 @@
 
 #include "ToGRPC.hpp"
 
+#include <algorithm> // std::max
+
 ToGRPC::ToGRPC(const GRPCForceModel::Input& input_)
     : input(input_)
 {}
@@ -156,40 +158,53 @@ WaveInformation* ToGRPC::from_wave_information(const WaveRequest& wave_request,
 
 States* ToGRPC::from_state(const BodyStates& state, const double max_history_length, const EnvironmentAndFrames& env) const
 {
-    const auto qr = state.qr.get_values(max_history_length);
-    const auto qi = state.qi.get_values(max_history_length);
-    const auto qj = state.qj.get_values(max_history_length);
-    const auto qk = state.qk.get_values(max_history_length);
-    std::vector<double> phi(qr.size());
-    std::vector<double> theta(qr.size());
-    std::vector<double> psi(qr.size());
-    for (size_t i = 0 ; i < qr.size() ; ++i)
+    // Same samples as History::get_values: only the latest one if max_history_length is zero
+    const int n = (int)state.x.size();
+    if (max_history_length == 0) return from_samples(state, std::max(n-1, 0), env);
+    const double t = state.x.get_current_time();
+    int first = n;
+    while ((first > 0) and (max_history_length >= t - state.x[first-1].first)) --first;
+    return from_samples(state, first, env);
+}
+
+States* ToGRPC::from_state_since(const BodyStates& state, const double t0, const EnvironmentAndFrames& env) const
+{
+    int first = (int)state.x.size();
+    while ((first > 0) and (state.x[first-1].first >= t0)) --first;
+    return from_samples(state, first, env);
+}
+
+States* ToGRPC::from_samples(const BodyStates& state, const int first, const EnvironmentAndFrames& env) const
+{
+    // All states are recorded at the same instants, so the dates of 'x' are those of all states
+    const int n = (int)state.x.size();
+    States* ret = new States();
+    for (int i = first ; i < n ; ++i)
     {
-        ssc::kinematics::RotationMatrix R = Eigen::Quaternion<double>(qr[i],qi[i],qj[i],qk[i]).matrix();
+        const double qr = state.qr[i].second;
+        const double qi = state.qi[i].second;
+        const double qj = state.qj[i].second;
+        const double qk = state.qk[i].second;
+        ssc::kinematics::RotationMatrix R = Eigen::Quaternion<double>(qr,qi,qj,qk).matrix();
         const ssc::kinematics::EulerAngles euler_angles = state.convert(R, env.rot);
-        phi[i] = euler_angles.phi;
-        theta[i] = euler_angles.theta;
-        psi[i] = euler_angles.psi;
+        ret->add_t(state.x[i].first);
+        ret->add_x(state.x[i].second);
+        ret->add_y(state.y[i].second);
+        ret->add_z(state.z[i].second);
+        ret->add_u(state.u[i].second);
+        ret->add_v(state.v[i].second);
+        ret->add_w(state.w[i].second);
+        ret->add_p(state.p[i].second);
+        ret->add_q(state.q[i].second);
+        ret->add_r(state.r[i].second);
+        ret->add_qr(qr);
+        ret->add_qi(qi);
+        ret->add_qj(qj);
+        ret->add_qk(qk);
+        ret->add_phi(euler_angles.phi);
+        ret->add_theta(euler_angles.theta);
+        ret->add_psi(euler_angles.psi);
     }
-    States* ret = new States();
-
-    copy_from_double_vector(state.x.get_dates(max_history_length), ret->mutable_t());
-    copy_from_double_vector(state.x.get_values(max_history_length), ret->mutable_x());
-    copy_from_double_vector(state.y.get_values(max_history_length), ret->mutable_y());
-    copy_from_double_vector(state.z.get_values(max_history_length), ret->mutable_z());
-    copy_from_double_vector(state.u.get_values(max_history_length), ret->mutable_u());
-    copy_from_double_vector(state.v.get_values(max_history_length), ret->mutable_v());
-    copy_from_double_vector(state.w.get_values(max_history_length), ret->mutable_w());
-    copy_from_double_vector(state.p.get_values(max_history_length), ret->mutable_p());
-    copy_from_double_vector(state.q.get_values(max_history_length), ret->mutable_q());
-    copy_from_double_vector(state.r.get_values(max_history_length), ret->mutable_r());
-    copy_from_double_vector(qr, ret->mutable_qr());
-    copy_from_double_vector(qi, ret->mutable_qi());
-    copy_from_double_vector(qj, ret->mutable_qj());
-    copy_from_double_vector(qk, ret->mutable_qk());
-    copy_from_double_vector(phi, ret->mutable_phi());
-    copy_from_double_vector(theta, ret->mutable_theta());
-    copy_from_double_vector(psi, ret->mutable_psi());
     copy_from_string_vector(env.rot.convention, ret->mutable_rotations_convention());
     return ret;
 }
@@ -204,6 +219,17 @@ ForceRequest ToGRPC::from_force_request(States* states, const std::map<std::stri
     return request;
 }
 
+ForceStreamRequest ToGRPC::from_force_stream_request(States* new_states, const bool reset_history, const std::map<std::string, double >& commands, WaveInformation* wave_information, const std::string& instance_name) const
+{
+    ForceStreamRequest request;
+    request.set_allocated_wave_information(wave_information);
+    request.mutable_commands()->insert(commands.begin(), commands.end());
+    request.set_allocated_new_states(new_states);
+    request.set_reset_history(reset_history);
+    request.set_instance_name(instance_name);
+    return request;
+}
+
 SetForceParameterRequest ToGRPC::from_yaml(const std::string& yaml, const std::string body_name, const std::string& instance_name) const
 {
     SetForceParameterRequest request;
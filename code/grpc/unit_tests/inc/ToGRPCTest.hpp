@@ -0,0 +1,23 @@
+/*
+ * ToGRPCTest.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef GRPC_UNIT_TESTS_INC_TOGRPCTEST_HPP_
+#define GRPC_UNIT_TESTS_INC_TOGRPCTEST_HPP_
+
+#include "gtest/gtest.h"
+
+class ToGRPCTest : public ::testing::Test
+{
+    protected:
+        ToGRPCTest();
+        virtual ~ToGRPCTest();
+        virtual void SetUp();
+        virtual void TearDown();
+};
+
+
+#endif /* GRPC_UNIT_TESTS_INC_TOGRPCTEST_HPP_ */
@@ -5,6 +5,21 @@
  *      Author: cady
  */
 
+#include <algorithm> // std::max
+#include <chrono>
+#include <cmath> // std::nan
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <grpcpp/grpcpp.h>
+#include "force.pb.h"
+#include "force.grpc.pb.h"
+#include <ssc/data_source.hpp>
+
+#include "BodyStates.hpp"
 #include "GRPCForceModel.hpp"
 #include "GRPCForceModelTest.hpp"
 #include "yaml_data.hpp"
@@ -48,3 +63,383 @@ TEST_F(GRPCForceModelTest, can_parse_rest_of_yaml_parameters)
               "url: force-model:9002"
               , input.yaml);
 }
+
+/**  \brief Lets the local servers wait until a given number of requests have arrived
+  *  \details The requests only all arrive if the client sends them without waiting for the responses. A timeout
+  *           keeps the servers from waiting forever if it does not.
+  */
+class Rendezvous
+{
+    public:
+        Rendezvous(const size_t nb_of_requests_) : mutex(), arrival(), nb_of_requests(nb_of_requests_), nb_of_arrived_requests(0)
+        {
+        }
+
+        /**  \brief Blocks until all requests have arrived (or for 10 seconds at most)
+          *  \returns true if all requests arrived before the timeout
+          */
+        bool wait()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            nb_of_arrived_requests++;
+            arrival.notify_all();
+            return arrival.wait_for(lock, std::chrono::seconds(10), [this]{return nb_of_arrived_requests >= nb_of_requests;});
+        }
+
+    private:
+        Rendezvous(); // Disabled
+        Rendezvous(const Rendezvous&); // Disabled
+        Rendezvous& operator=(const Rendezvous&); // Disabled
+        std::mutex mutex;
+        std::condition_variable arrival;
+        const size_t nb_of_requests;
+        size_t nb_of_arrived_requests;
+};
+
+/**  \brief Local force model server only answering once the other servers sharing its rendezvous have received their request
+  *  \details Returns fx = x(0) if they all have, NaN otherwise.
+  */
+class SynchronizedForceModel : public Force::Service
+{
+    public:
+        SynchronizedForceModel(Rendezvous& rendezvous_) : rendezvous(rendezvous_)
+        {
+        }
+
+        grpc::Status set_parameters(grpc::ServerContext* , const SetForceParameterRequest* request, SetForceParameterResponse* response) override
+        {
+            response->set_max_history_length(0);
+            response->set_frame(request->body_name());
+            return grpc::Status::OK;
+        }
+
+        grpc::Status force(grpc::ServerContext* , const ForceRequest* request, ForceResponse* response) override
+        {
+            response->set_fx(rendezvous.wait() ? request->states().x(0) : std::nan(""));
+            return grpc::Status::OK;
+        }
+
+    private:
+        SynchronizedForceModel(); // Disabled
+        SynchronizedForceModel(const SynchronizedForceModel&); // Disabled
+        SynchronizedForceModel& operator=(const SynchronizedForceModel&); // Disabled
+        Rendezvous& rendezvous;
+};
+
+void record_states(BodyStates& states, const double t, const double x);
+void record_states(BodyStates& states, const double t, const double x)
+{
+    states.x.record(t, x);
+    states.y.record(t, 0);
+    states.z.record(t, 0);
+    states.u.record(t, 0);
+    states.v.record(t, 0);
+    states.w.record(t, 0);
+    states.p.record(t, 0);
+    states.q.record(t, 0);
+    states.r.record(t, 0);
+    states.qr.record(t, 1);
+    states.qi.record(t, 0);
+    states.qj.record(t, 0);
+    states.qk.record(t, 0);
+}
+
+BodyStates get_states_at(const double t, const double x);
+BodyStates get_states_at(const double t, const double x)
+{
+    BodyStates states;
+    record_states(states, t, x);
+    return states;
+}
+
+TEST_F(GRPCForceModelTest, distant_models_started_together_are_computed_concurrently)
+{
+    const size_t nb_of_models = 3;
+    EnvironmentAndFrames env;
+    env.rot = YamlRotation("angle", {"z","y'","x''"});
+    env.k = ssc::kinematics::KinematicsPtr(new ssc::kinematics::Kinematics());
+    // Each server waits for the requests of the others: calling the models one after the other would fail
+    Rendezvous rendezvous(nb_of_models);
+    std::vector<std::unique_ptr<SynchronizedForceModel> > services;
+    std::vector<std::unique_ptr<grpc::Server> > servers;
+    std::vector<ControllableForcePtr> models;
+    for (size_t i = 0 ; i < nb_of_models ; ++i)
+    {
+        services.push_back(std::unique_ptr<SynchronizedForceModel>(new SynchronizedForceModel(rendezvous)));
+        int port = 0;
+        grpc::ServerBuilder builder;
+        builder.AddListeningPort("localhost:0", grpc::InsecureServerCredentials(), &port);
+        builder.RegisterService(services.back().get());
+        servers.push_back(builder.BuildAndStart());
+        GRPCForceModel::Input input;
+        input.url = "localhost:" + std::to_string(port);
+        input.name = "model " + std::to_string(i);
+        input.yaml = "";
+        models.push_back(ControllableForcePtr(new GRPCForceModel(input, "body", env)));
+    }
+    const BodyStates states = get_states_at(0, 12);
+    ssc::data_source::DataSource command_listener;
+    for (const auto& model:models)
+    {
+        ASSERT_TRUE(model->computes_force_asynchronously());
+        model->start_computing_force(states, 0, command_listener);
+    }
+    for (const auto& model:models)
+    {
+        ASSERT_DOUBLE_EQ(12, model->get_force(states, 0, std::map<std::string,double>())(0));
+    }
+    for (const auto& server:servers) server->Shutdown();
+}
+
+TEST_F(GRPCForceModelTest, force_can_be_computed_without_being_started)
+{
+    EnvironmentAndFrames env;
+    env.rot = YamlRotation("angle", {"z","y'","x''"});
+    env.k = ssc::kinematics::KinematicsPtr(new ssc::kinematics::Kinematics());
+    Rendezvous rendezvous(1);
+    SynchronizedForceModel service(rendezvous);
+    int port = 0;
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort("localhost:0", grpc::InsecureServerCredentials(), &port);
+    builder.RegisterService(&service);
+    const std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
+    GRPCForceModel::Input input;
+    input.url = "localhost:" + std::to_string(port);
+    input.name = "model";
+    input.yaml = "";
+    const GRPCForceModel model(input, "body", env);
+    ASSERT_DOUBLE_EQ(3, model.get_force(get_states_at(0, 3), 0, std::map<std::string,double>())(0));
+    ASSERT_DOUBLE_EQ(4, model.get_force(get_states_at(1, 4), 1, std::map<std::string,double>())(0));
+    server->Shutdown();
+}
+
+/**  \brief Local force model server using the 'force_stream' rpc method
+  *  \details Rebuilds the history of 'x' from the requests, as a real model would, so the tests can check it
+  *           matches the history known by xdyn. The force it returns is the number of samples in that history.
+  */
+class StreamingForceModel : public Force::Service
+{
+    public:
+        StreamingForceModel() : mutex(), history(), nb_of_requests(0), nb_of_resets(0), max_nb_of_new_samples(0)
+        {
+        }
+
+        grpc::Status set_parameters(grpc::ServerContext* , const SetForceParameterRequest* request, SetForceParameterResponse* response) override
+        {
+            response->set_max_history_length(100);
+            response->set_frame(request->body_name());
+            response->set_use_force_stream(true);
+            return grpc::Status::OK;
+        }
+
+        grpc::Status force(grpc::ServerContext* , const ForceRequest* , ForceResponse* ) override
+        {
+            return grpc::Status(grpc::StatusCode::FAILED_PRECONDITION, "Should use 'force_stream'");
+        }
+
+        grpc::Status force_stream(grpc::ServerContext* , grpc::ServerReaderWriter<ForceStreamResponse, ForceStreamRequest>* stream) override
+        {
+            ForceStreamRequest request;
+            while (stream->Read(&request))
+            {
+                ForceStreamResponse response;
+                response.mutable_force()->set_fx((double)update_history(request));
+                if (not(stream->Write(response))) break;
+            }
+            return grpc::Status::OK;
+        }
+
+        std::vector<std::pair<double,double> > get_history() const
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return history;
+        }
+
+        size_t get_nb_of_requests() const
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return nb_of_requests;
+        }
+
+        size_t get_nb_of_resets() const
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return nb_of_resets;
+        }
+
+        size_t get_max_nb_of_new_samples() const
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return max_nb_of_new_samples;
+        }
+
+    private:
+        StreamingForceModel(const StreamingForceModel&); // Disabled
+        StreamingForceModel& operator=(const StreamingForceModel&); // Disabled
+
+        size_t update_history(const ForceStreamRequest& request)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            const States& new_states = request.new_states();
+            nb_of_requests++;
+            if (request.reset_history())
+            {
+                nb_of_resets++;
+                history.clear();
+            }
+            else
+            {
+                max_nb_of_new_samples = std::max(max_nb_of_new_samples, (size_t)new_states.t_size());
+                while ((new_states.t_size() > 0) and not(history.empty()) and (history.back().first >= new_states.t(0))) history.pop_back();
+            }
+            for (int i = 0 ; i < new_states.t_size() ; ++i) history.push_back(std::make_pair(new_states.t(i), new_states.x(i)));
+            return history.size();
+        }
+
+        mutable std::mutex mutex;
+        std::vector<std::pair<double,double> > history;
+        size_t nb_of_requests;
+        size_t nb_of_resets;
+        size_t max_nb_of_new_samples; //!< Largest number of samples received in a request that does not reset the history
+};
+
+std::vector<std::pair<double,double> > get_history(const History& h);
+std::vector<std::pair<double,double> > get_history(const History& h)
+{
+    std::vector<std::pair<double,double> > ret;
+    for (int i = 0 ; i < (int)h.size() ; ++i) ret.push_back(h[i]);
+    return ret;
+}
+
+TEST_F(GRPCForceModelTest, force_stream_should_only_send_the_new_samples)
+{
+    EnvironmentAndFrames env;
+    env.rot = YamlRotation("angle", {"z","y'","x''"});
+    env.k = ssc::kinematics::KinematicsPtr(new ssc::kinematics::Kinematics());
+    StreamingForceModel service;
+    int port = 0;
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort("localhost:0", grpc::InsecureServerCredentials(), &port);
+    builder.RegisterService(&service);
+    const std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
+    GRPCForceModel::Input input;
+    input.url = "localhost:" + std::to_string(port);
+    input.name = "model";
+    input.yaml = "";
+    {
+        const GRPCForceModel model(input, "body", env);
+        BodyStates states(100);
+        for (size_t i = 0 ; i < 10 ; ++i)
+        {
+            // Same sequence of instants as a 4th order Runge-Kutta scheme: the latest sample is overwritten
+            const double t = (double)i;
+            size_t stage = 0;
+            for (const double t_stage:{t, t+0.5, t+0.5, t+1})
+            {
+                record_states(states, t_stage, 10*t_stage + (double)(stage++));
+                ASSERT_DOUBLE_EQ((double)states.x.size(), model.get_force(states, t_stage, std::map<std::string,double>())(0));
+                ASSERT_EQ(get_history(states.x), service.get_history()) << "t = " << t_stage;
+            }
+        }
+    }
+    ASSERT_EQ(40, service.get_nb_of_requests());
+    ASSERT_EQ(1, service.get_nb_of_resets());
+    ASSERT_EQ(2, service.get_max_nb_of_new_samples());
+    server->Shutdown();
+}
+
+TEST_F(GRPCForceModelTest, force_stream_should_resend_the_whole_history_if_it_was_rewound)
+{
+    EnvironmentAndFrames env;
+    env.rot = YamlRotation("angle", {"z","y'","x''"});
+    env.k = ssc::kinematics::KinematicsPtr(new ssc::kinematics::Kinematics());
+    StreamingForceModel service;
+    int port = 0;
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort("localhost:0", grpc::InsecureServerCredentials(), &port);
+    builder.RegisterService(&service);
+    const std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
+    GRPCForceModel::Input input;
+    input.url = "localhost:" + std::to_string(port);
+    input.name = "model";
+    input.yaml = "";
+    {
+        const GRPCForceModel model(input, "body", env);
+        BodyStates states(100);
+        for (size_t i = 0 ; i < 5 ; ++i) record_states(states, (double)i, (double)i);
+        model.get_force(states, 4, std::map<std::string,double>());
+        // Rejected step of an adaptive solver: the history goes back to t = 3
+        BodyStates rewound(100);
+        for (size_t i = 0 ; i < 4 ; ++i) record_states(rewound, (double)i, (double)i);
+        record_states(rewound, 3.5, -1);
+        ASSERT_DOUBLE_EQ(5, model.get_force(rewound, 3.5, std::map<std::string,double>())(0));
+        ASSERT_EQ(get_history(rewound.x), service.get_history());
+        ASSERT_EQ(2, service.get_nb_of_resets());
+        // Back to deltas
+        record_states(rewound, 4, 7);
+        ASSERT_DOUBLE_EQ(6, model.get_force(rewound, 4, std::map<std::string,double>())(0));
+        ASSERT_EQ(get_history(rewound.x), service.get_history());
+        ASSERT_EQ(2, service.get_nb_of_resets());
+    }
+    server->Shutdown();
+}
+
+void save_checkpoint(BodyStates& states);
+void save_checkpoint(BodyStates& states)
+{
+    for (History* h:{&states.x, &states.y, &states.z, &states.u, &states.v, &states.w, &states.p, &states.q, &states.r, &states.qr, &states.qi, &states.qj, &states.qk})
+    {
+        h->save_checkpoint();
+    }
+}
+
+void rewind_to_checkpoint(BodyStates& states);
+void rewind_to_checkpoint(BodyStates& states)
+{
+    for (History* h:{&states.x, &states.y, &states.z, &states.u, &states.v, &states.w, &states.p, &states.q, &states.r, &states.qr, &states.qi, &states.qj, &states.qk})
+    {
+        h->rewind_to_checkpoint();
+    }
+}
+
+TEST_F(GRPCForceModelTest, force_stream_should_resend_the_whole_history_if_the_stages_of_an_adaptive_step_were_undone)
+{
+    EnvironmentAndFrames env;
+    env.rot = YamlRotation("angle", {"z","y'","x''"});
+    env.k = ssc::kinematics::KinematicsPtr(new ssc::kinematics::Kinematics());
+    StreamingForceModel service;
+    int port = 0;
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort("localhost:0", grpc::InsecureServerCredentials(), &port);
+    builder.RegisterService(&service);
+    const std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
+    GRPCForceModel::Input input;
+    input.url = "localhost:" + std::to_string(port);
+    input.name = "model";
+    input.yaml = "";
+    {
+        const GRPCForceModel model(input, "body", env);
+        BodyStates states(100);
+        record_states(states, 0, 0);
+        model.get_force(states, 0, std::map<std::string,double>());
+        save_checkpoint(states);
+        const double h = 1;
+        for (size_t i = 0 ; i < 3 ; ++i)
+        {
+            // Same sequence as adaptive_quicksolve with the Cash-Karp stages: the histories are restored before each stage
+            const double t = (double)i*h;
+            size_t stage = 0;
+            for (const double c:{0., 1./5, 3./10, 3./5, 1., 7./8, 1.})
+            {
+                rewind_to_checkpoint(states);
+                record_states(states, t + c*h, 10*t + (double)(stage++));
+                ASSERT_DOUBLE_EQ((double)states.x.size(), model.get_force(states, t + c*h, std::map<std::string,double>())(0));
+                ASSERT_EQ(get_history(states.x), service.get_history()) << "t = " << t + c*h;
+            }
+            // Step accepted
+            save_checkpoint(states);
+        }
+        ASSERT_EQ(4, states.x.size());
+    }
+    server->Shutdown();
+}
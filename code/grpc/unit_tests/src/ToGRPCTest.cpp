@@ -0,0 +1,121 @@
+/*
+ * ToGRPCTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <memory>
+
+#include "ToGRPC.hpp"
+#include "ToGRPCTest.hpp"
+
+ToGRPCTest::ToGRPCTest()
+{
+}
+
+ToGRPCTest::~ToGRPCTest()
+{
+}
+
+void ToGRPCTest::SetUp()
+{
+}
+
+void ToGRPCTest::TearDown()
+{
+}
+
+namespace
+{
+    BodyStates get_states_recorded_at(const std::vector<double>& dates)
+    {
+        BodyStates states(100);
+        for (const double t:dates)
+        {
+            states.x.record(t, 10*t);
+            states.y.record(t, 0);
+            states.z.record(t, 0);
+            states.u.record(t, 1);
+            states.v.record(t, 0);
+            states.w.record(t, 0);
+            states.p.record(t, 0);
+            states.q.record(t, 0);
+            states.r.record(t, 0);
+            states.qr.record(t, 1);
+            states.qi.record(t, 0);
+            states.qj.record(t, 0);
+            states.qk.record(t, 0);
+        }
+        return states;
+    }
+
+    EnvironmentAndFrames get_env()
+    {
+        EnvironmentAndFrames env;
+        env.rot = YamlRotation("angle", {"z","y'","x''"});
+        return env;
+    }
+
+    GRPCForceModel::Input get_input()
+    {
+        GRPCForceModel::Input input;
+        input.name = "test";
+        input.url = "localhost:9002";
+        return input;
+    }
+}
+
+TEST_F(ToGRPCTest, from_state_since_only_converts_the_latest_samples)
+{
+    const ToGRPC to_grpc(get_input());
+    const BodyStates states = get_states_recorded_at({0, 1, 2, 3, 4});
+    const std::unique_ptr<States> new_states(to_grpc.from_state_since(states, 3, get_env()));
+    ASSERT_EQ(2, new_states->t_size());
+    ASSERT_DOUBLE_EQ(3, new_states->t(0));
+    ASSERT_DOUBLE_EQ(4, new_states->t(1));
+    ASSERT_DOUBLE_EQ(30, new_states->x(0));
+    ASSERT_DOUBLE_EQ(40, new_states->x(1));
+    ASSERT_EQ(2, new_states->u_size());
+    ASSERT_EQ(2, new_states->qk_size());
+    ASSERT_EQ(2, new_states->psi_size());
+    ASSERT_EQ(3, new_states->rotations_convention_size());
+}
+
+TEST_F(ToGRPCTest, from_state_since_is_empty_if_nothing_was_recorded_since_t0)
+{
+    const ToGRPC to_grpc(get_input());
+    const BodyStates states = get_states_recorded_at({0, 1, 2});
+    const std::unique_ptr<States> new_states(to_grpc.from_state_since(states, 2.5, get_env()));
+    ASSERT_EQ(0, new_states->t_size());
+    ASSERT_EQ(0, new_states->x_size());
+}
+
+TEST_F(ToGRPCTest, from_state_since_the_first_date_is_the_same_as_from_state)
+{
+    const ToGRPC to_grpc(get_input());
+    const BodyStates states = get_states_recorded_at({0, 0.5, 1, 1.5});
+    const std::unique_ptr<States> all_states(to_grpc.from_state(states, 100, get_env()));
+    const std::unique_ptr<States> new_states(to_grpc.from_state_since(states, 0, get_env()));
+    ASSERT_EQ(all_states->t_size(), new_states->t_size());
+    for (int i = 0 ; i < all_states->t_size() ; ++i)
+    {
+        ASSERT_DOUBLE_EQ(all_states->t(i), new_states->t(i));
+        ASSERT_DOUBLE_EQ(all_states->x(i), new_states->x(i));
+        ASSERT_DOUBLE_EQ(all_states->phi(i), new_states->phi(i));
+    }
+}
+
+TEST_F(ToGRPCTest, from_state_only_sends_the_samples_within_max_history_length)
+{
+    const ToGRPC to_grpc(get_input());
+    const BodyStates states = get_states_recorded_at({0, 1, 2, 3, 4});
+    const std::unique_ptr<States> two_seconds(to_grpc.from_state(states, 2, get_env()));
+    ASSERT_EQ(3, two_seconds->t_size());
+    ASSERT_DOUBLE_EQ(2, two_seconds->t(0));
+    ASSERT_DOUBLE_EQ(40, two_seconds->x(2));
+    const std::unique_ptr<States> latest(to_grpc.from_state(states, 0, get_env()));
+    ASSERT_EQ(1, latest->t_size());
+    ASSERT_DOUBLE_EQ(4, latest->t(0));
+    ASSERT_EQ(1, latest->qr_size());
+}
@@ -73,6 +73,27 @@ class History
 
         void reset();
 
+        /**  \brief Marks the current content of the history so it can be restored by rewind_to_checkpoint
+          *  \details Used by solvers that evaluate the model at intermediate instants (eg. the stages of a
+          *           Runge-Kutta step) & need to discard the corresponding records afterwards.
+          *           O(1): nothing is copied.
+          *  \snippet hdb_interpolators/unit_tests/src/HistoryTest.cpp HistoryTest checkpoint_example
+          */
+        void save_checkpoint();
+
+        /**  \brief Undoes all records made since the latest call to save_checkpoint
+          *  \details Costs O(number of samples recorded or forgotten since the checkpoint), not
+          *           O(size()). The checkpoint is kept so the history can be rewound several times.
+          *           Does nothing if no checkpoint was saved since the last reset.
+          */
+        void rewind_to_checkpoint();
+
+        /**  \brief Number of times recorded samples were undone (by rewind_to_checkpoint or reset)
+          *  \details Lets a user of the history (eg. a distant model to which only the new samples are sent)
+          *           detect that samples it already knows may have been removed or modified.
+          */
+        size_t get_revision() const;
+
         bool is_empty() const;
 
         std::vector<double> get_values(const double tmax) const;
@@ -83,6 +104,22 @@ class History
         typedef std::pair<double,double> TimeValue;
         typedef std::vector<TimeValue> Container;
 
+        /**  \brief Circular buffer accessors: index 0 is the oldest sample, size()-1 the latest
+          *  \details Samples live in a contiguous ring whose capacity is a power of two, so
+          *           appending & forgetting old samples is amortised O(1) (no memmove).
+          */
+        const TimeValue& at(const size_t i) const;
+        TimeValue& at(const size_t i);
+        const TimeValue& front() const;
+        const TimeValue& back() const;
+        void push_back(const TimeValue& v);
+        void push_front(const TimeValue& v);
+        void pop_front(const size_t nb_of_values_to_remove);
+        void grow();
+
+        size_t guess_braketing_position(const double t) const;
+        bool is_braketing_position(const size_t idx, const double t) const;
+        size_t binary_search_braketing_position(const double t) const;
         void throw_if_already_added(const size_t idx, const double t, const double val) const;
         size_t find_braketing_position(const double t) const;
         double interpolate_value_in_interval(const size_t idx, const double t) const;
@@ -93,11 +130,23 @@ class History
         double trapeze(const double xa, const double ya, const double xb, const double yb) const;
         double integrate(const size_t idx) const;
         void check_if_average_can_be_retrieved(const double T) const;
+        void keep_samples_existing_at_checkpoint(const size_t nb_of_values_to_remove);
 
         double Tmax;
-        Container L;
+        Container L; //!< Ring storage (its size is the capacity, not the number of samples)
+        size_t head; //!< Position of the oldest sample in L
+        size_t n; //!< Number of samples currently stored
         double oldest_recorded_instant;
 
+        bool checkpoint_is_set;
+        size_t n_at_checkpoint;
+        TimeValue back_at_checkpoint; //!< The latest sample can be overwritten by record
+        double oldest_recorded_instant_at_checkpoint;
+        Container forgotten_since_checkpoint; //!< Samples present at the checkpoint & removed from the front since (oldest first)
+        size_t nb_of_interpolated_samples_at_front; //!< Added by shift_oldest_recorded_instant_if_necessary since the checkpoint
+        bool recorded_since_checkpoint; //!< If false, rewind_to_checkpoint has nothing to undo
+        size_t revision;
+
     public:
         History(const Container& L); // For testing purposes only
 };
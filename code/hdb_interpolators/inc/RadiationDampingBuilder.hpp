@@ -46,7 +46,19 @@ class RadiationDampingBuilder
                 const double omega_min,
                 double omega_max
                 ) const;
+
+        /**  \brief Values of the retardation function at each tau (used by build_retardation_function)
+          *  \details Allows the (costly) cos transforms to be computed once & shared by several simulations (cf. InputCache)
+          */
+        std::vector<double> get_retardation_function_values(
+                const std::function<double(double)>& Br,    //!< Radiation damping function
+                const std::vector<double>& taus,            //!< Points at which to evaluate the retardation function
+                const double eps,                           //!< When to truncate (0 for no truncation)
+                const double omega_min,
+                double omega_max
+                ) const;
         /**  \brief Computes the convolution of a function with state history, over a certain time
+          *  \details The ssc quadratures allocate memory at each call: RecursiveConvolution & ResampledHistory don't.
           *  \returns \f$\int_0^T h(t-\tau)*f(\tau) d\tau\f$
           *  \snippet hdb_interpolators/unit_tests/src/RadiationDampingBuilderTest.cpp RadiationDampingBuilderTest method_example
           */
@@ -0,0 +1,110 @@
+/*
+ * RecursiveConvolution.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef RECURSIVECONVOLUTION_HPP_
+#define RECURSIVECONVOLUTION_HPP_
+
+#include <complex>
+#include <functional>
+#include <vector>
+
+class History;
+
+/** \brief Approximation of a retardation function by a sum of complex exponentials
+ *  \details \f$K(\tau)\simeq\Re\left(\sum_m r_m e^{s_m(\tau-\tau_{\mbox{min}})}\right)\f$ for \f$\tau\geq\tau_{\mbox{min}}\f$.
+ *           All poles \f$s_m\f$ have a strictly negative real part.
+ *  \addtogroup hdb_interpolators
+ *  \ingroup hdb_interpolators
+ */
+struct ExponentialSum
+{
+    ExponentialSum();
+    double tau_min;                                 //!< Lower bound of the domain on which the approximation was fitted
+    std::vector<std::complex<double> > poles;       //!< s_m
+    std::vector<std::complex<double> > residues;    //!< r_m
+
+    double operator()(const double tau) const;
+};
+
+/**  \brief Fits a sum of exponentials using Prony's method
+  *  \details The retardation function is sampled at the (regularly spaced) taus. Poles are
+  *           the roots of the linear prediction polynomial: those that would make the
+  *           approximation grow are mirrored inside the unit circle so the recursive
+  *           convolution remains stable. Residues are then obtained by least squares.
+  *  \snippet hdb_interpolators/unit_tests/src/RecursiveConvolutionTest.cpp RecursiveConvolutionTest prony_example
+  */
+ExponentialSum prony(const std::function<double(double)>& K, //!< Retardation function to approximate
+                     const std::vector<double>& taus,        //!< Regularly spaced points at which K is sampled
+                     const size_t order                      //!< Number of exponentials in the approximation
+                     );
+
+/**  \brief Relative RMS difference between a retardation function and its approximation
+  *  \returns \f$\sqrt{\sum_i (K(\tau_i)-\tilde{K}(\tau_i))^2/\sum_i K(\tau_i)^2}\f$
+  */
+double relative_fit_error(const std::function<double(double)>& K, //!< Reference retardation function (eg. interpolated cos transform)
+                          const ExponentialSum& approximation,    //!< Approximation of K
+                          const std::vector<double>& taus         //!< Points at which the two are compared
+                          );
+
+/** \brief Computes \f$\int_{\tau_{\mbox{min}}}^{+\infty} K(\tau)\dot{X}(t-\tau)d\tau\f$ recursively
+ *  \details Each exponential term of K has a state \f$Z_m(t)=\int_{\tau_{\mbox{min}}}^{+\infty}e^{s_m(\tau-\tau_{\mbox{min}})}\dot{X}(t-\tau)d\tau\f$
+ *           which satisfies \f$Z_m(t+\Delta)=e^{s_m\Delta}Z_m(t)+\int_0^{\Delta}e^{s_m(\Delta-w)}\dot{X}(t-\tau_{\mbox{min}}+w)dw\f$.
+ *           The velocity is interpolated linearly over each increment so the update is exact & costs O(order).
+ *           States are only committed up to instants for which the history can no longer change (all
+ *           samples but the latest one), so the integrator may evaluate the model several times for the same
+ *           instant. If the history is rewound or reset, the states are rebuilt from the start of the history.
+ *           This object is immutable: the states are held by the caller (RecursiveConvolution::State), so the
+ *           same fitted approximation can be used for several histories.
+ *  \addtogroup hdb_interpolators
+ *  \ingroup hdb_interpolators
+ *  \section ex1 Example
+ *  \snippet hdb_interpolators/unit_tests/src/RecursiveConvolutionTest.cpp RecursiveConvolutionTest example
+ */
+class RecursiveConvolution
+{
+    public:
+        typedef std::vector<std::complex<double> > States;
+        /** \brief Everything that changes from one evaluation of the convolution to the next
+         */
+        struct State
+        {
+            State(const size_t nb_of_exponentials);
+            States Z;            //!< Z_m at t_committed
+            States Z_current;    //!< Work buffer (Z_m at the current instant)
+            States E;            //!< Work buffer for exp(s_m*delta)
+            States phi0;         //!< Work buffer for the contribution of the velocity at the beginning of each increment
+            States phi1;         //!< Work buffer for the contribution of the velocity variation over each increment
+            double t_committed;
+            bool initialized;    //!< False until the first call to operator(): the states are then built from the start of the history
+
+            private:
+                State();
+        };
+
+        RecursiveConvolution(const ExponentialSum& K);
+
+        /**  \brief State to pass to the first call to operator() (the states will be built from the history)
+          */
+        State get_initial_state() const;
+
+        /**  \brief Convolution of the retardation function with the history, at the current instant of the history
+          *  \returns 0 if the history is shorter than tau_min (same as RadiationDampingBuilder::convolution)
+          */
+        double operator()(const History& h, //!< History of the velocity
+                          State& state      //!< Updated by this call (must always be used with the same history)
+                          ) const;
+
+    private:
+        RecursiveConvolution();
+        void reset(const History& h, State& state) const;
+        bool needs_reset(const History& h, const State& state) const;
+        void advance(const History& h, State& state, States& z, const double t0, const double t1) const;
+
+        ExponentialSum K;
+};
+
+#endif /* RECURSIVECONVOLUTION_HPP_ */
@@ -0,0 +1,54 @@
+/*
+ * ResampledHistory.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef RESAMPLEDHISTORY_HPP_
+#define RESAMPLEDHISTORY_HPP_
+
+#include <vector>
+
+class History;
+
+/** \brief Copy of a History sampled at the (regularly spaced) points used to discretize the retardation functions
+ *  \details Storage is allocated once in the constructor: resampling & convolving never allocate, so
+ *           the same buffer can be refreshed at each time step and shared by the six axes of the radiation force.
+ *  \addtogroup hdb_interpolators
+ *  \ingroup hdb_interpolators
+ *  \section ex1 Example
+ *  \snippet hdb_interpolators/unit_tests/src/ResampledHistoryTest.cpp ResampledHistoryTest example
+ */
+class ResampledHistory
+{
+    public:
+        ResampledHistory(const std::vector<double>& taus //!< Regularly spaced delays (eg. built by RadiationDampingBuilder::build_regular_intervals)
+                        );
+
+        /**  \brief Samples h at t-tau for all taus lower than min(tau_max, h.get_duration())
+          */
+        void resample(const History& h, //!< History to sample
+                      const double tau_max //!< Upper bound of the convolution
+                      );
+
+        /**  \brief Trapezoidal approximation of \f$\int_{\tau_{\mbox{min}}}^{T} K(\tau)h(t-\tau)d\tau\f$,
+          *         with \f$T=\min(\tau_{\mbox{max}},\mbox{duration of h})\f$
+          *  \details K is interpolated linearly between the taus for the last (partial) interval.
+          *  \returns 0 if the history is shorter than tau_min (same as RadiationDampingBuilder::convolution)
+          */
+        double convolution(const std::vector<double>& K //!< Retardation function evaluated at each tau
+                          ) const;
+
+    private:
+        ResampledHistory();
+
+        double tau_min;
+        double dtau;
+        std::vector<double> values; //!< h(t-tau_j) for j < nb_of_values
+        size_t nb_of_values;        //!< Number of taus lower than T (0 if the history is too short)
+        double T;                   //!< Upper bound of the last sampled interval
+        double value_at_T;          //!< h(t-T)
+};
+
+#endif /* RESAMPLEDHISTORY_HPP_ */
@@ -7,6 +7,7 @@
 
 #include "History.hpp"
 #include "InternalErrorException.hpp"
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <iterator>
@@ -43,7 +44,10 @@ bool almost_equal(const double a, const double b, const int maxUlpsDiff)
     return false;
 }
 
-History::History(const double Tmax_) : Tmax(Tmax_), L(), oldest_recorded_instant(0)
+History::History(const double Tmax_) : Tmax(Tmax_), L(), head(0), n(0), oldest_recorded_instant(0)
+                                          , checkpoint_is_set(false), n_at_checkpoint(0), back_at_checkpoint()
+                                          , oldest_recorded_instant_at_checkpoint(0), forgotten_since_checkpoint()
+                                          , nb_of_interpolated_samples_at_front(0), recorded_since_checkpoint(false), revision(0)
 {
 }
 
@@ -54,8 +58,76 @@ double get_tmax(const std::vector<std::pair<double,double> >& L)
     return L.back().first - L.front().first;
 }
 
-History::History(const Container& L_) : Tmax(get_tmax(L_)), L(L_), oldest_recorded_instant(L.empty()?0:L.front().first)
+History::History(const Container& L_) : Tmax(get_tmax(L_)), L(), head(0), n(0), oldest_recorded_instant(L_.empty()?0:L_.front().first)
+                                          , checkpoint_is_set(false), n_at_checkpoint(0), back_at_checkpoint()
+                                          , oldest_recorded_instant_at_checkpoint(0), forgotten_since_checkpoint()
+                                          , nb_of_interpolated_samples_at_front(0), recorded_since_checkpoint(false), revision(0)
 {
+    for (const auto& v:L_) push_back(v);
+}
+
+const History::TimeValue& History::at(const size_t i) const
+{
+    return L[(head + i) & (L.size() - 1)];
+}
+
+History::TimeValue& History::at(const size_t i)
+{
+    return L[(head + i) & (L.size() - 1)];
+}
+
+const History::TimeValue& History::front() const
+{
+    return at(0);
+}
+
+const History::TimeValue& History::back() const
+{
+    return at(n-1);
+}
+
+void History::grow()
+{
+    Container new_L(L.empty() ? 16 : 2*L.size());
+    for (size_t i = 0 ; i < n ; ++i) new_L[i] = at(i);
+    L.swap(new_L);
+    head = 0;
+}
+
+void History::push_back(const TimeValue& v)
+{
+    if (n == L.size()) grow();
+    at(n) = v;
+    n++;
+}
+
+void History::push_front(const TimeValue& v)
+{
+    if (n == L.size()) grow();
+    head = (head + L.size() - 1) & (L.size() - 1);
+    at(0) = v;
+    n++;
+    if (checkpoint_is_set) nb_of_interpolated_samples_at_front++;
+}
+
+void History::keep_samples_existing_at_checkpoint(const size_t nb_of_values_to_remove)
+{
+    // Interpolated samples come first, then the samples present at the checkpoint, then the new ones
+    const size_t nb_of_interpolated = std::min(nb_of_values_to_remove, nb_of_interpolated_samples_at_front);
+    nb_of_interpolated_samples_at_front -= nb_of_interpolated;
+    for (size_t i = nb_of_interpolated ; (i < nb_of_values_to_remove) and (forgotten_since_checkpoint.size() < n_at_checkpoint) ; ++i)
+    {
+        forgotten_since_checkpoint.push_back(at(i));
+    }
+}
+
+void History::pop_front(const size_t nb_of_values_to_remove)
+{
+    const size_t k = std::min(nb_of_values_to_remove, n);
+    if (k == 0) return;
+    if (checkpoint_is_set) keep_samples_existing_at_checkpoint(k);
+    head = (head + k) & (L.size() - 1);
+    n -= k;
 }
 
 double History::operator()(double tau //!< How far back in history do we need to go (in seconds)?
@@ -72,7 +144,7 @@ double History::operator()(double tau //!< How far back in history do we need to
         THROW(__PRETTY_FUNCTION__, InternalErrorException,
                 "Requesting value in the future: asked for t-tau with tau = " << tau);
     }
-    if (L.empty())
+    if (n == 0)
     {
         return 0;
     }
@@ -81,7 +153,7 @@ double History::operator()(double tau //!< How far back in history do we need to
 
 double History::get_current_time() const
 {
-    return L.empty() ? oldest_recorded_instant : L.back().first;
+    return (n == 0) ? oldest_recorded_instant : back().first;
 }
 
 double History::get_value(const double tau) const
@@ -93,14 +165,14 @@ double History::get_value(const double tau) const
 
 double History::interpolate_value_in_interval(const size_t idx, const double t) const
 {
-    if ((idx == 0) or (idx >= L.size()))
+    if ((idx == 0) or (idx >= n))
     {
-        return L[0].second;
+        return front().second;
     }
-    const double tA = L[idx-1].first;
-    const double tB = L[idx].first;
-    const double yA = L[idx-1].second;
-    const double yB = L[idx].second;
+    const double tA = at(idx-1).first;
+    const double tB = at(idx).first;
+    const double yA = at(idx-1).second;
+    const double yB = at(idx).second;
 
     if (std::abs(t-tA) < 1E-12)
     {
@@ -115,50 +187,61 @@ double History::interpolate_value_in_interval(const size_t idx, const double t)
 
 void History::throw_if_already_added(const size_t idx, const double t, const double val) const
 {
-    if ((idx != L.size()) and (L[idx].first == t) and (val != L[idx].second))
+    if ((idx != n) and (at(idx).first == t) and (val != at(idx).second))
     {
         THROW(__PRETTY_FUNCTION__, InternalErrorException,
                 "Attempting to insert the same instant in History with different value: t = " << t << " already exists.");
     }
 }
 
-size_t History::find_braketing_position(const double t) const
+size_t History::guess_braketing_position(const double t) const
+{
+    // Samples are usually recorded with a constant time step: in that case the
+    // index can be computed directly. The first sample is left out because it
+    // is an interpolated value at oldest_recorded_instant (cf. shift_oldest_recorded_instant_if_necessary)
+    if (n <= 2) return 1;
+    const double t1 = at(1).first;
+    if (t <= t1) return 1;
+    const double dt = (back().first - t1)/(double)(n-2);
+    const size_t idx = 1 + (size_t)std::ceil((t - t1)/dt);
+    return std::min(idx, n-1);
+}
+
+bool History::is_braketing_position(const size_t idx, const double t) const
+{
+    return (idx > 0) and (idx < n) and (at(idx-1).first < t) and (t <= at(idx).first);
+}
+
+size_t History::binary_search_braketing_position(const double t) const
 {
-    if (L.empty())return 0;
-    if (L.back().first < t)           return L.size();
-    if (L.front().first >= t)         return 0;
     size_t idx_lower = 0;
-    size_t idx_greater = L.size()-1;
-    while (true)
+    size_t idx_greater = n-1;
+    while (idx_greater > idx_lower+1)
     {
-        if (t==L[idx_lower].first)
-        {
-            return idx_lower;
-        }
-        if (t==L[idx_greater].first)
-        {
-            return idx_greater;
-        }
-        if (idx_greater<=idx_lower+1)
+        const size_t idx_middle = (idx_lower + idx_greater)/2;
+        if (at(idx_middle).first < t)
         {
-            return idx_greater;
-        }
-        const size_t idx_middle = (size_t)std::floor(((double)idx_lower+(double)idx_greater)/2.);
-        const auto middle = L[idx_middle];
-        if (t==middle.first)
-        {
-            return idx_middle;
+            idx_lower = idx_middle;
         }
-        if (t < middle.first)
+        else // t <= middle.first
         {
             idx_greater = idx_middle;
         }
-        else // t > middle.first
-        {
-            idx_lower = idx_middle;
-        }
     }
-    return L.size();
+    return idx_greater;
+}
+
+size_t History::find_braketing_position(const double t) const
+{
+    if (n == 0)                return 0;
+    if (back().first < t)      return n;
+    if (front().first >= t)    return 0;
+    // From here on, n >= 2 and front().first < t <= back().first
+    const size_t idx = guess_braketing_position(t);
+    if (is_braketing_position(idx, t))   return idx;
+    if (is_braketing_position(idx-1, t)) return idx-1;
+    if (is_braketing_position(idx+1, t)) return idx+1;
+    return binary_search_braketing_position(t);
 }
 
 void History::shift_oldest_recorded_instant_if_necessary()
@@ -166,32 +249,33 @@ void History::shift_oldest_recorded_instant_if_necessary()
     if (get_current_time() - oldest_recorded_instant >= Tmax)
     {
         oldest_recorded_instant = get_current_time()-Tmax;
-        const double vmin = interpolate_value_in_interval(1, oldest_recorded_instant);
         const size_t idx = find_braketing_position(oldest_recorded_instant);
-        L.erase(L.begin(), L.begin() + (long) (idx));
-        if (not(almost_equal(L.front().first, oldest_recorded_instant,32)))
+        const double vmin = interpolate_value_in_interval(idx, oldest_recorded_instant);
+        pop_front(idx);
+        if (not(almost_equal(front().first, oldest_recorded_instant,32)))
         {
-            L.insert(L.begin(), std::make_pair(oldest_recorded_instant, vmin));
+            push_front(std::make_pair(oldest_recorded_instant, vmin));
         }
     }
 }
 
 void History::add_value_to_history(const double t, const double val)
 {
+    // record() guarantees t >= back().first so we either overwrite the latest value or append
     const size_t idx = find_braketing_position(t);
-    if ((idx != L.size()) and (almost_equal(L[idx].first, t)))
+    if ((idx != n) and (almost_equal(at(idx).first, t)))
     {
-        L[idx] = std::make_pair(t, val);
+        at(idx) = std::make_pair(t, val);
     }
     else
     {
-        L.insert(L.begin() + (long) (idx), std::make_pair(t, val));
+        push_back(std::make_pair(t, val));
     }
 }
 
 void History::update_oldest_recorded_instant(const double t)
 {
-    if (L.empty()) oldest_recorded_instant = t;
+    if (n == 0) oldest_recorded_instant = t;
     oldest_recorded_instant = std::min(oldest_recorded_instant, t);
 }
 
@@ -199,13 +283,13 @@ void History::record(double t, //!< Instant corresponding to the value being add
                      const double val //!< Value to add
                     )
 {
-    if (not(L.empty()))
+    if (n != 0)
     {
-        if  (almost_equal(t,L.back().first))
+        if  (almost_equal(t,back().first))
         {
-            t = L.back().first;
+            t = back().first;
         }
-        if (t < L.back().first)
+        if (t < back().first)
         {
             THROW(__PRETTY_FUNCTION__
                  , InternalErrorException
@@ -213,20 +297,21 @@ void History::record(double t, //!< Instant corresponding to the value being add
                    << t
                    <<
                    ", but the latest timestamp in history is "
-                   << L.back().first
+                   << back().first
                    << " (t-thistory.back = "
-                    << t-L.back().first
+                    << t-back().first
                     << ")");
         }
     }
     update_oldest_recorded_instant(t);
     add_value_to_history(t, val);
+    recorded_since_checkpoint = true;
     shift_oldest_recorded_instant_if_necessary();
 }
 
 size_t History::size() const
 {
-    return L.size();
+    return n;
 }
 
 double History::get_Tmax() const
@@ -236,18 +321,18 @@ double History::get_Tmax() const
 
 double History::get_duration() const
 {
-    if (L.empty()) return 0;
-    return L.back().first - L.front().first;
+    if (n == 0) return 0;
+    return back().first - front().first;
 }
 
 std::ostream& operator<<(std::ostream& os, const History& h)
 {
     os << "[";
-    for (size_t i = 0 ; i < h.L.size() -1 ; ++i)
+    for (size_t i = 0 ; i+1 < h.n ; ++i)
     {
-        os << "(" << h.L.at(i).first << "," << h.L.at(i).second << "), ";
+        os << "(" << h.at(i).first << "," << h.at(i).second << "), ";
     }
-    if (not(h.L.empty())) os << "(" << h.L.back().first << "," << h.L.back().second << ")";
+    if (h.n != 0) os << "(" << h.back().first << "," << h.back().second << ")";
     os << "]";
     return os;
 }
@@ -260,9 +345,9 @@ double History::trapeze(const double xa, const double ya, const double xb, const
 double History::integrate(const size_t idx) const
 {
     double ret = 0;
-    for (size_t i = idx ; i < L.size()-1 ; ++i)
+    for (size_t i = idx ; i+1 < n ; ++i)
     {
-        ret += trapeze(L.at(i).first, L.at(i).second, L.at(i+1).first, L.at(i+1).second);
+        ret += trapeze(at(i).first, at(i).second, at(i+1).first, at(i+1).second);
     }
     return ret;
 }
@@ -279,39 +364,75 @@ void History::check_if_average_can_be_retrieved(const double T) const
 
 double History::average(double T) const
 {
-    if (L.empty()) return 0;
-    if (L.size()==1) return L.front().second;
+    if (n == 0) return 0;
+    if (n == 1) return front().second;
     check_if_average_can_be_retrieved(T);
     T = std::min(T, get_duration());
     const double t = get_current_time() - T;
     const size_t idx = find_braketing_position(t);
     const double first_value = interpolate_value_in_interval(idx, t);
-    const double integral_of_first_interval = trapeze(t, first_value, L.at(idx).first, L.at(idx).second);
+    const double integral_of_first_interval = trapeze(t, first_value, at(idx).first, at(idx).second);
     const double integral_from_t_to_now = integrate(idx);
-    return  (T!=0) ? (integral_of_first_interval + integral_from_t_to_now)/T : L.back().second;
+    return  (T!=0) ? (integral_of_first_interval + integral_from_t_to_now)/T : back().second;
 }
 
 std::pair<double,double> History::operator[](const int index) const
 {
     if(index>=0)
     {
-        return L[(size_t)index];
+        return at((size_t)index);
     }
     else
     {
-        return L[L.size()+(size_t)index];
+        return at(n+(size_t)index);
     }
 }
 
 void History::reset()
 {
-    L.clear();
+    head = 0;
+    n = 0;
     oldest_recorded_instant = 0;
+    checkpoint_is_set = false;
+    revision++;
+}
+
+void History::save_checkpoint()
+{
+    checkpoint_is_set = true;
+    n_at_checkpoint = n;
+    back_at_checkpoint = (n == 0) ? TimeValue() : back();
+    oldest_recorded_instant_at_checkpoint = oldest_recorded_instant;
+    forgotten_since_checkpoint.clear();
+    nb_of_interpolated_samples_at_front = 0;
+    recorded_since_checkpoint = false;
+}
+
+void History::rewind_to_checkpoint()
+{
+    if (not(checkpoint_is_set) or not(recorded_since_checkpoint)) return;
+    revision++;
+    checkpoint_is_set = false; // So pop_front & push_front below are not tracked
+    pop_front(nb_of_interpolated_samples_at_front);
+    n = n_at_checkpoint - forgotten_since_checkpoint.size(); // Forget the samples recorded since the checkpoint
+    // n < n_at_checkpoint <= capacity so push_front never reallocates
+    for (auto it = forgotten_since_checkpoint.rbegin() ; it != forgotten_since_checkpoint.rend() ; ++it)
+    {
+        push_front(*it);
+    }
+    if (n != 0) at(n-1) = back_at_checkpoint;
+    oldest_recorded_instant = oldest_recorded_instant_at_checkpoint;
+    save_checkpoint();
+}
+
+size_t History::get_revision() const
+{
+    return revision;
 }
 
 bool History::is_empty() const
 {
-    return L.size() == 0;
+    return n == 0;
 }
 
 std::vector<double> History::get_values(const double tmax) const
@@ -321,13 +442,13 @@ std::vector<double> History::get_values(const double tmax) const
         return {this->operator()(0)};
     }
     std::vector<double> ret;
-    ret.reserve(L.size());
+    ret.reserve(n);
     const double t = get_current_time();
-    for (size_t i = 0 ; i < L.size() ; ++i)
+    for (size_t i = 0 ; i < n ; ++i)
     {
-        if (tmax >= t - L[i].first)
+        if (tmax >= t - at(i).first)
         {
-            ret.push_back(L[i].second);
+            ret.push_back(at(i).second);
         }
     }
     return ret;
@@ -341,13 +462,13 @@ std::vector<double> History::get_dates(const double tmax) const
         return {t};
     }
     std::vector<double> ret;
-    ret.reserve(L.size());
+    ret.reserve(n);
 
-    for (size_t i = 0 ; i < L.size() ; ++i)
+    for (size_t i = 0 ; i < n ; ++i)
     {
-        if (tmax >= t - L[i].first)
+        if (tmax >= t - at(i).first)
         {
-            ret.push_back(L[i].first);
+            ret.push_back(at(i).first);
         }
     }
     return ret;
@@ -64,6 +64,12 @@ double RadiationDampingBuilder::cos_transform(const std::function<double(double)
         case TypeOfQuadrature::FILON:
             return 2./PI*ssc::integrate::Filon(Br,tau).integrate_f(a, b);
             break;
+        case TypeOfQuadrature::PRONY:
+            THROW(__PRETTY_FUNCTION__, InternalErrorException, "Prony's method can only be used for the convolution: use gauss-kronrod, rectangle, simpson, trapezoidal, burcher, clenshaw-curtis or filon for the cos transform.");
+            break;
+        case TypeOfQuadrature::RETARDATION_GRID:
+            THROW(__PRETTY_FUNCTION__, InternalErrorException, "The retardation grid can only be used for the convolution: use gauss-kronrod, rectangle, simpson, trapezoidal, burcher, clenshaw-curtis or filon for the cos transform.");
+            break;
         default:
             THROW(__PRETTY_FUNCTION__, InternalErrorException, "Unknown quadrature type");
             break;
@@ -72,14 +78,20 @@ double RadiationDampingBuilder::cos_transform(const std::function<double(double)
 }
 
 std::function<double(double)> RadiationDampingBuilder::build_retardation_function(const std::function<double(double)>& Br, const std::vector<double>& taus, const double eps, const double omega_min, double omega_max) const
+{
+    return build_interpolator(taus, get_retardation_function_values(Br, taus, eps, omega_min, omega_max));
+}
+
+std::vector<double> RadiationDampingBuilder::get_retardation_function_values(const std::function<double(double)>& Br, const std::vector<double>& taus, const double eps, const double omega_min, double omega_max) const
 {
     omega_max = find_integration_bound(Br, omega_min, omega_max, eps);
     std::vector<double> y;
+    y.reserve(taus.size());
     for (auto tau:taus)
     {
         y.push_back(cos_transform(Br, omega_min, omega_max, tau));
     }
-    return build_interpolator(taus, y);
+    return y;
 }
 
 double RadiationDampingBuilder::convolution(const History& h, //!< State history
@@ -118,6 +130,16 @@ double RadiationDampingBuilder::convolution(const History& h, //!< State history
             THROW(__PRETTY_FUNCTION__, InternalErrorException, "Filon's method is not suitable for convolution: use gauss-kronrod, rectangle, simpson, trapezoidal, or burcher.");
             break;
         }
+        case TypeOfQuadrature::PRONY:
+        {
+            THROW(__PRETTY_FUNCTION__, InternalErrorException, "Prony's method is not a quadrature: the convolution should be computed using RecursiveConvolution.");
+            break;
+        }
+        case TypeOfQuadrature::RETARDATION_GRID:
+        {
+            THROW(__PRETTY_FUNCTION__, InternalErrorException, "Convolution on the retardation grid should be computed using ResampledHistory.");
+            break;
+        }
         default:
             THROW(__PRETTY_FUNCTION__, InternalErrorException, "Unknown quadrature type");
             break;
@@ -0,0 +1,207 @@
+/*
+ * RecursiveConvolution.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include <Eigen/Dense>
+
+#include "History.hpp"
+#include "InternalErrorException.hpp"
+#include "InvalidInputException.hpp"
+#include "RecursiveConvolution.hpp"
+
+typedef std::complex<double> Complex;
+
+ExponentialSum::ExponentialSum() : tau_min(0), poles(), residues()
+{
+}
+
+double ExponentialSum::operator()(const double tau) const
+{
+    Complex ret = 0;
+    for (size_t m = 0 ; m < poles.size() ; ++m)
+    {
+        ret += residues[m]*std::exp(poles[m]*(tau-tau_min));
+    }
+    return ret.real();
+}
+
+void check_prony_inputs(const std::vector<double>& taus, const size_t order);
+void check_prony_inputs(const std::vector<double>& taus, const size_t order)
+{
+    if (order == 0)
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "The number of exponentials used to approximate the retardation functions should be strictly positive.");
+    }
+    if (taus.size() < 2*order)
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "Prony's method needs at least twice as many points as there are exponentials: got "
+                << order << " exponentials but only " << taus.size() << " points. Increase 'nb of points for retardation function discretization' or decrease 'nb of exponentials for prony'.");
+    }
+}
+
+std::vector<Complex> get_prony_roots(const std::vector<double>& k, const size_t order);
+std::vector<Complex> get_prony_roots(const std::vector<double>& k, const size_t order)
+{
+    // Linear prediction: k[j+p] = -sum_{l<p} c_l k[j+l]
+    const size_t p = order;
+    const size_t n = k.size() - p;
+    Eigen::MatrixXd A(n, p);
+    Eigen::VectorXd b(n);
+    for (size_t j = 0 ; j < n ; ++j)
+    {
+        for (size_t l = 0 ; l < p ; ++l) A(j,l) = k[j+l];
+        b(j) = -k[j+p];
+    }
+    const Eigen::VectorXd c = A.jacobiSvd(Eigen::ComputeThinU | Eigen::ComputeThinV).solve(b);
+    // Roots of z^p + c_{p-1} z^{p-1} + ... + c_0 are the eigenvalues of the companion matrix
+    Eigen::MatrixXd companion = Eigen::MatrixXd::Zero(p, p);
+    for (size_t l = 1 ; l < p ; ++l) companion(l,l-1) = 1;
+    for (size_t l = 0 ; l < p ; ++l) companion(l,p-1) = -c(l);
+    const Eigen::VectorXcd eigenvalues = companion.eigenvalues();
+    std::vector<Complex> ret;
+    for (size_t l = 0 ; l < p ; ++l)
+    {
+        Complex z = eigenvalues(l);
+        const double r = std::abs(z);
+        if (r < 1E-12) continue; // Does not contribute
+        // Non-decreasing terms would make the recursive convolution diverge: mirror them inside the unit circle
+        if (r >= 1) z = r >= 1+1E-12 ? z/(r*r) : z*(1-1E-6);
+        ret.push_back(z);
+    }
+    return ret;
+}
+
+ExponentialSum prony(const std::function<double(double)>& K, const std::vector<double>& taus, const size_t order)
+{
+    check_prony_inputs(taus, order);
+    const double dtau = (taus.back()-taus.front())/(double)(taus.size()-1);
+    std::vector<double> k;
+    k.reserve(taus.size());
+    for (auto tau:taus) k.push_back(K(tau));
+
+    ExponentialSum ret;
+    ret.tau_min = taus.front();
+    const std::vector<Complex> z = get_prony_roots(k, order);
+    if (z.empty()) return ret; // K is identically zero
+    // Residues: least-squares fit of k[j] = sum_m r_m z_m^j
+    Eigen::MatrixXcd V(k.size(), z.size());
+    Eigen::VectorXcd y(k.size());
+    for (size_t j = 0 ; j < k.size() ; ++j)
+    {
+        y(j) = k[j];
+        for (size_t m = 0 ; m < z.size() ; ++m) V(j,m) = std::pow(z[m], (double)j);
+    }
+    const Eigen::VectorXcd r = V.jacobiSvd(Eigen::ComputeThinU | Eigen::ComputeThinV).solve(y);
+    for (size_t m = 0 ; m < z.size() ; ++m)
+    {
+        ret.poles.push_back(std::log(z[m])/dtau);
+        ret.residues.push_back(r(m));
+    }
+    return ret;
+}
+
+double relative_fit_error(const std::function<double(double)>& K, const ExponentialSum& approximation, const std::vector<double>& taus)
+{
+    double num = 0;
+    double den = 0;
+    for (auto tau:taus)
+    {
+        const double k = K(tau);
+        const double e = k - approximation(tau);
+        num += e*e;
+        den += k*k;
+    }
+    if (den == 0) return std::sqrt(num);
+    return std::sqrt(num/den);
+}
+
+RecursiveConvolution::State::State(const size_t nb_of_exponentials) : Z(nb_of_exponentials), Z_current(nb_of_exponentials), E(nb_of_exponentials), phi0(nb_of_exponentials), phi1(nb_of_exponentials), t_committed(0), initialized(false)
+{
+}
+
+RecursiveConvolution::RecursiveConvolution(const ExponentialSum& K_) : K(K_)
+{
+}
+
+RecursiveConvolution::State RecursiveConvolution::get_initial_state() const
+{
+    return State(K.poles.size());
+}
+
+void RecursiveConvolution::advance(const History& h, State& state, States& z, const double t0, const double t1) const
+{
+    if (t1 <= t0) return;
+    const double t = h.get_current_time();
+    // Sub-step at the history's (mean) sampling period so that long increments (eg. after a reset) stay accurate
+    const double mean_dt = h.size() > 1 ? h.get_duration()/(double)(h.size()-1) : t1-t0;
+    const size_t nb_of_substeps = std::max((size_t)1, (size_t)std::ceil((t1-t0)/mean_dt - 1E-9));
+    const double delta = (t1-t0)/(double)nb_of_substeps;
+    States& E = state.E;
+    States& phi0 = state.phi0;
+    States& phi1 = state.phi1;
+    for (size_t m = 0 ; m < K.poles.size() ; ++m)
+    {
+        const Complex s = K.poles[m];
+        const Complex x = s*delta;
+        E[m] = std::exp(x);
+        // phi0 = int_0^delta exp(s(delta-w))dw, phi1 = int_0^delta w/delta*exp(s(delta-w))dw
+        phi0[m] = std::abs(x) < 1E-4 ? delta*(1. + x/2. + x*x/6.)   : (E[m]-1.)/s;
+        phi1[m] = std::abs(x) < 1E-4 ? delta*(0.5 + x/6. + x*x/24.) : (E[m]-1.-x)/(s*x);
+    }
+    double y0 = h(std::max(0., t - (t0 - K.tau_min)));
+    for (size_t i = 1 ; i <= nb_of_substeps ; ++i)
+    {
+        const double y1 = h(std::max(0., t - (t0 + (double)i*delta - K.tau_min)));
+        for (size_t m = 0 ; m < z.size() ; ++m)
+        {
+            z[m] = E[m]*z[m] + y0*phi0[m] + (y1-y0)*phi1[m];
+        }
+        y0 = y1;
+    }
+}
+
+bool RecursiveConvolution::needs_reset(const History& h, const State& state) const
+{
+    const double oldest_instant = h.get_current_time() - h.get_duration();
+    return not(state.initialized)
+        or (h.get_current_time() < state.t_committed)
+        or (state.t_committed - K.tau_min < oldest_instant - 1E-12);
+}
+
+void RecursiveConvolution::reset(const History& h, State& state) const
+{
+    // Nothing before the start of the history: states are zero when the convolution window reaches it
+    state.t_committed = h.get_current_time() - h.get_duration() + K.tau_min;
+    for (auto& z:state.Z) z = 0;
+    state.initialized = true;
+}
+
+double RecursiveConvolution::operator()(const History& h, State& state) const
+{
+    if (state.Z.size() != K.poles.size())
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "State has " << state.Z.size() << " exponentials but the approximation has " << K.poles.size() << ": it should be built by get_initial_state.");
+    }
+    if (h.is_empty() or (h.get_duration() < K.tau_min)) return 0;
+    if (needs_reset(h, state)) reset(h, state);
+    const double t = h.get_current_time();
+    // All samples but the latest are final, so we can commit up to the previous one
+    const double t_final = h.size() > 1 ? h[-2].first + K.tau_min : state.t_committed;
+    const double t_commit = std::min(t, t_final);
+    if (t_commit > state.t_committed)
+    {
+        advance(h, state, state.Z, state.t_committed, t_commit);
+        state.t_committed = t_commit;
+    }
+    state.Z_current = state.Z;
+    advance(h, state, state.Z_current, state.t_committed, t);
+    Complex ret = 0;
+    for (size_t m = 0 ; m < state.Z_current.size() ; ++m) ret += K.residues[m]*state.Z_current[m];
+    return ret.real();
+}
@@ -0,0 +1,57 @@
+/*
+ * ResampledHistory.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "History.hpp"
+#include "InvalidInputException.hpp"
+#include "ResampledHistory.hpp"
+
+ResampledHistory::ResampledHistory(const std::vector<double>& taus) : tau_min(taus.empty() ? 0 : taus.front()), dtau(0), values(taus.size(), 0), nb_of_values(0), T(0), value_at_T(0)
+{
+    if (taus.size() < 2)
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "Need at least two points to discretize the retardation functions, but got " << taus.size());
+    }
+    dtau = (taus.back()-taus.front())/(double)(taus.size()-1);
+}
+
+void ResampledHistory::resample(const History& h, const double tau_max)
+{
+    nb_of_values = 0;
+    const double duration = h.get_duration();
+    if (h.is_empty() or (duration < tau_min)) return;
+    T = std::min(tau_max, duration);
+    nb_of_values = std::min(values.size(), (size_t)std::floor((T-tau_min)/dtau + 1E-9) + 1);
+    for (size_t j = 0 ; j < nb_of_values ; ++j)
+    {
+        values[j] = h(std::min(tau_min + (double)j*dtau, T));
+    }
+    value_at_T = h(T);
+}
+
+double ResampledHistory::convolution(const std::vector<double>& K) const
+{
+    const size_t m = nb_of_values;
+    if (m == 0) return 0;
+    double ret = 0;
+    for (size_t j = 1 ; j+1 < m ; ++j)
+    {
+        ret += K[j]*values[j];
+    }
+    if (m > 1) ret += 0.5*(K[0]*values[0] + K[m-1]*values[m-1]);
+    ret *= dtau;
+    // Last interval, between the last tau & T
+    const double r = T - (tau_min + (double)(m-1)*dtau);
+    if ((r > 0) and (m < K.size()))
+    {
+        const double K_T = K[m-1] + (K[m]-K[m-1])*r/dtau;
+        ret += 0.5*r*(K[m-1]*values[m-1] + K_T*value_at_T);
+    }
+    return ret;
+}
@@ -0,0 +1,25 @@
+/*
+ * ResampledHistoryTest.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+
+#ifndef RESAMPLEDHISTORYTEST_HPP_
+#define RESAMPLEDHISTORYTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator/DataGenerator.hpp>
+
+class ResampledHistoryTest : public ::testing::Test
+{
+    protected:
+        ResampledHistoryTest();
+        virtual ~ResampledHistoryTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif  /* RESAMPLEDHISTORYTEST_HPP_ */
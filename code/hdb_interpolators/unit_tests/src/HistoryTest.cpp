@@ -7,6 +7,7 @@
 
 #include <algorithm>    // std::transform
 #include <numeric>      // std::partial_sum
+#include <cmath>
 
 #include "History.hpp"
 #include "HistoryTest.hpp"
@@ -380,3 +381,126 @@ TEST_F(HistoryTest, can_get_list_of_values)
         }
     }
 }
+
+TEST_F(HistoryTest, values_should_still_be_correct_after_the_circular_buffer_wraps_around)
+{
+    const double dt = 0.01;
+    History h(1);
+    for (size_t i = 0 ; i < 10000 ; ++i)
+    {
+        h.record((double)i*dt, (double)i);
+    }
+    ASSERT_EQ(101, h.size());
+    ASSERT_DOUBLE_EQ(9999, h(0));
+    ASSERT_DOUBLE_EQ(9899, h(1));
+    ASSERT_DOUBLE_EQ(9949.5, h(0.495));
+    ASSERT_DOUBLE_EQ(9899, h[0].second);
+    ASSERT_DOUBLE_EQ(9999, h[-1].second);
+}
+
+TEST_F(HistoryTest, interpolation_should_be_correct_when_time_step_is_not_uniform)
+{
+    History h(10);
+    double t = 0;
+    h.record(t, 0);
+    for (size_t i = 0 ; i < 1000 ; ++i)
+    {
+        t += a.random<double>().between(1E-3,1E-1);
+        h.record(t, 2*t);
+        const double tau = a.random<double>().between(0,std::min(t,10.));
+        ASSERT_NEAR(2*(t-tau), h(tau), 1E-10) << "i = " << i;
+    }
+}
+
+TEST_F(HistoryTest, oldest_value_should_be_interpolated_in_the_interval_containing_it)
+{
+    History h(1);
+    h.record(0, 0);
+    h.record(0.6, 0.36);
+    h.record(1, 1);
+    h.record(1.3, 1.69);
+    h.record(2.1, 4.41);
+    ASSERT_EQ(3, h.size());
+    ASSERT_DOUBLE_EQ(1.23, h(1));
+}
+
+void assert_same_history(const History& expected, const History& actual);
+void assert_same_history(const History& expected, const History& actual)
+{
+    ASSERT_EQ(expected.size(), actual.size());
+    for (int i = 0 ; i < (int)expected.size() ; ++i)
+    {
+        ASSERT_EQ(expected[i], actual[i]) << "i = " << i;
+    }
+    ASSERT_EQ(expected.get_current_time(), actual.get_current_time());
+    ASSERT_EQ(expected.get_duration(), actual.get_duration());
+}
+
+TEST_F(HistoryTest, rewinding_should_undo_all_records_made_since_the_checkpoint)
+{
+    //! [HistoryTest checkpoint_example]
+    History h(10);
+    h.record(0, 1);
+    h.record(1, 2);
+    h.save_checkpoint();
+    const History expected = h;
+    h.record(1, 3);
+    h.record(1.5, 4);
+    h.rewind_to_checkpoint();
+    //! [HistoryTest checkpoint_example]
+    assert_same_history(expected, h);
+    h.record(2, 5);
+    h.rewind_to_checkpoint();
+    assert_same_history(expected, h);
+}
+
+TEST_F(HistoryTest, rewinding_should_restore_the_samples_forgotten_since_the_checkpoint)
+{
+    History h(0.5);
+    double t = 0;
+    for (size_t i = 0 ; i < 2000 ; ++i)
+    {
+        h.save_checkpoint();
+        const History expected = h;
+        const double dt = a.random<double>().between(1E-3,0.3);
+        // Same sequence of instants as a 4th order Runge-Kutta scheme, the last stage being accepted
+        for (const double t_stage:{t, t+dt/2, t+dt/2, t+dt})
+        {
+            h.rewind_to_checkpoint();
+            assert_same_history(expected, h);
+            h.record(t_stage, std::sin(t_stage));
+        }
+        t += dt;
+    }
+}
+
+TEST_F(HistoryTest, rewinding_without_checkpoint_does_nothing)
+{
+    History h(10);
+    h.record(0, 1);
+    h.save_checkpoint();
+    h.reset();
+    h.record(1, 2);
+    h.rewind_to_checkpoint();
+    ASSERT_EQ(1, h.size());
+    ASSERT_EQ(2, h());
+}
+
+TEST_F(HistoryTest, revision_only_changes_when_recorded_samples_are_undone)
+{
+    History h(10);
+    h.record(0, 1);
+    const size_t revision = h.get_revision();
+    h.save_checkpoint();
+    h.rewind_to_checkpoint();
+    ASSERT_EQ(revision, h.get_revision());
+    h.record(1, 2);
+    h.record(2, 3);
+    ASSERT_EQ(revision, h.get_revision());
+    h.rewind_to_checkpoint();
+    ASSERT_EQ(revision+1, h.get_revision());
+    h.rewind_to_checkpoint();
+    ASSERT_EQ(revision+1, h.get_revision());
+    h.reset();
+    ASSERT_EQ(revision+2, h.get_revision());
+}
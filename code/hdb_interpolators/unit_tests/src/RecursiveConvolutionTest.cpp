@@ -0,0 +1,156 @@
+/*
+ * RecursiveConvolutionTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include "History.hpp"
+#include "InvalidInputException.hpp"
+#include "RadiationDampingBuilder.hpp"
+#include "RecursiveConvolution.hpp"
+#include "RecursiveConvolutionTest.hpp"
+
+#include <cmath>
+
+RecursiveConvolutionTest::RecursiveConvolutionTest() : a(ssc::random_data_generator::DataGenerator(8762))
+{
+}
+
+RecursiveConvolutionTest::~RecursiveConvolutionTest()
+{
+}
+
+void RecursiveConvolutionTest::SetUp()
+{
+}
+
+void RecursiveConvolutionTest::TearDown()
+{
+}
+
+double K(const double tau);
+double K(const double tau)
+{
+    return std::exp(-0.5*tau)*std::cos(2*tau) + 0.3*std::exp(-0.1*tau);
+}
+
+double reference_convolution(const History& h, const double tau_min);
+double reference_convolution(const History& h, const double tau_min)
+{
+    // Fine trapezoidal rule
+    const size_t n = 20000;
+    const double T = h.get_duration();
+    double ret = 0;
+    for (size_t i = 0 ; i <= n ; ++i)
+    {
+        const double tau = tau_min + (T-tau_min)*(double)i/(double)n;
+        const double w = ((i == 0) or (i == n)) ? 0.5 : 1;
+        ret += w*K(tau)*h(tau);
+    }
+    return ret*(T-tau_min)/(double)n;
+}
+
+TEST_F(RecursiveConvolutionTest, prony_can_retrieve_a_sum_of_exponentials)
+{
+    //! [RecursiveConvolutionTest prony_example]
+    const RadiationDampingBuilder builder(TypeOfQuadrature::SIMPSON, TypeOfQuadrature::SIMPSON);
+    const std::vector<double> taus = builder.build_regular_intervals(0.2, 50, 50);
+    const ExponentialSum approximation = prony(K, taus, 4);
+    //! [RecursiveConvolutionTest prony_example]
+    for (size_t i = 0 ; i < 100 ; ++i)
+    {
+        const double tau = a.random<double>().between(0.2, 50);
+        ASSERT_NEAR(K(tau), approximation(tau), 1E-10) << "tau = " << tau;
+    }
+    ASSERT_NEAR(0, relative_fit_error(K, approximation, builder.build_regular_intervals(0.2, 50, 500)), 1E-10);
+    for (const auto s:approximation.poles)
+    {
+        ASSERT_LT(s.real(), 0);
+    }
+}
+
+TEST_F(RecursiveConvolutionTest, prony_should_throw_if_there_are_not_enough_points)
+{
+    const RadiationDampingBuilder builder(TypeOfQuadrature::SIMPSON, TypeOfQuadrature::SIMPSON);
+    ASSERT_THROW(prony(K, builder.build_regular_intervals(0.2, 50, 7), 4), InvalidInputException);
+    ASSERT_THROW(prony(K, builder.build_regular_intervals(0.2, 50, 7), 0), InvalidInputException);
+    ASSERT_NO_THROW(prony(K, builder.build_regular_intervals(0.2, 50, 8), 4));
+}
+
+TEST_F(RecursiveConvolutionTest, approximation_of_zero_is_zero)
+{
+    const RadiationDampingBuilder builder(TypeOfQuadrature::SIMPSON, TypeOfQuadrature::SIMPSON);
+    const ExponentialSum approximation = prony([](const double){return 0;}, builder.build_regular_intervals(0.2, 10, 50), 8);
+    ASSERT_TRUE(approximation.poles.empty());
+    ASSERT_EQ(0, approximation(a.random<double>().between(0.2,10)));
+}
+
+TEST_F(RecursiveConvolutionTest, should_match_quadrature)
+{
+    //! [RecursiveConvolutionTest example]
+    const RadiationDampingBuilder builder(TypeOfQuadrature::PRONY, TypeOfQuadrature::SIMPSON);
+    const double tau_min = 0.2;
+    const RecursiveConvolution convolution(prony(K, builder.build_regular_intervals(tau_min, 50, 50), 4));
+    RecursiveConvolution::State state = convolution.get_initial_state();
+    History h(1000);
+    const double dt = 0.05;
+    for (size_t i = 0 ; i < 600 ; ++i)
+    {
+        // Same sequence of instants as a 4th order Runge-Kutta scheme
+        const double t = (double)i*dt;
+        for (const double t_stage:{t, t+dt/2, t+dt/2, t+dt})
+        {
+            h.record(t_stage, std::sin(0.7*t_stage) + 0.2);
+            const double recursive = convolution(h, state);
+            if (h.get_duration() < tau_min)
+            {
+                ASSERT_EQ(0, recursive);
+            }
+            else if (i % 50 == 0)
+            {
+                ASSERT_NEAR(reference_convolution(h, tau_min), recursive, 1E-4) << "t = " << t_stage;
+            }
+        }
+    }
+    //! [RecursiveConvolutionTest example]
+}
+
+TEST_F(RecursiveConvolutionTest, should_restart_from_scratch_if_history_is_reset)
+{
+    const RadiationDampingBuilder builder(TypeOfQuadrature::PRONY, TypeOfQuadrature::SIMPSON);
+    const RecursiveConvolution convolution(prony(K, builder.build_regular_intervals(0.2, 50, 50), 4));
+    RecursiveConvolution::State state = convolution.get_initial_state();
+    History h(1000);
+    for (size_t i = 0 ; i < 200 ; ++i)
+    {
+        h.record((double)i*0.1, 1);
+        convolution(h, state);
+    }
+    h.reset();
+    for (size_t i = 0 ; i < 100 ; ++i)
+    {
+        h.record((double)i*0.1, std::cos((double)i*0.1));
+    }
+    ASSERT_NEAR(reference_convolution(h, 0.2), convolution(h, state), 1E-4);
+}
+
+TEST_F(RecursiveConvolutionTest, can_be_shared_by_several_histories)
+{
+    const RadiationDampingBuilder builder(TypeOfQuadrature::PRONY, TypeOfQuadrature::SIMPSON);
+    const RecursiveConvolution convolution(prony(K, builder.build_regular_intervals(0.2, 50, 50), 4));
+    RecursiveConvolution::State state1 = convolution.get_initial_state();
+    RecursiveConvolution::State state2 = convolution.get_initial_state();
+    History h1(1000);
+    History h2(1000);
+    for (size_t i = 0 ; i < 200 ; ++i)
+    {
+        const double t = (double)i*0.1;
+        h1.record(t, std::sin(t));
+        h2.record(t, 1 + std::cos(2*t));
+        convolution(h1, state1);
+        convolution(h2, state2);
+    }
+    ASSERT_NEAR(reference_convolution(h1, 0.2), convolution(h1, state1), 1E-4);
+    ASSERT_NEAR(reference_convolution(h2, 0.2), convolution(h2, state2), 1E-4);
+}
@@ -0,0 +1,106 @@
+/*
+ * ResampledHistoryTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include "History.hpp"
+#include "InvalidInputException.hpp"
+#include "RadiationDampingBuilder.hpp"
+#include "ResampledHistory.hpp"
+#include "ResampledHistoryTest.hpp"
+
+#include <cmath>
+
+ResampledHistoryTest::ResampledHistoryTest() : a(ssc::random_data_generator::DataGenerator(9912))
+{
+}
+
+ResampledHistoryTest::~ResampledHistoryTest()
+{
+}
+
+void ResampledHistoryTest::SetUp()
+{
+}
+
+void ResampledHistoryTest::TearDown()
+{
+}
+
+TEST_F(ResampledHistoryTest, example)
+{
+    //! [ResampledHistoryTest example]
+    const RadiationDampingBuilder builder(TypeOfQuadrature::SIMPSON, TypeOfQuadrature::SIMPSON);
+    const std::vector<double> taus = builder.build_regular_intervals(0.5, 10, 20);
+    const std::vector<double> K(taus.size(), 2);
+    History h(20);
+    for (size_t i = 0 ; i <= 73 ; ++i) h.record(0.1*(double)i, 3*0.1*(double)i);
+    ResampledHistory resampled(taus);
+    resampled.resample(h, 10);
+    //! [ResampledHistoryTest example]
+    // Integrand is linear so the trapezoidal rule is exact: int_0.5^7.3 2*3*(7.3-tau) dtau
+    ASSERT_NEAR(3*6.8*6.8, resampled.convolution(K), 1E-10);
+}
+
+TEST_F(ResampledHistoryTest, convolution_should_stop_at_tau_max)
+{
+    const RadiationDampingBuilder builder(TypeOfQuadrature::SIMPSON, TypeOfQuadrature::SIMPSON);
+    const std::vector<double> taus = builder.build_regular_intervals(0.5, 10, 20);
+    const std::vector<double> K(taus.size(), 2);
+    History h(20);
+    for (size_t i = 0 ; i <= 150 ; ++i) h.record(0.1*(double)i, 1);
+    ResampledHistory resampled(taus);
+    resampled.resample(h, 10);
+    ASSERT_NEAR(2*9.5, resampled.convolution(K), 1E-10);
+}
+
+TEST_F(ResampledHistoryTest, convolution_is_zero_if_history_is_too_short)
+{
+    const RadiationDampingBuilder builder(TypeOfQuadrature::SIMPSON, TypeOfQuadrature::SIMPSON);
+    const std::vector<double> taus = builder.build_regular_intervals(0.5, 10, 20);
+    const std::vector<double> K(taus.size(), 2);
+    History h(20);
+    ResampledHistory resampled(taus);
+    resampled.resample(h, 10);
+    ASSERT_EQ(0, resampled.convolution(K));
+    h.record(0, 1);
+    h.record(0.4, 1);
+    resampled.resample(h, 10);
+    ASSERT_EQ(0, resampled.convolution(K));
+}
+
+TEST_F(ResampledHistoryTest, should_be_close_to_fine_quadrature)
+{
+    const auto f = [](const double tau){return std::exp(-0.5*tau)*std::cos(2*tau);};
+    const auto x = [](const double t){return std::sin(0.7*t);};
+    const RadiationDampingBuilder builder(TypeOfQuadrature::SIMPSON, TypeOfQuadrature::SIMPSON);
+    const std::vector<double> taus = builder.build_regular_intervals(0.2, 10, 200);
+    std::vector<double> K;
+    for (const auto tau:taus) K.push_back(f(tau));
+    History h(10);
+    ResampledHistory resampled(taus);
+    for (size_t k = 0 ; k < 10 ; ++k)
+    {
+        const double t = a.random<double>().between(5, 20);
+        h.reset();
+        for (size_t i = 0 ; i <= 2000 ; ++i) h.record(t-20+0.01*(double)i, x(t-20+0.01*(double)i));
+        resampled.resample(h, 10);
+        double reference = 0;
+        const size_t n = 20000;
+        for (size_t i = 0 ; i <= n ; ++i)
+        {
+            const double tau = 0.2 + 9.8*(double)i/(double)n;
+            const double w = ((i == 0) or (i == n)) ? 0.5 : 1;
+            reference += w*f(tau)*x(t-tau);
+        }
+        reference *= 9.8/(double)n;
+        ASSERT_NEAR(reference, resampled.convolution(K), 2E-3) << "t = " << t;
+    }
+}
+
+TEST_F(ResampledHistoryTest, should_throw_if_there_are_not_enough_taus)
+{
+    ASSERT_THROW(ResampledHistory(std::vector<double>(1, 0.2)), InvalidInputException);
+}
@@ -42,6 +42,24 @@ namespace H5_Tools
 
     H5::DataSpace createDataSpace1DUnlimited();
 
+    /**
+     * \brief creates a 2D dataspace with no rows, that can be extended along
+     *        its first dimension
+     * \param[in] nb_of_columns size of the second dimension
+     */
+    H5::DataSpace createDataSpace2DEmptyUnlimited(const hsize_t nb_of_columns);
+
+    /**
+     * \brief creation properties of a chunked dataset
+     * \param[in] chunk_dims size of each chunk (one value per dimension of
+     *                       the dataset)
+     * \param[in] compress if true, the data is shuffled and deflated
+     *                     (compression level 4)
+     */
+    H5::DSetCreatPropList createChunkedProperties(
+            const std::vector<hsize_t>& chunk_dims,
+            const bool compress);
+
     /**
      * \brief creates a dataset, if not existing. Else, this function throws an
      *        exception
@@ -56,6 +74,15 @@ namespace H5_Tools
             const H5::H5File& file, const std::string& datasetName,
             const H5::DataType& datasetType, const H5::DataSpace& space);
 
+    /**
+     * \brief same as above, but with the given creation properties (eg.
+     *        from createChunkedProperties) instead of chunks of size 1
+     */
+    H5::DataSet createDataSet(
+            const H5::H5File& file, const std::string& datasetName,
+            const H5::DataType& datasetType, const H5::DataSpace& space,
+            const H5::DSetCreatPropList& properties);
+
     /**
      * \brief open an existing data set
      * \param[in] file HDF5 file descriptor
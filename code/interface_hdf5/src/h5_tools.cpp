@@ -138,11 +138,16 @@ H5::DataSet H5_Tools::createDataSet(
         const H5::DataSpace& space)
 {
     const int nDims = space.getSimpleExtentNdims();
-    hsize_t * chunk_dims = new hsize_t[nDims];
-    for (int i=0;i<nDims;++i) chunk_dims[i]=1;
-    H5::DSetCreatPropList cparms;
-    cparms.setChunk(nDims, chunk_dims);
-    delete [] chunk_dims;
+    return createDataSet(file, datasetName, datasetType, space, createChunkedProperties(std::vector<hsize_t>(nDims, 1), false));
+}
+
+H5::DataSet H5_Tools::createDataSet(
+        const H5::H5File& file,
+        const std::string& datasetName,
+        const H5::DataType& datasetType,
+        const H5::DataSpace& space,
+        const H5::DSetCreatPropList& properties)
+{
     createMissingGroups(file, datasetName);
     if (H5_Tools::doesDataSetExist(file, datasetName))
     {
@@ -150,10 +155,24 @@ H5::DataSet H5_Tools::createDataSet(
     }
     else
     {
-        return file.createDataSet(datasetName, datasetType, space, cparms);
+        return file.createDataSet(datasetName, datasetType, space, properties);
     }
 }
 
+H5::DSetCreatPropList H5_Tools::createChunkedProperties(
+        const std::vector<hsize_t>& chunk_dims,
+        const bool compress)
+{
+    H5::DSetCreatPropList properties;
+    properties.setChunk((int)chunk_dims.size(), chunk_dims.data());
+    if (compress)
+    {
+        properties.setShuffle();
+        properties.setDeflate(4);
+    }
+    return properties;
+}
+
 H5::DataSet H5_Tools::openDataSet(
         const H5::H5File& file, const std::string& datasetName)
 {
@@ -202,6 +221,13 @@ H5::DataSpace H5_Tools::createDataSpace1DUnlimited()
     return H5::DataSpace(1, dims, maxdims);
 }
 
+H5::DataSpace H5_Tools::createDataSpace2DEmptyUnlimited(const hsize_t nb_of_columns)
+{
+    const hsize_t dims[2] = {0, nb_of_columns};
+    const hsize_t maxdims[2] = {H5S_UNLIMITED, nb_of_columns};
+    return H5::DataSpace(2, dims, maxdims);
+}
+
 bool H5_Tools::doesFileExists(const std::string& filename)
 {
     return (h5_doesFileExists(filename.c_str())?true:false);
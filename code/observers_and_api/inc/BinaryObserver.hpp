@@ -0,0 +1,65 @@
+/*
+ * BinaryObserver.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef BINARYOBSERVER_HPP_
+#define BINARYOBSERVER_HPP_
+
+#include <cstdint>
+#include <fstream>
+
+#include "Observer.hpp"
+
+#define XDYN_BINARY_MAGIC "XDYNBIN"         // Followed by a null character (8 bytes)
+#define XDYN_BINARY_VERSION 1
+#define XDYN_BINARY_HEADER_SIZE 32          // Bytes before the names of the columns
+#define XDYN_BINARY_ALIGNMENT 64            // The first row starts at a multiple of this number of bytes
+
+/** \brief Writes the scalar outputs in a binary file, as a table of 64-bit floats
+ *  \details Layout of the file (integers & floats in little-endian order, whatever the byte order of the machine):
+ *           - bytes 0-7: XDYN_BINARY_MAGIC followed by a null character
+ *           - bytes 8-11: format version (uint32)
+ *           - bytes 12-15: number of columns (uint32)
+ *           - bytes 16-23: number of rows (uint64), only written when the observer is destroyed (0 until then)
+ *           - bytes 24-31: offset of the first row in the file (uint64, multiple of XDYN_BINARY_ALIGNMENT)
+ *           - name of each column, each followed by '\n', then zeros up to the first row
+ *           - the rows (one per time step), each made of one float64 per column.
+ *           Each column is therefore a strided view of the file, which can be memory-mapped without
+ *           any conversion (eg. with numpy.memmap). The rows are copied in a preallocated buffer & written
+ *           by blocks of nb_of_buffered_rows, the remaining rows being written when the observer is destroyed.
+ *  \addtogroup observers_and_api
+ *  \ingroup observers_and_api
+ *  \section ex1 Example
+ *  \snippet observers_and_api/unit_tests/src/BinaryObserverTest.cpp BinaryObserverTest example
+ */
+class BinaryObserver : public Observer
+{
+    public:
+        BinaryObserver(const std::string& filename,
+                       const std::vector<std::string>& data,
+                       const size_t nb_of_buffered_rows = 512 //!< Number of rows written at once
+                       );
+        ~BinaryObserver();
+
+    private:
+        BinaryObserver(); // Disabled
+        void initialize_row(const std::vector<DataAddressing>& columns);
+        void write_row(const std::vector<double>& values);
+        void flush_after_initialization();
+        void flush_after_write();
+        void write_buffer();
+        void write_nb_of_rows();
+
+        std::ofstream os;
+        size_t buffer_capacity;     //!< Maximum number of rows in 'buffer'
+        size_t nb_of_columns;
+        std::vector<double> buffer; //!< Rows not yet written (row-major)
+        size_t nb_of_rows_in_buffer;
+        std::uint64_t nb_of_rows;   //!< Number of rows written so far
+        bool header_was_written;    //!< False until initialize_row is called (even without any column)
+};
+
+#endif /* BINARYOBSERVER_HPP_ */
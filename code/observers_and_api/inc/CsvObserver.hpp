@@ -12,6 +12,11 @@
 
 #include "Observer.hpp"
 
+/** \brief Writes the outputs in a CSV file (or on the standard output if the file name is empty)
+ *  \details The values are written with format_double, so they are read back exactly. Each row is built in
+ *           a string reused from one row to the next & written with a single call to std::ostream::write. The
+ *           rows are only flushed when they are written on the standard output.
+ */
 class CsvObserver : public Observer
 {
     public:
@@ -19,18 +24,15 @@ class CsvObserver : public Observer
         ~CsvObserver();
 
     private:
+        void initialize_row(const std::vector<DataAddressing>& columns);
+        void write_row(const std::vector<double>& values);
         void flush_after_initialization();
         void flush_after_write();
-        void flush_value_during_write();
+        void write_text();
 
         bool output_to_file;
         std::ostream& os;
-
-        using Observer::get_serializer;
-        using Observer::get_initializer;
-
-        std::function<void()> get_serializer(const double val, const DataAddressing& address);
-        std::function<void()> get_initializer(const double val, const DataAddressing& address);
+        std::string text; //!< Current row
 };
 
 #endif /* CSVOBSERVER_HPP_ */
@@ -19,23 +19,21 @@ class DictObserver : public Observer
 
     protected:
         virtual void flush_after_initialization(){};
-        virtual void flush_value_during_write(){};
         virtual void flush_after_write();
 
-        using Observer::get_serializer;
-        using Observer::get_initializer;
+        void initialize_row(const std::vector<DataAddressing>& columns);
+        void write_row(const std::vector<double>& values);
 
-        std::function<void()> get_serializer(const double val, const DataAddressing& address);
-        std::function<void()> get_initializer(const double val, const DataAddressing& address);
 
         std::function<void()> get_serializer(const SurfaceElevationGrid& val, const DataAddressing& address);
         std::function<void()> get_initializer(const SurfaceElevationGrid& val, const DataAddressing& address);
 
-        std::stringstream ss;
+        std::string text; //!< Current row (reused from one row to the next, so the scalar outputs need no allocation once it has reached its final size)
     private:
         std::stringstream ssSurfaceElevationGrid;
         DictMap1 dictMap1;
         DictMap2 dictMap2;
+        std::vector<double*> destination_of_column; //!< Element of dictMap1 or dictMap2 written by each column (nullptr if the column is not serialized)
         bool shouldWeAddAStartingComma;
         void serializeDictMap1();
         void serializeDictMap2();
@@ -6,6 +6,7 @@
 #include <ssc/macros.hpp>
 #include TR1INC(memory)
 #include "H5Cpp.h"
+#include "Hdf5WaveObserver.hpp"
 
 struct Hdf5Addressing
 {
@@ -17,33 +18,48 @@ struct Hdf5Addressing
             );
 };
 
-class Hdf5WaveObserver;
+/** \brief Writes the outputs in an HDF5 file
+ *  \details The rows are kept in memory & written by blocks of nb_of_buffered_rows (one extension & one write
+ *           per dataset & per block), the remaining rows being written when the observer is destroyed. By default
+ *           each scalar is written in its own dataset (eg. /outputs/states/ball/x). With 'write_table', all
+ *           scalars are written in a single 2D dataset (/outputs/table, one row per time step) & the address
+ *           each column would have had in the default layout is written in /outputs/table_columns (one per line).
+ */
 class Hdf5Observer : public Observer
 {
     public:
-        Hdf5Observer(const std::string& filename, const std::vector<std::string>& data);
+        Hdf5Observer(const std::string& filename,
+                     const std::vector<std::string>& data,
+                     const bool compress = false,           //!< Use the shuffle & deflate filters
+                     const bool write_table = false,        //!< Write all scalars in one 2D dataset instead of one dataset per scalar
+                     const size_t nb_of_buffered_rows = 512, //!< Number of rows written at once (also the size of the chunks along the time axis)
+                     const Hdf5WaveObserverOptions& wave_options = Hdf5WaveObserverOptions() //!< Storage of the wave elevations (precision & decimation)
+                     );
+        ~Hdf5Observer();
         void write_before_simulation(const std::vector<DiscreteDirectionalWaveSpectrum>& val, const DataAddressing& address);
         void write_before_simulation(const std::vector<FlatDiscreteDirectionalWaveSpectrum>& val, const DataAddressing& address);
     private:
+        void initialize_row(const std::vector<DataAddressing>& columns);
+        void write_row(const std::vector<double>& values);
         void flush_after_initialization();
         void flush_after_write();
-        void flush_value_during_write();
+        void write_buffer();
 
-        using Observer::get_serializer;
-        using Observer::get_initializer;
-
-        std::function<void()> get_serializer(const double val, const DataAddressing& address);
-        std::function<void()> get_initializer(const double val, const DataAddressing& address);
 
         std::function<void()> get_serializer(const SurfaceElevationGrid& val, const DataAddressing& address);
         std::function<void()> get_initializer(const SurfaceElevationGrid& val, const DataAddressing& address);
 
         H5::H5File h5File;
         std::string basename;
-        std::map<std::string, std::string > name2address;
-        std::map<std::string, H5::DataSet> name2dataset;
-        std::map<std::string, H5::DataType> name2datatype;
-        std::map<std::string, H5::DataSpace> name2dataspace;
+        bool compress;
+        bool write_table;
+        size_t buffer_capacity;            //!< Maximum number of rows in 'buffer'
+        size_t nb_of_columns;
+        std::vector<double> buffer;        //!< Rows not yet written (row-major if write_table, column-major otherwise)
+        size_t nb_of_rows_in_buffer;
+        std::vector<H5::DataSet> datasets; //!< One per column of the row (or only one if write_table)
+        hsize_t nb_of_rows;                //!< Number of rows written so far (current size of each dataset)
+        Hdf5WaveObserverOptions wave_options;
 
         TR1(shared_ptr)<Hdf5WaveObserver> wave_serializer;
 };
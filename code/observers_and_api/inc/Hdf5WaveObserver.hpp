@@ -7,6 +7,19 @@
 #include "H5Cpp.h"
 #include "SurfaceElevationGrid.hpp"
 
+struct Hdf5WaveObserverOptions
+{
+    Hdf5WaveObserverOptions();
+    bool single_precision; //!< Store the elevations as 32-bit floats (the dates & the axes stay in double precision)
+    size_t decimation;     //!< Only store one frame out of 'decimation' (the first frame is always stored)
+};
+
+/** \brief Writes the wave elevations on the output grid in an HDF5 group
+ *  \details The group contains t (date of each frame), z (elevations, nx x ny x nt), x & y (one row per
+ *           grid position: the axes are only written again when the grid moves, eg. when the output mesh
+ *           is attached to a ship) & t_axes (date from which each row of x & y applies). Each chunk of z
+ *           holds a whole frame, so each frame is written in a single chunk.
+ */
 class Hdf5WaveObserver
 {
     public:
@@ -14,13 +27,15 @@ class Hdf5WaveObserver
                 const H5::H5File& h5File,
                 const std::string& datasetName = "WaveElevation",
                 const std::size_t nx = 0,
-                const std::size_t ny = 0);
+                const std::size_t ny = 0,
+                const Hdf5WaveObserverOptions& options = Hdf5WaveObserverOptions());
 
         Hdf5WaveObserver(
                 const std::string& fileName,
                 const std::string& datasetName = "WaveElevation",
                 const std::size_t nx = 0,
-                const std::size_t ny = 0);
+                const std::size_t ny = 0,
+                const Hdf5WaveObserverOptions& options = Hdf5WaveObserverOptions());
 
         Hdf5WaveObserver& operator<<(const SurfaceElevationGrid& waveElevationGrid);
 
@@ -12,13 +12,17 @@ class Hdf5WaveObserverBuilder
             const std::string& fileName,
             const std::string& datasetName,
             const size_t nx,
-            const size_t ny);
+            const size_t ny,
+            const bool single_precision = false //!< Store Z as 32-bit floats
+            );
 
         Hdf5WaveObserverBuilder(
             const H5::H5File& h5File,
             const std::string& datasetName,
             const size_t nx,
-            const size_t ny);
+            const size_t ny,
+            const bool single_precision = false //!< Store Z as 32-bit floats
+            );
 
         H5::H5File get_h5File() const;
         H5::Group get_group() const;
@@ -26,6 +30,7 @@ class Hdf5WaveObserverBuilder
         H5Element get_h5ElementX() const;
         H5Element get_h5ElementY() const;
         H5Element get_h5ElementZ() const;
+        H5Element get_h5ElementTAxes() const;
         size_t get_nx() const {return nx;};
         size_t get_ny() const {return ny;};
     private:
@@ -34,6 +39,7 @@ class Hdf5WaveObserverBuilder
         H5::Group group;
         size_t nx;
         size_t ny;
+        bool single_precision;
 };
 
 #endif
@@ -15,12 +15,23 @@ struct YamlOutput;
 class ListOfObservers
 {
     public:
-        ListOfObservers(const std::vector<YamlOutput>& yaml);
+        /**  \brief Builds the observers of the 'output' section of the YAML file
+          *  \details With 'write_asynchronously', the outputs written in files or sent on the network (ie. all
+          *           but 'map') are formatted & written by a dedicated thread (cf. ObserverWriter), so the
+          *           simulation does not wait for the I/O (unless that thread falls too far behind).
+          */
+        ListOfObservers(const std::vector<YamlOutput>& yaml, const bool write_asynchronously = false);
         ListOfObservers(const std::vector<ObserverPtr>& observers);
+        ~ListOfObservers();
         void observe(const Sim& sys, const double t);
         std::vector<ObserverPtr> get() const;
         bool empty() const;
 
+        /**  \brief Waits until all rows are written (only useful when writing asynchronously)
+          *  \details Rethrows the exceptions thrown while writing. The destructor also waits, but ignores the exceptions.
+          */
+        void flush();
+
         template <typename T> void write(
                 const T& val,
                 const DataAddressing& address)
@@ -44,6 +55,7 @@ class ListOfObservers
     private:
 
         std::vector<ObserverPtr> observers;
+        ObserverWriterPtr writer; //!< Null if the rows are written by the simulation thread
 };
 
 #endif /* LISTOFOBSERVERS_HPP_ */
@@ -20,13 +20,13 @@ class MapObserver : public Observer
         std::map<std::string,std::vector<double> > m;
 
     private:
-        using Observer::get_serializer;
-        using Observer::get_initializer;
-        std::function<void()> get_serializer(const double val, const DataAddressing& address);
-        std::function<void()> get_initializer(const double val, const DataAddressing& address);
+        void initialize_row(const std::vector<DataAddressing>& columns);
+        void write_row(const std::vector<double>& values);
+        void add_columns(const std::vector<DataAddressing>& new_columns); //!< New columns hold NaN for the rows written before they appeared
         void flush_after_initialization();
         void flush_after_write();
-        void flush_value_during_write();
+
+        std::vector<std::vector<double>*> column_of_slot; //!< Points to the elements of m, so write_row does not search the map
 };
 
 #endif /* MAPOBSERVER_HPP_ */
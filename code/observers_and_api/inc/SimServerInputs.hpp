@@ -24,6 +24,7 @@ struct SimServerInputs
     State state_history_except_last_point;
     State full_state_history;
     std::map<std::string, double> commands;
+    bool incremental; //!< Should the new states be appended to the history kept by the server? (cf. SimStepper::step)
     private: SimServerInputs(); // Disabled
 };
 
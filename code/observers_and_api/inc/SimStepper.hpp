@@ -15,10 +15,17 @@ class SimStepper
 {
     public:
         SimStepper(const ConfBuilder& builder, const std::string& solver, const double dt);
+
+        /**  \brief Simulates from the last date in 'input' during Dt
+          *  \details If input.incremental is true & the first sample of the input is at the last date of the
+          *           previous step, the samples are appended to the history computed by the previous steps
+          *           (which is therefore not sent again by the client). Otherwise the history is replaced by the input's.
+          */
         std::vector<YamlState> step(const SimServerInputs& input, double Dt);
 
 
     private:
+        bool can_append(const SimServerInputs& input) const;
         Sim sim;
         const std::string solver;
         const double dt;
@@ -5,6 +5,10 @@
 
 #include "Observer.hpp"
 
+/** \brief Writes the outputs in columns aligned for display (with PRECISION significant digits, so values are rounded)
+ *  \details Each row is built in a string reused from one row to the next & written with a single call to
+ *           std::ostream::write. Use the CSV, JSON or binary formats to read the values back exactly.
+ */
 class TsvObserver : public Observer
 {
     public:
@@ -12,19 +16,15 @@ class TsvObserver : public Observer
         ~TsvObserver();
 
     private:
+        void initialize_row(const std::vector<DataAddressing>& columns);
+        void write_row(const std::vector<double>& values);
         void flush_after_initialization();
         void flush_after_write();
-        void flush_value_during_write();
 
         bool output_to_file;
         std::ostream& os;
         size_t length_of_title_line;
-
-        using Observer::get_serializer;
-        using Observer::get_initializer;
-
-        std::function<void()> get_serializer(const double val, const DataAddressing& address);
-        std::function<void()> get_initializer(const double val, const DataAddressing& address);
+        std::string text; //!< Current row
 };
 
 #endif /* TSVOBSERVER_HPP_ */
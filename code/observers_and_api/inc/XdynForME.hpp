@@ -9,6 +9,7 @@
 #define OBSERVERS_AND_API_INC_XDYNFORME_HPP_
 
 #include <string>
+#include <vector>
 
 #include "ConfBuilder.hpp"
 #include "HistoryParser.hpp"
@@ -18,6 +19,14 @@ class XdynForME
     public :
         XdynForME(const std::string& yaml_model);
         StateType calculate_dx_dt(const SimServerInputs& raw_yaml);
+
+        /**  \brief Computes the state derivatives of all bodies in a single call
+          *  \details One element per body, in the order of the 'bodies' section of the YAML file (the
+          *           derivatives are returned in the same order, 13 values per body). All elements must
+          *           have the same date. The commands of all elements are used.
+          */
+        StateType calculate_dx_dt(const std::vector<SimServerInputs>& inputs_of_each_body);
+        size_t get_nb_of_bodies() const;
         double get_Tmax() const;
 
     private :
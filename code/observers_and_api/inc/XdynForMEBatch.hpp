@@ -0,0 +1,54 @@
+/*
+ * XdynForMEBatch.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef OBSERVERS_AND_API_INC_XDYNFORMEBATCH_HPP_
+#define OBSERVERS_AND_API_INC_XDYNFORMEBATCH_HPP_
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <ssc/macros/tr1_macros.hpp>
+#include TR1INC(memory)
+
+#include "XdynForME.hpp"
+
+/** \brief Evaluates the state derivatives of many independent samples (eg. to compute a Jacobian by finite differences)
+ *  \details The samples are split in contiguous chunks, each evaluated by its own XdynForME (built from the same YAML
+ *           data) on the ThreadPool, so nothing is shared between two chunks & the results do not depend on the number
+ *           of threads. The XdynForME instances are only built when a batch needs them & are then kept for the next batches.
+ *           Batches are evaluated one at a time (calculate_dx_dt can be called from several threads).
+ *  \addtogroup observers_and_api
+ *  \ingroup observers_and_api
+ *  \section ex1 Example
+ *  \snippet observers_and_api/unit_tests/src/XdynForMEBatchTest.cpp XdynForMEBatchTest example
+ */
+class XdynForMEBatch
+{
+    public:
+        XdynForMEBatch(const std::string& yaml_model,
+                       const size_t max_nb_of_models //!< Maximum number of XdynForME instances (& hence of samples evaluated simultaneously). 0 means ThreadPool::get_nb_of_threads()
+                       );
+
+        /**  \brief Computes the state derivatives of each sample
+          *  \details Each sample holds the inputs of all bodies, as in XdynForME::calculate_dx_dt.
+          *  \returns The state derivatives of all bodies (13 values per body), for each sample, in the same order as 'samples'
+          */
+        std::vector<StateType> calculate_dx_dt(const std::vector<std::vector<SimServerInputs> >& samples);
+        double get_Tmax() const;
+        size_t get_nb_of_bodies() const;
+        size_t get_nb_of_models() const; //!< Number of XdynForME instances built so far
+
+    private:
+        XdynForMEBatch();
+        std::string yaml;
+        size_t max_nb_of_models;
+        std::vector<TR1(shared_ptr)<XdynForME> > models;
+        std::mutex mutex;
+};
+
+#endif /* OBSERVERS_AND_API_INC_XDYNFORMEBATCH_HPP_ */
@@ -0,0 +1,38 @@
+/*
+ * format_double.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef FORMAT_DOUBLE_HPP_
+#define FORMAT_DOUBLE_HPP_
+
+#include <cstddef>
+#include <string>
+
+#define FORMAT_DOUBLE_MAX_SIZE 32 //!< Size of the buffer needed by format_double (at most 25 characters are written)
+
+/**  \brief Writes a text representation of 'val' that is read back (eg. by strtod, std::stod or Python) as exactly 'val'
+  *  \details Uses Grisu2 (Loitsch, "Printing floating-point numbers quickly and accurately with integers",
+  *           PLDI 2010): integer arithmetic only, no locale & no memory allocation. The result has at most 17
+  *           significant digits & is the shortest representation for the vast majority of the values. Decimal
+  *           notation is used when the decimal exponent is in [-6,21[ (eg. 12, 0.1, -0.000123), scientific
+  *           notation otherwise (eg. 1e-07, 1.2345e+30). Non-finite values are written nan, inf & -inf.
+  *  \returns Number of characters written in 'buffer' (which is not null-terminated)
+  *  \addtogroup observers_and_api
+  *  \ingroup observers_and_api
+  *  \section ex1 Example
+  *  \snippet observers_and_api/unit_tests/src/format_doubleTest.cpp format_doubleTest example
+  *  \section ex2 Expected output
+  *  \snippet observers_and_api/unit_tests/src/format_doubleTest.cpp format_doubleTest expected output
+  */
+size_t format_double(const double val, char* buffer);
+
+/**  \brief Appends format_double(val) to 'text'
+  *  \details Does not allocate once 'text' has reached its final capacity, so a row can be built in the same
+  *           string at each time step & written at once.
+  */
+void append_double(std::string& text, const double val);
+
+#endif /* FORMAT_DOUBLE_HPP_ */
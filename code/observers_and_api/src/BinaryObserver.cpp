@@ -0,0 +1,124 @@
+/*
+ * BinaryObserver.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <algorithm>
+#include <cstring> // std::memcpy
+
+#include "BinaryObserver.hpp"
+#include "InvalidInputException.hpp"
+
+/**  \brief Writes an unsigned integer in little-endian order, whatever the byte order of the machine
+  */
+template <typename T> void write_binary(std::ostream& os, const T val)
+{
+    char bytes[sizeof(T)];
+    for (size_t i = 0 ; i < sizeof(T) ; ++i) bytes[i] = (char)((val >> (8*i)) & 0xFF);
+    os.write(bytes, sizeof(T));
+}
+
+bool machine_is_little_endian();
+bool machine_is_little_endian()
+{
+    const std::uint16_t one = 1;
+    unsigned char first_byte = 0;
+    std::memcpy(&first_byte, &one, 1);
+    return first_byte == 1;
+}
+
+double swap_bytes(const double val);
+double swap_bytes(const double val)
+{
+    unsigned char bytes[sizeof(double)];
+    std::memcpy(bytes, &val, sizeof(double));
+    std::reverse(bytes, bytes + sizeof(double));
+    double ret = 0;
+    std::memcpy(&ret, bytes, sizeof(double));
+    return ret;
+}
+
+BinaryObserver::BinaryObserver(const std::string& filename, const std::vector<std::string>& d, const size_t nb_of_buffered_rows) :
+        Observer(d),
+        os(filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc),
+        buffer_capacity(std::max((size_t)1, nb_of_buffered_rows)),
+        nb_of_columns(0),
+        buffer(),
+        nb_of_rows_in_buffer(0),
+        nb_of_rows(0),
+        header_was_written(false)
+{
+    if (not(os.is_open()))
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "Unable to open binary output file '" << filename << "'");
+    }
+}
+
+BinaryObserver::~BinaryObserver()
+{
+    try
+    {
+        write_buffer();
+        write_nb_of_rows();
+    }
+    catch (...) // Destructors must not throw
+    {
+    }
+}
+
+void BinaryObserver::initialize_row(const std::vector<DataAddressing>& columns)
+{
+    nb_of_columns = columns.size();
+    buffer.resize(buffer_capacity*nb_of_columns);
+    std::string names;
+    for (const auto& column:columns) names += column.name + '\n';
+    const std::uint64_t size = XDYN_BINARY_HEADER_SIZE + names.size();
+    const std::uint64_t data_offset = XDYN_BINARY_ALIGNMENT*((size + XDYN_BINARY_ALIGNMENT - 1)/XDYN_BINARY_ALIGNMENT);
+    const char magic[8] = XDYN_BINARY_MAGIC;
+    os.write(magic, sizeof(magic));
+    write_binary(os, (std::uint32_t)XDYN_BINARY_VERSION);
+    write_binary(os, (std::uint32_t)nb_of_columns);
+    write_binary(os, (std::uint64_t)0);
+    write_binary(os, data_offset);
+    os.write(names.data(), (std::streamsize)names.size());
+    const std::string padding((size_t)(data_offset - size), '\0');
+    os.write(padding.data(), (std::streamsize)padding.size());
+    header_was_written = true;
+}
+
+void BinaryObserver::write_row(const std::vector<double>& values)
+{
+    std::copy(values.begin(), values.end(), buffer.begin() + (long)(nb_of_rows_in_buffer*nb_of_columns));
+    nb_of_rows_in_buffer++;
+    if (nb_of_rows_in_buffer == buffer_capacity) write_buffer();
+}
+
+void BinaryObserver::write_buffer()
+{
+    if (nb_of_rows_in_buffer == 0) return;
+    if (not(machine_is_little_endian()))
+    {
+        std::transform(buffer.begin(), buffer.begin() + (long)(nb_of_rows_in_buffer*nb_of_columns), buffer.begin(), swap_bytes);
+    }
+    os.write(reinterpret_cast<const char*>(buffer.data()), (std::streamsize)(nb_of_rows_in_buffer*nb_of_columns*sizeof(double)));
+    nb_of_rows += nb_of_rows_in_buffer;
+    nb_of_rows_in_buffer = 0;
+}
+
+void BinaryObserver::write_nb_of_rows()
+{
+    if (not(header_was_written)) return; // Nothing was observed, so the file is empty
+    os.seekp(16); // Position of the number of rows in the header
+    write_binary(os, nb_of_rows);
+    os.flush();
+}
+
+void BinaryObserver::flush_after_initialization()
+{
+}
+
+void BinaryObserver::flush_after_write()
+{
+}
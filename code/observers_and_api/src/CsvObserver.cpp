@@ -6,18 +6,18 @@
  */
 
 #include <fstream>
-#include <iomanip>
 #include <iostream>
 #include <boost/algorithm/string.hpp>
 
 #include "CsvObserver.hpp"
+#include "format_double.hpp"
 
 CsvObserver::CsvObserver(const std::string& filename, const std::vector<std::string>& d) :
         Observer(d),
         output_to_file(not(filename.empty())),
-        os(output_to_file ? *(new std::ofstream(filename)) : std::cout)
+        os(output_to_file ? *(new std::ofstream(filename)) : std::cout),
+        text()
 {
-    os << std::scientific;
 }
 
 CsvObserver::~CsvObserver()
@@ -25,27 +25,41 @@ CsvObserver::~CsvObserver()
     if (output_to_file) delete(&os);
 }
 
-std::function<void()> CsvObserver::get_serializer(const double val, const DataAddressing&)
+void CsvObserver::initialize_row(const std::vector<DataAddressing>& columns)
 {
-    return [this,val](){os << val;};
+    for (size_t i = 0 ; i < columns.size() ; ++i)
+    {
+        std::string title = columns[i].name;
+        boost::replace_all(title, ",", " ");
+        if (i) text += ',';
+        text += title;
+    }
 }
 
-std::function<void()> CsvObserver::get_initializer(const double, const DataAddressing& address)
+void CsvObserver::write_row(const std::vector<double>& values)
 {
-    return [this,address](){std::string title = address.name;boost::replace_all(title, ",", " ");os << title;};
+    for (size_t i = 0 ; i < values.size() ; ++i)
+    {
+        if (i) text += ',';
+        append_double(text, values[i]);
+    }
 }
 
-void CsvObserver::flush_after_initialization()
+void CsvObserver::write_text()
 {
-    os << std::endl;
+    text += '\n';
+    os.write(text.data(), (std::streamsize)text.size());
+    text.clear();
+    // On the standard output, each row is flushed so it can be read as soon as it is computed (eg. through a pipe)
+    if (not(output_to_file)) os.flush();
 }
 
-void CsvObserver::flush_after_write()
+void CsvObserver::flush_after_initialization()
 {
-    os << std::endl;
+    write_text();
 }
 
-void CsvObserver::flush_value_during_write()
+void CsvObserver::flush_after_write()
 {
-    os << ',';
+    write_text();
 }
@@ -1,5 +1,6 @@
 #include "DictObserver.hpp"
 #include "base91.hpp"
+#include "format_double.hpp"
 #include <iostream>
 #include <utility>
 
@@ -23,7 +24,7 @@ DictMapKeyVar extractKeyVarFromString(const std::string& s)
 }
 
 DictObserver::DictObserver(const std::vector<std::string>& d) :
-        Observer(d), ss(), ssSurfaceElevationGrid(), dictMap1(), dictMap2(), shouldWeAddAStartingComma(false)
+        Observer(d), text(), ssSurfaceElevationGrid(), dictMap1(), dictMap2(), destination_of_column(), shouldWeAddAStartingComma(false)
 {
 }
 
@@ -31,28 +32,32 @@ DictObserver::~DictObserver()
 {
 }
 
-std::function<void()> DictObserver::get_serializer(const double val, const DataAddressing& d)
+void DictObserver::initialize_row(const std::vector<DataAddressing>& columns)
 {
-    return [this,d,val]()
-                      {
-                        DictMapKeyVar j = extractKeyVarFromString(d.name);
-                        if (not j.first.empty())
-                        {
-                            if (j.second.empty())
-                            {
-                                dictMap1[j.first] = val;
-                            }
-                            else
-                            {
-                                dictMap2[j.first][j.second] = val;
-                            }
-                        }
-                      };
+    for (const auto& column:columns)
+    {
+        const DictMapKeyVar j = extractKeyVarFromString(column.name);
+        if (j.first.empty())
+        {
+            destination_of_column.push_back(nullptr);
+        }
+        else if (j.second.empty())
+        {
+            destination_of_column.push_back(&dictMap1[j.first]);
+        }
+        else
+        {
+            destination_of_column.push_back(&dictMap2[j.first][j.second]);
+        }
+    }
 }
 
-std::function<void()> DictObserver::get_initializer(const double, const DataAddressing&)
+void DictObserver::write_row(const std::vector<double>& values)
 {
-    return [this](){};
+    for (size_t i = 0 ; i < values.size() ; ++i)
+    {
+        if (destination_of_column[i]) *destination_of_column[i] = values[i];
+    }
 }
 
 std::function<void()> DictObserver::get_serializer(const SurfaceElevationGrid& s, const DataAddressing&)
@@ -81,20 +86,23 @@ std::function<void()> DictObserver::get_initializer(const SurfaceElevationGrid&,
     return [this](){};
 }
 
-void flushMap(std::ostream& os, const std::map<std::string,double>& stuff_to_write, bool addBraces);
-void flushMap(std::ostream& os, const std::map<std::string,double>& stuff_to_write, bool addBraces)
+void flushMap(std::string& text, const std::map<std::string,double>& stuff_to_write, bool addBraces);
+void flushMap(std::string& text, const std::map<std::string,double>& stuff_to_write, bool addBraces)
 {
     const size_t n = stuff_to_write.size();
     if (n==0) return;
     size_t i = 0;
-    if (addBraces) os << "{";
+    if (addBraces) text += '{';
     for (auto const& stuff:stuff_to_write)
     {
-        os << "\""<<stuff.first<<"\":"<<stuff.second;
-        if (i<(n-1)) os << ",";
+        text += '"';
+        text += stuff.first;
+        text += "\":";
+        append_double(text, stuff.second);
+        if (i<(n-1)) text += ',';
         ++i;
     }
-    if (addBraces) os << "}";
+    if (addBraces) text += '}';
 }
 
 bool isStringStreamEmpty(const std::stringstream& ss);
@@ -107,7 +115,7 @@ void DictObserver::serializeDictMap1()
 {
     const size_t n1 = dictMap1.size();
     if (n1==0) return;
-    flushMap(ss, dictMap1, false);
+    flushMap(text, dictMap1, false);
     shouldWeAddAStartingComma = true;
 }
 
@@ -123,16 +131,18 @@ void DictObserver::serializeDictMap2Attitudes()
         }
     }
     i = 0;
-    ss << "\"states\":{";
+    text += "\"states\":{";
     for (auto const& object:dictMap2)
     {
         if (object.first.find(',')!=std::string::npos) continue;
-        ss << "\""<<object.first<<"\":";
-        flushMap(ss, object.second, true);
-        if (i<(nAttitudes-1)) {ss << ",";}
+        text += '"';
+        text += object.first;
+        text += "\":";
+        flushMap(text, object.second, true);
+        if (i<(nAttitudes-1)) {text += ',';}
         ++i;
     }
-    ss << "}";
+    text += '}';
 }
 
 void DictObserver::serializeDictMap2Wrenches()
@@ -153,24 +163,26 @@ void DictObserver::serializeDictMap2Wrenches()
     if (nWrenches>0)
     {
         i = 0;
-        if (nAttitudes>0) ss<<",";
-        ss << "\"wrenches\":{";
+        if (nAttitudes>0) text += ',';
+        text += "\"wrenches\":{";
         for (auto const& object:dictMap2)
         {
             if (object.first.find(',')==std::string::npos) continue;
-            ss << "\""<<object.first<<"\":";
-            flushMap(ss, object.second, true);
-            if (i<(nWrenches-1)) {ss << ",";}
+            text += '"';
+            text += object.first;
+            text += "\":";
+            flushMap(text, object.second, true);
+            if (i<(nWrenches-1)) {text += ',';}
             ++i;
         }
-        ss << "}";
+        text += '}';
     }
 }
 
 void DictObserver::serializeDictMap2()
 {
     if (dictMap2.empty()) return;
-    if (shouldWeAddAStartingComma) ss << ",";
+    if (shouldWeAddAStartingComma) text += ',';
     serializeDictMap2Attitudes();
     serializeDictMap2Wrenches();
     shouldWeAddAStartingComma = true;
@@ -179,16 +191,16 @@ void DictObserver::serializeDictMap2()
 void DictObserver::serializeDictSurfaceElevationGrid()
 {
     if (isStringStreamEmpty(ssSurfaceElevationGrid)) return;
-    if (shouldWeAddAStartingComma) ss<<",";
-    ss << ssSurfaceElevationGrid.str();
+    if (shouldWeAddAStartingComma) text += ',';
+    text += ssSurfaceElevationGrid.str();
     shouldWeAddAStartingComma = true;
 }
 
 void DictObserver::flush_after_write()
 {
-    ss << "{";
+    text += '{';
     serializeDictMap1();
     serializeDictMap2();
     serializeDictSurfaceElevationGrid();
-    ss << "}";
+    text += '}';
 }
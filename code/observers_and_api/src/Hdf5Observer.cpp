@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "Hdf5Observer.hpp"
 
 #include "h5_version.hpp"
@@ -20,14 +22,23 @@ Hdf5Addressing::Hdf5Addressing(
 
 Hdf5Observer::Hdf5Observer(
         const std::string& filename,
-        const std::vector<std::string>& d) :
+        const std::vector<std::string>& d,
+        const bool compress_,
+        const bool write_table_,
+        const size_t nb_of_buffered_rows,
+        const Hdf5WaveObserverOptions& wave_options_) :
             Observer(d),
             h5File(H5_Tools::openEmptyHdf5File(filename)),
             basename("outputs"),
-            name2address(),
-            name2dataset(),
-            name2datatype(),
-            name2dataspace(),
+            compress(compress_),
+            write_table(write_table_),
+            buffer_capacity(std::max((size_t)1, nb_of_buffered_rows)),
+            nb_of_columns(0),
+            buffer(),
+            nb_of_rows_in_buffer(0),
+            datasets(),
+            nb_of_rows(0),
+            wave_options(wave_options_),
             wave_serializer()
 {
     h5_writeFileDescription(h5File);
@@ -35,43 +46,107 @@ Hdf5Observer::Hdf5Observer(
     exportPythonScripts(h5File, filename, basename, "/scripts/Python");
 }
 
-std::function<void()> Hdf5Observer::get_serializer(const double val, const DataAddressing& addressing)
+Hdf5Observer::~Hdf5Observer()
 {
-    return [this,val,addressing]()
-           {
-                H5::DataSet dataset = name2dataset[addressing.name];
-                H5::DataSpace dataspace = dataset.getSpace();
-                hsize_t offset[1] = {(hsize_t)0};
-                hsize_t size[1] = {(hsize_t)0};
-                if (dataspace.getSimpleExtentDims(size)!=1)
-                {
-                    std::stringstream ss;
-                    ss << "Rank mismatch -> Should be one, not " << dataspace.getSimpleExtentNdims();
-                    THROW(__PRETTY_FUNCTION__, InternalErrorException, ss.str());
-                }
-                const hsize_t dims[1] = {(hsize_t)1};
-                offset[0] = size[0];
-                size[0] += 1;
-                dataset.extend(size);
-                H5::DataSpace fspace = dataset.getSpace();
-                fspace.selectHyperslab(H5S_SELECT_SET, dims, offset);
-                dataset.write(&val, name2datatype[addressing.name], H5_Tools::createDataSpace1DUnlimited(), fspace);
-           };
+    try
+    {
+        write_buffer();
+    }
+    catch (...) // Destructors must not throw
+    {
+    }
 }
 
-std::function<void()> Hdf5Observer::get_initializer(const double , const DataAddressing& addressing)
+void Hdf5Observer::initialize_row(const std::vector<DataAddressing>& columns)
 {
-    return [this,addressing]()
-           {
-                name2address[addressing.name] = Hdf5Addressing(addressing,this->basename).address;
-                name2datatype[addressing.name] = H5::DataType(H5::PredType::NATIVE_DOUBLE);
-                name2dataspace[addressing.name] = H5_Tools::createDataSpace1DEmptyUnlimited();
-                name2dataset[addressing.name] =
-                        H5_Tools::createDataSet(h5File,
-                                                name2address[addressing.name],
-                                                name2datatype[addressing.name],
-                                                name2dataspace[addressing.name]);
-           };
+    const H5::DataType datatype(H5::PredType::NATIVE_DOUBLE);
+    nb_of_columns = columns.size();
+    buffer.assign(buffer_capacity*nb_of_columns, 0);
+    if (columns.empty())
+    {
+        return;
+    }
+    if (write_table)
+    {
+        const std::vector<hsize_t> chunk = {(hsize_t)buffer_capacity, (hsize_t)nb_of_columns};
+        datasets.push_back(H5_Tools::createDataSet(h5File,
+                                                   "/" + basename + "/table",
+                                                   datatype,
+                                                   H5_Tools::createDataSpace2DEmptyUnlimited(nb_of_columns),
+                                                   H5_Tools::createChunkedProperties(chunk, compress)));
+        std::vector<std::string> addresses;
+        for (const auto& column:columns) addresses.push_back(Hdf5Addressing(column,basename).address);
+        H5_Tools::write(h5File, "/" + basename + "/table_columns", H5_Tools::join(addresses, "\n"));
+        return;
+    }
+    const std::vector<hsize_t> chunk = {(hsize_t)buffer_capacity};
+    for (const auto& column:columns)
+    {
+        datasets.push_back(H5_Tools::createDataSet(h5File,
+                                                   Hdf5Addressing(column,basename).address,
+                                                   datatype,
+                                                   H5_Tools::createDataSpace1DEmptyUnlimited(),
+                                                   H5_Tools::createChunkedProperties(chunk, compress)));
+    }
+}
+
+void Hdf5Observer::write_row(const std::vector<double>& values)
+{
+    if (values.size() != nb_of_columns)
+    {
+        THROW(__PRETTY_FUNCTION__, InternalErrorException, "Received " << values.size() << " values, but " << nb_of_columns << " columns were initialized.");
+    }
+    if (write_table)
+    {
+        std::copy(values.begin(), values.end(), buffer.begin() + nb_of_rows_in_buffer*nb_of_columns);
+    }
+    else
+    {
+        for (size_t i = 0 ; i < nb_of_columns ; ++i)
+        {
+            buffer[i*buffer_capacity + nb_of_rows_in_buffer] = values[i];
+        }
+    }
+    if (++nb_of_rows_in_buffer == buffer_capacity)
+    {
+        write_buffer();
+    }
+}
+
+void Hdf5Observer::write_buffer()
+{
+    if ((nb_of_rows_in_buffer == 0) or datasets.empty())
+    {
+        nb_of_rows_in_buffer = 0;
+        return;
+    }
+    if (write_table)
+    {
+        const hsize_t count[2] = {(hsize_t)nb_of_rows_in_buffer, (hsize_t)nb_of_columns};
+        const hsize_t offset[2] = {nb_of_rows, 0};
+        const hsize_t size[2] = {nb_of_rows+nb_of_rows_in_buffer, (hsize_t)nb_of_columns};
+        const H5::DataSpace mspace(2, count);
+        datasets.front().extend(size);
+        H5::DataSpace fspace = datasets.front().getSpace();
+        fspace.selectHyperslab(H5S_SELECT_SET, count, offset);
+        datasets.front().write(buffer.data(), H5::PredType::NATIVE_DOUBLE, mspace, fspace);
+    }
+    else
+    {
+        const hsize_t count[1] = {(hsize_t)nb_of_rows_in_buffer};
+        const hsize_t offset[1] = {nb_of_rows};
+        const hsize_t size[1] = {nb_of_rows+nb_of_rows_in_buffer};
+        const H5::DataSpace mspace(1, count);
+        for (size_t i = 0 ; i < datasets.size() ; ++i)
+        {
+            datasets[i].extend(size);
+            H5::DataSpace fspace = datasets[i].getSpace();
+            fspace.selectHyperslab(H5S_SELECT_SET, count, offset);
+            datasets[i].write(&buffer[i*buffer_capacity], H5::PredType::NATIVE_DOUBLE, mspace, fspace);
+        }
+    }
+    nb_of_rows += nb_of_rows_in_buffer;
+    nb_of_rows_in_buffer = 0;
 }
 
 std::function<void()> Hdf5Observer::get_serializer(const SurfaceElevationGrid& waveElevationGrid, const DataAddressing&)
@@ -85,7 +160,7 @@ std::function<void()> Hdf5Observer::get_initializer(const SurfaceElevationGrid&
            {
                const size_t nx = (size_t)waveElevationGrid.x.size();
                const size_t ny = (size_t)waveElevationGrid.y.size();
-               wave_serializer = Hdf5WaveObserverPtr(new Hdf5WaveObserver(h5File, this->basename+"/waves", nx, ny));
+               wave_serializer = Hdf5WaveObserverPtr(new Hdf5WaveObserver(h5File, this->basename+"/waves", nx, ny, wave_options));
            };
 }
 
@@ -97,10 +172,6 @@ void Hdf5Observer::flush_after_write()
 {
 }
 
-void Hdf5Observer::flush_value_during_write()
-{
-}
-
 void Hdf5Observer::write_before_simulation(const std::vector<FlatDiscreteDirectionalWaveSpectrum>& s, const DataAddressing&)
 {
     hdf5WaveSpectrumObserver(h5File,"/outputs/spectra", s);
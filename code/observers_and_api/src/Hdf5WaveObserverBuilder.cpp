@@ -2,21 +2,20 @@
 
 #include "h5_interface.hpp"
 
-/** \def MIN(i1,i2) Define minimum of two scalar*/
-#define MIN(i1,i2) (i1 < i2 ? i1 : i2)
-
-/** \def CHUNK_SIZE Hdf5 chunk parameter used to buffer data before writing*/
-#define CHUNK_SIZE (hsize_t)10
+/** \def CHUNK_SIZE Hdf5 chunk parameter used to buffer the dates before writing*/
+#define CHUNK_SIZE (hsize_t)64
 
 Hdf5WaveObserverBuilder::Hdf5WaveObserverBuilder(
     const std::string& fileName,
     const std::string& datasetName_,
     const size_t nx_,
-    const size_t ny_):
+    const size_t ny_,
+    const bool single_precision_):
         h5File(H5_Tools::openOrCreateAHdf5File(fileName)),
         datasetName(H5_Tools::ensureStringStartsAndEndsWithAPattern(datasetName_,"/")),
         group(((nx_*ny_)>0)?(H5_Tools::createMissingGroups(h5File, datasetName)):H5::Group()),
-        nx(nx_),ny(ny_)
+        nx(nx_),ny(ny_),
+        single_precision(single_precision_)
 {
 }
 
@@ -24,13 +23,31 @@ Hdf5WaveObserverBuilder::Hdf5WaveObserverBuilder(
     const H5::H5File& h5File_,
     const std::string& datasetName_,
     const size_t nx_,
-    const size_t ny_):
+    const size_t ny_,
+    const bool single_precision_):
         h5File(h5File_),
         datasetName(H5_Tools::ensureStringStartsAndEndsWithAPattern(datasetName_,"/")),
         group(((nx_*ny_)>0)?(H5_Tools::createMissingGroups(h5File, datasetName)):H5::Group()),
         nx(nx_),
-        ny(ny_)
+        ny(ny_),
+        single_precision(single_precision_)
+{
+}
+
+H5Element create_dates(const H5::Group& group, const std::string& name, const size_t nb_of_points);
+H5Element create_dates(const H5::Group& group, const std::string& name, const size_t nb_of_points)
 {
+    H5Element h5ElementT;
+    if (nb_of_points==0) return h5ElementT;
+    hsize_t dimsT[1] = {1};
+    const hsize_t maxdimsT[1] = {H5S_UNLIMITED};
+    const hsize_t chunk_dims1[1] = {CHUNK_SIZE};
+    H5::DSetCreatPropList cparms1;
+    cparms1.setChunk(1, chunk_dims1);
+    h5ElementT.datatype = H5::DataType(H5::PredType::NATIVE_DOUBLE);
+    h5ElementT.dataspace = H5::DataSpace(1, dimsT, maxdimsT);
+    h5ElementT.dataset = group.createDataSet(name,h5ElementT.datatype, h5ElementT.dataspace, cparms1);
+    return h5ElementT;
 }
 
 H5::H5File Hdf5WaveObserverBuilder::get_h5File() const
@@ -45,17 +62,12 @@ H5::Group Hdf5WaveObserverBuilder::get_group() const
 
 H5Element Hdf5WaveObserverBuilder::get_h5ElementT() const
 {
-    H5Element h5ElementT;
-    if ((nx*ny)==0) return h5ElementT;
-    hsize_t dimsT[1] = {1};
-    const hsize_t maxdimsT[1] = {H5S_UNLIMITED};
-    const hsize_t chunk_dims1[1] = {1};
-    H5::DSetCreatPropList cparms1;
-    cparms1.setChunk(1, chunk_dims1);
-    h5ElementT.datatype = H5::DataType(H5::PredType::NATIVE_DOUBLE);
-    h5ElementT.dataspace = H5::DataSpace(1, dimsT, maxdimsT);
-    h5ElementT.dataset = group.createDataSet(datasetName+"t",h5ElementT.datatype, h5ElementT.dataspace, cparms1);
-    return h5ElementT;
+    return create_dates(group, datasetName+"t", nx*ny);
+}
+
+H5Element Hdf5WaveObserverBuilder::get_h5ElementTAxes() const
+{
+    return create_dates(group, datasetName+"t_axes", nx*ny);
 }
 
 H5Element Hdf5WaveObserverBuilder::get_h5ElementX() const
@@ -66,7 +78,7 @@ H5Element Hdf5WaveObserverBuilder::get_h5ElementX() const
     hsize_t maxdimsX[2] = {H5S_UNLIMITED, H5S_UNLIMITED};
     dimsX[1] = (hsize_t)nx;
     maxdimsX[1] = (hsize_t)nx;
-    const hsize_t chunk_dims2[2] = {1, MIN(CHUNK_SIZE,(hsize_t)nx)};
+    const hsize_t chunk_dims2[2] = {1, (hsize_t)nx}; // One row of X is one position of the grid
     H5::DSetCreatPropList cparms2;
     cparms2.setChunk(2, chunk_dims2);
     h5ElementX.datatype = H5::DataType(H5::PredType::NATIVE_DOUBLE);
@@ -83,7 +95,7 @@ H5Element Hdf5WaveObserverBuilder::get_h5ElementY() const
     hsize_t maxdimsY[2] = {H5S_UNLIMITED, H5S_UNLIMITED};
     dimsY[1] = (hsize_t)ny;
     maxdimsY[1] = (hsize_t)ny;
-    const hsize_t chunk_dims2[2] = {1, MIN(CHUNK_SIZE,(hsize_t)ny)};
+    const hsize_t chunk_dims2[2] = {1, (hsize_t)ny};
     H5::DSetCreatPropList cparms2;
     cparms2.setChunk(2, chunk_dims2);
     h5ElementY.datatype = H5::DataType(H5::PredType::NATIVE_DOUBLE);
@@ -102,10 +114,10 @@ H5Element Hdf5WaveObserverBuilder::get_h5ElementZ() const
     maxdimsZ[0] = (hsize_t)nx;
     dimsZ[1] = (hsize_t)ny;
     maxdimsZ[1] = (hsize_t)ny;
-    const hsize_t chunk_dims3[3] = {MIN(CHUNK_SIZE,(hsize_t)nx),MIN(CHUNK_SIZE,(hsize_t)ny),1};
+    const hsize_t chunk_dims3[3] = {(hsize_t)nx,(hsize_t)ny,1}; // One chunk per frame
     H5::DSetCreatPropList cparms3;
     cparms3.setChunk(3, chunk_dims3);
-    h5ElementZ.datatype = H5::DataType(H5::PredType::NATIVE_DOUBLE);
+    h5ElementZ.datatype = single_precision ? H5::DataType(H5::PredType::NATIVE_FLOAT) : H5::DataType(H5::PredType::NATIVE_DOUBLE);
     h5ElementZ.dataspace = H5::DataSpace(3, dimsZ, maxdimsZ);
     h5ElementZ.dataset = group.createDataSet(datasetName+"z",h5ElementZ.datatype, h5ElementZ.dataspace, cparms3);
     return h5ElementZ;
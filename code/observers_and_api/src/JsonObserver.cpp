@@ -18,7 +18,9 @@ JsonObserver::~JsonObserver()
 void JsonObserver::flush_after_write()
 {
     DictObserver::flush_after_write();
-    os << ss.str() << std::endl << std::flush;
-    ss.str(std::string());
+    text += '\n';
+    os.write(text.data(), (std::streamsize)text.size());
+    os.flush();
+    text.clear();
 }
 
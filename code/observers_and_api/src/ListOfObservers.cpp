@@ -6,6 +6,7 @@
  */
 
 #include "YamlOutput.hpp"
+#include "BinaryObserver.hpp"
 #include "CsvObserver.hpp"
 #include "TsvObserver.hpp"
 #include "JsonObserver.hpp"
@@ -13,23 +14,76 @@
 #include "Hdf5Observer.hpp"
 #include "WebSocketObserver.hpp"
 #include "ListOfObservers.hpp"
+#include "InvalidInputException.hpp"
 
-ListOfObservers::ListOfObservers(const std::vector<YamlOutput>& yaml) : observers()
+ObserverPtr build_hdf5_observer(const YamlOutput& output);
+ObserverPtr build_hdf5_observer(const YamlOutput& output)
+{
+    if ((output.compression != "none") and (output.compression != "deflate"))
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "In the 'output' section of the YAML file, 'compression' should be 'none' or 'deflate', but got '" << output.compression << "' (for file '" << output.filename << "')");
+    }
+    if ((output.layout != "columns") and (output.layout != "table"))
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "In the 'output' section of the YAML file, 'layout' should be 'columns' or 'table', but got '" << output.layout << "' (for file '" << output.filename << "')");
+    }
+    if ((output.waves_precision != "double") and (output.waves_precision != "float"))
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "In the 'output' section of the YAML file, 'waves precision' should be 'double' or 'float', but got '" << output.waves_precision << "' (for file '" << output.filename << "')");
+    }
+    if (output.waves_decimation == 0)
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "In the 'output' section of the YAML file, 'waves decimation' should be at least 1 (for file '" << output.filename << "')");
+    }
+    Hdf5WaveObserverOptions wave_options;
+    wave_options.single_precision = output.waves_precision == "float";
+    wave_options.decimation = output.waves_decimation;
+    return ObserverPtr(new Hdf5Observer(output.filename, output.data, output.compression == "deflate", output.layout == "table", 512, wave_options));
+}
+
+ListOfObservers::ListOfObservers(const std::vector<YamlOutput>& yaml, const bool write_asynchronously) : observers(), writer()
 {
     for (auto output:yaml)
     {
+        const size_t n = observers.size();
         if (output.format == "csv")  observers.push_back(ObserverPtr(new CsvObserver(output.filename,output.data)));
-        if (output.format == "h5")   observers.push_back(ObserverPtr(new Hdf5Observer(output.filename,output.data)));
-        if (output.format == "hdf5") observers.push_back(ObserverPtr(new Hdf5Observer(output.filename,output.data)));
+        if (output.format == "bin")  observers.push_back(ObserverPtr(new BinaryObserver(output.filename,output.data)));
+        if (output.format == "h5")   observers.push_back(build_hdf5_observer(output));
+        if (output.format == "hdf5") observers.push_back(build_hdf5_observer(output));
         if (output.format == "tsv")  observers.push_back(ObserverPtr(new TsvObserver(output.filename,output.data)));
         if (output.format == "map")  observers.push_back(ObserverPtr(new MapObserver(output.data)));
         if (output.format == "json") observers.push_back(ObserverPtr(new JsonObserver(output.filename,output.data)));
         if (output.format == "ws")   observers.push_back(ObserverPtr(new WebSocketObserver(output.address,output.port,output.data)));
+        // The values of the 'map' observers are read by the caller: they are written by the simulation thread
+        if (write_asynchronously and (observers.size() > n) and (output.format != "map"))
+        {
+            if (not(writer)) writer.reset(new ObserverWriter(1024));
+            observers.back()->write_asynchronously(writer);
+        }
+    }
+}
+
+ListOfObservers::ListOfObservers(const std::vector<ObserverPtr>& observers_) : observers(observers_), writer()
+{
+}
+
+ListOfObservers::~ListOfObservers()
+{
+    if (writer)
+    {
+        try
+        {
+            writer->flush();
+        }
+        catch (...) // Destructors must not throw: call 'flush' to get the errors
+        {
+        }
     }
 }
 
-ListOfObservers::ListOfObservers(const std::vector<ObserverPtr>& observers_) : observers(observers_)
+void ListOfObservers::flush()
 {
+    if (writer) writer->flush();
 }
 
 void ListOfObservers::observe(const Sim& sys, const double t)
@@ -5,31 +5,49 @@
  *      Author: cady
  */
 
+#include <limits>
+
 #include "MapObserver.hpp"
 
-MapObserver::MapObserver(const std::vector<std::string>& d) : Observer(d), m()
+MapObserver::MapObserver(const std::vector<std::string>& d) : Observer(d), m(), column_of_slot()
 {
 }
 
-std::function<void()> MapObserver::get_serializer(const double val, const DataAddressing& address)
+void MapObserver::initialize_row(const std::vector<DataAddressing>& columns)
 {
-    return [this,address,val](){m[address.name].push_back(val);};
+    for (const auto& column:columns)
+    {
+        m[column.name] = std::vector<double>();
+    }
+    for (const auto& column:columns)
+    {
+        column_of_slot.push_back(&m[column.name]);
+    }
 }
 
-std::function<void()> MapObserver::get_initializer(const double, const DataAddressing& address)
+void MapObserver::write_row(const std::vector<double>& values)
 {
-    return [this,address](){m[address.name] = std::vector<double>();};
+    for (size_t i = 0 ; i < values.size() ; ++i)
+    {
+        column_of_slot[i]->push_back(values[i]);
+    }
 }
 
-void MapObserver::flush_after_initialization()
+void MapObserver::add_columns(const std::vector<DataAddressing>& new_columns)
 {
+    const size_t nb_of_rows = column_of_slot.empty() ? 0 : column_of_slot.front()->size();
+    for (const auto& column:new_columns)
+    {
+        m[column.name] = std::vector<double>(nb_of_rows, std::numeric_limits<double>::quiet_NaN());
+        column_of_slot.push_back(&m[column.name]);
+    }
 }
 
-void MapObserver::flush_after_write()
+void MapObserver::flush_after_initialization()
 {
 }
 
-void MapObserver::flush_value_during_write()
+void MapObserver::flush_after_write()
 {
 }
 
@@ -5,6 +5,8 @@
 #include "SimStepper.hpp"
 #include "simulator_api.hpp"
 
+#include <ssc/numeric.hpp>
+
 SimStepper::SimStepper(const ConfBuilder& builder, const std::string& solver, const double dt)
     : sim(builder.sim)
     , solver(solver)
@@ -43,9 +45,9 @@ std::function<YamlState(const Res&)> convert_with_angles(const BodyPtr& body)
     return [&body](const Res& res)
             {
                 YamlState ret = convert_without_angles(res);
-                const State new_state(ret,0);
-                body->set_states_history(new_state);
-                const auto angles = body->get_states().get_angles();
+                // The history of the body is left untouched, so it can be reused by the next (incremental) step
+                const BodyStates& states = body->get_states();
+                const auto angles = states.get_angles(res.x, 0, states.convention);
                 ret.phi = angles.phi;
                 ret.theta = angles.theta;
                 ret.psi = angles.psi;
@@ -53,11 +55,27 @@ std::function<YamlState(const Res&)> convert_with_angles(const BodyPtr& body)
             };
 }
 
+bool SimStepper::can_append(const SimServerInputs& infos) const
+{
+    if (not(infos.incremental) or infos.full_state_history.x.is_empty() or sim.get_bodies().empty()) return false;
+    const History& history = sim.get_bodies().front()->get_states().x;
+    if (history.is_empty()) return false;
+    // The client must resume from the last date we returned: otherwise it has rewound or skipped some steps
+    return almost_equal(infos.full_state_history.x[0].first, history.get_current_time());
+}
+
 std::vector<YamlState> SimStepper::step(const SimServerInputs& infos, double Dt)
 {
     const double tstart = infos.t;
-    sim.reset_history();
-    sim.set_bodystates(infos.full_state_history);
+    if (can_append(infos))
+    {
+        sim.append_bodystates(infos.full_state_history);
+    }
+    else
+    {
+        sim.reset_history();
+        sim.set_bodystates(infos.full_state_history);
+    }
     sim.set_command_listener(infos.commands);
     std::vector<Res> results;
     if(solver == "euler")
@@ -76,6 +94,11 @@ std::vector<YamlState> SimStepper::step(const SimServerInputs& infos, double Dt)
     {
         THROW(__PRETTY_FUNCTION__, InvalidInputException, "unknown solver");
     }
+    if (not(results.empty()) and not(sim.get_bodies().empty()))
+    {
+        // The history ends with the state we return (not an intermediate state of the solver), so the next incremental step can resume from it
+        sim.append_bodystates(State(results.back().x, results.back().t));
+    }
     std::vector<YamlState> ret(results.size());
     if (not(sim.get_bodies().empty()))
     {
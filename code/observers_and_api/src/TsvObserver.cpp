@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <cstdio>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -12,11 +13,9 @@ TsvObserver::TsvObserver(const std::string& filename, const std::vector<std::str
             Observer(d),
             output_to_file(not(filename.empty())),
             os(output_to_file ? *(new std::ofstream(filename)) : std::cout),
-            length_of_title_line(0)
+            length_of_title_line(0),
+            text()
 {
-    os << std::scientific
-       << std::setw(WIDTH)
-       << std::setprecision(PRECISION);
 }
 
 TsvObserver::~TsvObserver()
@@ -24,14 +23,26 @@ TsvObserver::~TsvObserver()
     if (output_to_file) delete(&os);
 }
 
-std::function<void()> TsvObserver::get_serializer(const double val, const DataAddressing&)
+void TsvObserver::initialize_row(const std::vector<DataAddressing>& columns)
 {
-    return [this,val](){os << val;};
+    for (size_t i = 0 ; i < columns.size() ; ++i)
+    {
+        length_of_title_line+=(size_t)std::max((int)columns[i].name.size(),WIDTH)+1;
+        if (i) os << ' ';
+        os << std::setw(WIDTH) << columns[i].name;
+    }
 }
 
-std::function<void()> TsvObserver::get_initializer(const double, const DataAddressing& address)
+void TsvObserver::write_row(const std::vector<double>& values)
 {
-    return [this,address](){length_of_title_line+=(size_t)std::max((int)address.name.size(),WIDTH)+1;os << std::setw(WIDTH) << address.name;};
+    char buffer[32];
+    for (size_t i = 0 ; i < values.size() ; ++i)
+    {
+        if (i) text += ' ';
+        // Same as std::scientific with std::setprecision(PRECISION), without the locale-aware stream formatting
+        const int n = std::snprintf(buffer, sizeof(buffer), "%.*e", PRECISION, values[i]);
+        text.append(buffer, (size_t)std::max(0, std::min(n, (int)sizeof(buffer)-1)));
+    }
 }
 
 void TsvObserver::flush_after_initialization()
@@ -42,10 +53,9 @@ void TsvObserver::flush_after_initialization()
 
 void TsvObserver::flush_after_write()
 {
-    os << std::endl;
-}
-
-void TsvObserver::flush_value_during_write()
-{
-    os << ' ';
+    text += '\n';
+    os.write(text.data(), (std::streamsize)text.size());
+    text.clear();
+    // On the standard output, each row is flushed so it can be read as soon as it is computed (eg. through a pipe)
+    if (not(output_to_file)) os.flush();
 }
@@ -17,6 +17,6 @@ WebSocketObserver::~WebSocketObserver()
 void WebSocketObserver::flush_after_write()
 {
     DictObserver::flush_after_write();
-    socket->send_text(ss.str());
-    ss.str(std::string());
+    socket->send_text(text);
+    text.clear();
 }
@@ -5,7 +5,9 @@
  *      Author: cady
  */
 
+#include <ssc/numeric.hpp>
 
+#include "InvalidInputException.hpp"
 #include "SimServerInputs.hpp"
 #include "XdynForME.hpp"
 
@@ -18,14 +20,46 @@ double XdynForME::get_Tmax() const
     return builder.Tmax;
 }
 
+size_t XdynForME::get_nb_of_bodies() const
+{
+    return builder.sim.get_bodies().size();
+}
+
 StateType XdynForME::calculate_dx_dt(const SimServerInputs& server_inputs)
 {
-    const double t = server_inputs.t;
-    builder.sim.set_bodystates(server_inputs.state_history_except_last_point);
-    builder.sim.set_command_listener(server_inputs.commands);
+    return calculate_dx_dt(std::vector<SimServerInputs>(1, server_inputs));
+}
+
+StateType XdynForME::calculate_dx_dt(const std::vector<SimServerInputs>& inputs_of_each_body)
+{
+    const size_t nb_of_bodies = get_nb_of_bodies();
+    if (inputs_of_each_body.size() != nb_of_bodies)
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "Received the states of " << inputs_of_each_body.size() << " bodies, but the YAML model has " << nb_of_bodies << " bodies: the states of all bodies must be given, in the same order as in the YAML file.");
+    }
+    if (inputs_of_each_body.empty())
+    {
+        return StateType();
+    }
+    const double t = inputs_of_each_body.front().t;
+    std::vector<State> histories;
+    histories.reserve(nb_of_bodies);
+    StateType state_at_t;
+    state_at_t.reserve(13*nb_of_bodies);
+    for (const auto& inputs:inputs_of_each_body)
+    {
+        if (not(ssc::numeric::almost_equal(inputs.t, t)))
+        {
+            THROW(__PRETTY_FUNCTION__, InvalidInputException, "The last state of each body must be at the same date, but got t = " << t << " for the first body and t = " << inputs.t << " for another one.");
+        }
+        histories.push_back(inputs.state_history_except_last_point);
+        state_at_t.insert(state_at_t.end(), inputs.state_at_t.begin(), inputs.state_at_t.end());
+        builder.sim.set_command_listener(inputs.commands);
+    }
+    builder.sim.set_bodystates(histories);
 
-    StateType dx_dt(13, 0);
-    builder.sim.dx_dt(server_inputs.state_at_t, dx_dt, t);
+    StateType dx_dt(state_at_t.size(), 0);
+    builder.sim.dx_dt(state_at_t, dx_dt, t);
 
     return dx_dt;
 }
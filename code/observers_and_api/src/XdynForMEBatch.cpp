@@ -0,0 +1,58 @@
+/*
+ * XdynForMEBatch.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <algorithm>
+
+#include "SimServerInputs.hpp"
+#include "ThreadPool.hpp"
+#include "XdynForMEBatch.hpp"
+
+XdynForMEBatch::XdynForMEBatch(const std::string& yaml_model, const size_t max_nb_of_models_) :
+        yaml(yaml_model),
+        max_nb_of_models(max_nb_of_models_ ? max_nb_of_models_ : ThreadPool::get_nb_of_threads()),
+        models(1, TR1(shared_ptr)<XdynForME>(new XdynForME(yaml_model))),
+        mutex()
+{
+}
+
+double XdynForMEBatch::get_Tmax() const
+{
+    return models.front()->get_Tmax();
+}
+
+size_t XdynForMEBatch::get_nb_of_bodies() const
+{
+    return models.front()->get_nb_of_bodies();
+}
+
+size_t XdynForMEBatch::get_nb_of_models() const
+{
+    return models.size();
+}
+
+std::vector<StateType> XdynForMEBatch::calculate_dx_dt(const std::vector<std::vector<SimServerInputs> >& samples)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<StateType> ret(samples.size());
+    const size_t nb_of_chunks = std::min(samples.size(), max_nb_of_models);
+    while (models.size() < nb_of_chunks)
+    {
+        models.push_back(TR1(shared_ptr)<XdynForME>(new XdynForME(yaml)));
+    }
+    const auto evaluate_chunk = [this, &samples, &ret, nb_of_chunks](const size_t chunk)
+        {
+            // Chunk sizes differ by at most one sample
+            const size_t begin = (chunk*samples.size())/nb_of_chunks;
+            const size_t end = ((chunk+1)*samples.size())/nb_of_chunks;
+            for (size_t i = begin ; i < end ; ++i)
+            {
+                ret[i] = models[chunk]->calculate_dx_dt(samples[i]);
+            }
+        };
+    ThreadPool::parallel_for(nb_of_chunks, evaluate_chunk);
+    return ret;
+}
@@ -0,0 +1,319 @@
+/*
+ * format_double.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "format_double.hpp"
+
+#define SIGNIFICAND_MASK 0x000FFFFFFFFFFFFFULL
+#define HIDDEN_BIT 0x0010000000000000ULL
+#define EXPONENT_MASK 0x7FF0000000000000ULL
+#define EXPONENT_BIAS (0x3FF + 52)
+
+/**  \brief Floating-point number f*2^e with a 64-bit significand ("do-it-yourself" floating point)
+  */
+struct DiyFp
+{
+    DiyFp(const std::uint64_t f_, const int e_) : f(f_), e(e_) {}
+    std::uint64_t f;
+    int e;
+};
+
+DiyFp operator-(const DiyFp& lhs, const DiyFp& rhs);
+DiyFp operator-(const DiyFp& lhs, const DiyFp& rhs)
+{
+    return DiyFp(lhs.f - rhs.f, lhs.e);
+}
+
+/**  \brief Upper 64 bits of the 128-bit product of the significands (rounded)
+  */
+DiyFp operator*(const DiyFp& lhs, const DiyFp& rhs);
+DiyFp operator*(const DiyFp& lhs, const DiyFp& rhs)
+{
+    const std::uint64_t M32 = 0xFFFFFFFFULL;
+    const std::uint64_t a = lhs.f >> 32;
+    const std::uint64_t b = lhs.f & M32;
+    const std::uint64_t c = rhs.f >> 32;
+    const std::uint64_t d = rhs.f & M32;
+    const std::uint64_t ac = a*c;
+    const std::uint64_t bc = b*c;
+    const std::uint64_t ad = a*d;
+    const std::uint64_t bd = b*d;
+    std::uint64_t tmp = (bd >> 32) + (ad & M32) + (bc & M32);
+    tmp += 1ULL << 31; // Round
+    return DiyFp(ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), lhs.e + rhs.e + 64);
+}
+
+DiyFp normalize(DiyFp x);
+DiyFp normalize(DiyFp x)
+{
+    while (not(x.f & (1ULL << 63)))
+    {
+        x.f <<= 1;
+        x.e--;
+    }
+    return x;
+}
+
+DiyFp to_DiyFp(const double val);
+DiyFp to_DiyFp(const double val)
+{
+    std::uint64_t bits;
+    std::memcpy(&bits, &val, sizeof(double));
+    const int biased_exponent = static_cast<int>((bits & EXPONENT_MASK) >> 52);
+    const std::uint64_t significand = bits & SIGNIFICAND_MASK;
+    if (biased_exponent) return DiyFp(significand + HIDDEN_BIT, biased_exponent - EXPONENT_BIAS);
+    return DiyFp(significand, 1 - EXPONENT_BIAS); // Subnormal number
+}
+
+/**  \brief Boundaries m- & m+ of the interval of the reals rounded to v (normalized, with the same exponent)
+  */
+void normalized_boundaries(const DiyFp& v, DiyFp& minus, DiyFp& plus);
+void normalized_boundaries(const DiyFp& v, DiyFp& minus, DiyFp& plus)
+{
+    plus = DiyFp((v.f << 1) + 1, v.e - 1);
+    while (not(plus.f & (HIDDEN_BIT << 1)))
+    {
+        plus.f <<= 1;
+        plus.e--;
+    }
+    plus.f <<= 64 - 52 - 2;
+    plus.e -= 64 - 52 - 2;
+    // The lower boundary is closer when v is a power of two (the exponent changes below v)
+    minus = (v.f == HIDDEN_BIT) ? DiyFp((v.f << 2) - 1, v.e - 2) : DiyFp((v.f << 1) - 1, v.e - 1);
+    minus.f <<= minus.e - plus.e;
+    minus.e = plus.e;
+}
+
+/**  \brief Normalized approximations of 10^k for k = -348, -340, ..., 340
+  */
+static const std::uint64_t cached_powers_f[] = {
+    0xfa8fd5a0081c0288ULL, 0xbaaee17fa23ebf76ULL, 0x8b16fb203055ac76ULL,
+    0xcf42894a5dce35eaULL, 0x9a6bb0aa55653b2dULL, 0xe61acf033d1a45dfULL,
+    0xab70fe17c79ac6caULL, 0xff77b1fcbebcdc4fULL, 0xbe5691ef416bd60cULL,
+    0x8dd01fad907ffc3cULL, 0xd3515c2831559a83ULL, 0x9d71ac8fada6c9b5ULL,
+    0xea9c227723ee8bcbULL, 0xaecc49914078536dULL, 0x823c12795db6ce57ULL,
+    0xc21094364dfb5637ULL, 0x9096ea6f3848984fULL, 0xd77485cb25823ac7ULL,
+    0xa086cfcd97bf97f4ULL, 0xef340a98172aace5ULL, 0xb23867fb2a35b28eULL,
+    0x84c8d4dfd2c63f3bULL, 0xc5dd44271ad3cdbaULL, 0x936b9fcebb25c996ULL,
+    0xdbac6c247d62a584ULL, 0xa3ab66580d5fdaf6ULL, 0xf3e2f893dec3f126ULL,
+    0xb5b5ada8aaff80b8ULL, 0x87625f056c7c4a8bULL, 0xc9bcff6034c13053ULL,
+    0x964e858c91ba2655ULL, 0xdff9772470297ebdULL, 0xa6dfbd9fb8e5b88fULL,
+    0xf8a95fcf88747d94ULL, 0xb94470938fa89bcfULL, 0x8a08f0f8bf0f156bULL,
+    0xcdb02555653131b6ULL, 0x993fe2c6d07b7facULL, 0xe45c10c42a2b3b06ULL,
+    0xaa242499697392d3ULL, 0xfd87b5f28300ca0eULL, 0xbce5086492111aebULL,
+    0x8cbccc096f5088ccULL, 0xd1b71758e219652cULL, 0x9c40000000000000ULL,
+    0xe8d4a51000000000ULL, 0xad78ebc5ac620000ULL, 0x813f3978f8940984ULL,
+    0xc097ce7bc90715b3ULL, 0x8f7e32ce7bea5c70ULL, 0xd5d238a4abe98068ULL,
+    0x9f4f2726179a2245ULL, 0xed63a231d4c4fb27ULL, 0xb0de65388cc8ada8ULL,
+    0x83c7088e1aab65dbULL, 0xc45d1df942711d9aULL, 0x924d692ca61be758ULL,
+    0xda01ee641a708deaULL, 0xa26da3999aef774aULL, 0xf209787bb47d6b85ULL,
+    0xb454e4a179dd1877ULL, 0x865b86925b9bc5c2ULL, 0xc83553c5c8965d3dULL,
+    0x952ab45cfa97a0b3ULL, 0xde469fbd99a05fe3ULL, 0xa59bc234db398c25ULL,
+    0xf6c69a72a3989f5cULL, 0xb7dcbf5354e9beceULL, 0x88fcf317f22241e2ULL,
+    0xcc20ce9bd35c78a5ULL, 0x98165af37b2153dfULL, 0xe2a0b5dc971f303aULL,
+    0xa8d9d1535ce3b396ULL, 0xfb9b7cd9a4a7443cULL, 0xbb764c4ca7a44410ULL,
+    0x8bab8eefb6409c1aULL, 0xd01fef10a657842cULL, 0x9b10a4e5e9913129ULL,
+    0xe7109bfba19c0c9dULL, 0xac2820d9623bf429ULL, 0x80444b5e7aa7cf85ULL,
+    0xbf21e44003acdd2dULL, 0x8e679c2f5e44ff8fULL, 0xd433179d9c8cb841ULL,
+    0x9e19db92b4e31ba9ULL, 0xeb96bf6ebadf77d9ULL, 0xaf87023b9bf0ee6bULL
+};
+
+static const int cached_powers_e[] = {
+    -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980,
+    -954, -927, -901, -874, -847, -821, -794, -768, -741, -715,
+    -688, -661, -635, -608, -582, -555, -529, -502, -475, -449,
+    -422, -396, -369, -343, -316, -289, -263, -236, -210, -183,
+    -157, -130, -103, -77, -50, -24, 3, 30, 56, 83,
+    109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+    375, 402, 428, 455, 481, 508, 534, 561, 588, 614,
+    641, 667, 694, 720, 747, 774, 800, 827, 853, 880,
+    907, 933, 960, 986, 1013, 1039, 1066
+};
+
+/**  \brief Power of ten c = 10^-K such that the exponent of c*2^e is in [-60,-32]
+  */
+DiyFp get_cached_power(const int e, int& K);
+DiyFp get_cached_power(const int e, int& K)
+{
+    const double dk = (-61 - e)*0.30102999566398114 + 347; // 0.30102999566398114 = log10(2)
+    int k = static_cast<int>(dk);
+    if (dk - k > 0.0) k++;
+    const size_t index = static_cast<size_t>((k >> 3) + 1);
+    K = -(-348 + static_cast<int>(index << 3));
+    return DiyFp(cached_powers_f[index], cached_powers_e[index]);
+}
+
+static const std::uint64_t powers_of_ten[] = {1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+                                              1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+                                              100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+                                              1000000000000000000ULL, 10000000000000000000ULL};
+
+int count_decimal_digits(const std::uint32_t n);
+int count_decimal_digits(const std::uint32_t n)
+{
+    int ret = 1;
+    while ((ret < 10) and (n >= powers_of_ten[ret])) ret++;
+    return ret;
+}
+
+/**  \brief Moves the last digit towards w as long as the number stays in the safe interval
+  */
+void grisu_round(char* buffer, const int length, const std::uint64_t delta, std::uint64_t rest, const std::uint64_t ten_kappa, const std::uint64_t wp_w);
+void grisu_round(char* buffer, const int length, const std::uint64_t delta, std::uint64_t rest, const std::uint64_t ten_kappa, const std::uint64_t wp_w)
+{
+    while ((rest < wp_w) and (delta - rest >= ten_kappa) and ((rest + ten_kappa < wp_w) or (wp_w - rest > rest + ten_kappa - wp_w)))
+    {
+        buffer[length - 1]--;
+        rest += ten_kappa;
+    }
+}
+
+/**  \brief Generates the shortest digits of Mp that stay within 'delta' of Mp (digits*10^K is the result)
+  */
+int generate_digits(const DiyFp& W, const DiyFp& Mp, std::uint64_t delta, char* buffer, int& K);
+int generate_digits(const DiyFp& W, const DiyFp& Mp, std::uint64_t delta, char* buffer, int& K)
+{
+    const DiyFp one(1ULL << -Mp.e, Mp.e);
+    const DiyFp wp_w = Mp - W;
+    std::uint32_t p1 = static_cast<std::uint32_t>(Mp.f >> -one.e); // Integral part
+    std::uint64_t p2 = Mp.f & (one.f - 1);                           // Fractional part
+    int kappa = count_decimal_digits(p1);
+    int length = 0;
+    while (kappa > 0)
+    {
+        const std::uint32_t d = p1/static_cast<std::uint32_t>(powers_of_ten[kappa-1]);
+        p1 %= static_cast<std::uint32_t>(powers_of_ten[kappa-1]);
+        if (d or length) buffer[length++] = static_cast<char>('0' + d);
+        kappa--;
+        const std::uint64_t rest = (static_cast<std::uint64_t>(p1) << -one.e) + p2;
+        if (rest <= delta)
+        {
+            K += kappa;
+            grisu_round(buffer, length, delta, rest, powers_of_ten[kappa] << -one.e, wp_w.f);
+            return length;
+        }
+    }
+    for (;;)
+    {
+        p2 *= 10;
+        delta *= 10;
+        const char d = static_cast<char>(p2 >> -one.e);
+        if (d or length) buffer[length++] = static_cast<char>('0' + d);
+        p2 &= one.f - 1;
+        kappa--;
+        if (p2 < delta)
+        {
+            K += kappa;
+            const int index = -kappa;
+            grisu_round(buffer, length, delta, p2, one.f, wp_w.f*(index < 20 ? powers_of_ten[index] : 0));
+            return length;
+        }
+    }
+}
+
+/**  \brief Digits (without leading zeros) & decimal exponent K of a strictly positive finite number: val = digits*10^K
+  */
+int grisu2(const double val, char* buffer, int& K);
+int grisu2(const double val, char* buffer, int& K)
+{
+    const DiyFp v = to_DiyFp(val);
+    DiyFp w_m(0, 0), w_p(0, 0);
+    normalized_boundaries(v, w_m, w_p);
+    const DiyFp c_mk = get_cached_power(w_p.e, K);
+    const DiyFp W = normalize(v)*c_mk;
+    DiyFp Wp = w_p*c_mk;
+    DiyFp Wm = w_m*c_mk;
+    Wm.f++;
+    Wp.f--;
+    return generate_digits(W, Wp, Wp.f - Wm.f, buffer, K);
+}
+
+size_t write_exponent(int K, char* buffer);
+size_t write_exponent(int K, char* buffer)
+{
+    size_t n = 0;
+    buffer[n++] = 'e';
+    buffer[n++] = K < 0 ? '-' : '+';
+    if (K < 0) K = -K;
+    if (K >= 100)
+    {
+        buffer[n++] = static_cast<char>('0' + K/100);
+        K %= 100;
+    }
+    buffer[n++] = static_cast<char>('0' + K/10);
+    buffer[n++] = static_cast<char>('0' + K%10);
+    return n;
+}
+
+/**  \brief Places the decimal point (or the exponent) in digits*10^K
+  */
+size_t prettify(char* buffer, const int length, const int K);
+size_t prettify(char* buffer, const int length, const int K)
+{
+    const int kk = length + K; // 10^(kk-1) <= v < 10^kk
+    if ((K >= 0) and (kk <= 21)) // 1234e7 -> 12340000000
+    {
+        for (int i = length ; i < kk ; ++i) buffer[i] = '0';
+        return static_cast<size_t>(kk);
+    }
+    if ((kk > 0) and (kk <= 21)) // 1234e-2 -> 12.34
+    {
+        std::memmove(&buffer[kk + 1], &buffer[kk], static_cast<size_t>(length - kk));
+        buffer[kk] = '.';
+        return static_cast<size_t>(length + 1);
+    }
+    if ((kk > -6) and (kk <= 0)) // 1234e-6 -> 0.001234
+    {
+        const int offset = 2 - kk;
+        std::memmove(&buffer[offset], &buffer[0], static_cast<size_t>(length));
+        buffer[0] = '0';
+        buffer[1] = '.';
+        for (int i = 2 ; i < offset ; ++i) buffer[i] = '0';
+        return static_cast<size_t>(length + offset);
+    }
+    if (length == 1) // 1e30
+    {
+        return 1 + write_exponent(kk - 1, &buffer[1]);
+    }
+    // 1234e30 -> 1.234e+33
+    std::memmove(&buffer[2], &buffer[1], static_cast<size_t>(length - 1));
+    buffer[1] = '.';
+    return static_cast<size_t>(length + 1) + write_exponent(kk - 1, &buffer[length + 1]);
+}
+
+size_t format_double(const double val, char* buffer)
+{
+    if (std::isnan(val))
+    {
+        std::memcpy(buffer, "nan", 3);
+        return 3;
+    }
+    size_t n = 0;
+    if (std::signbit(val)) buffer[n++] = '-';
+    if (std::isinf(val))
+    {
+        std::memcpy(buffer + n, "inf", 3);
+        return n + 3;
+    }
+    if (val == 0)
+    {
+        buffer[n++] = '0';
+        return n;
+    }
+    int K = 0;
+    const int length = grisu2(std::abs(val), buffer + n, K);
+    return n + prettify(buffer + n, length, K);
+}
+
+void append_double(std::string& text, const double val)
+{
+    char buffer[FORMAT_DOUBLE_MAX_SIZE];
+    text.append(buffer, format_double(val, buffer));
+}
@@ -0,0 +1,24 @@
+/*
+ * BinaryObserverTest.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef BINARYOBSERVERTEST_HPP_
+#define BINARYOBSERVERTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator.hpp>
+
+class BinaryObserverTest : public ::testing::Test
+{
+    protected:
+        BinaryObserverTest();
+        virtual ~BinaryObserverTest(){};
+        virtual void SetUp(){};
+        virtual void TearDown(){};
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif /* BINARYOBSERVERTEST_HPP_ */
@@ -0,0 +1,24 @@
+/*
+ * CsvObserverTest.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef CSVOBSERVERTEST_HPP_
+#define CSVOBSERVERTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator.hpp>
+
+class CsvObserverTest : public ::testing::Test
+{
+    protected:
+        CsvObserverTest();
+        virtual ~CsvObserverTest(){};
+        virtual void SetUp(){};
+        virtual void TearDown(){};
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif /* CSVOBSERVERTEST_HPP_ */
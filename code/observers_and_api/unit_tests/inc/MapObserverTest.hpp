@@ -29,5 +29,6 @@ class MapObserverTest : public ::testing::Test
 };
 
 std::map<std::string,std::vector<double> > get_map(const ListOfObservers& observers);
+ListOfObservers observe(const std::vector<std::string>& stuff_to_watch);
 
 #endif  /* MAPOBSERVERTEST_HPP_ */
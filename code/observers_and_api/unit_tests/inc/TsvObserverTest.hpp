@@ -0,0 +1,24 @@
+/*
+ * TsvObserverTest.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef TSVOBSERVERTEST_HPP_
+#define TSVOBSERVERTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator.hpp>
+
+class TsvObserverTest : public ::testing::Test
+{
+    protected:
+        TsvObserverTest();
+        virtual ~TsvObserverTest(){};
+        virtual void SetUp(){};
+        virtual void TearDown(){};
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif /* TSVOBSERVERTEST_HPP_ */
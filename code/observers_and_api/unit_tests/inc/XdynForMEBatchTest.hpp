@@ -0,0 +1,24 @@
+/*
+ * XdynForMEBatchTest.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef OBSERVERS_AND_API_UNIT_TESTS_INC_XDYNFORMEBATCHTEST_HPP_
+#define OBSERVERS_AND_API_UNIT_TESTS_INC_XDYNFORMEBATCHTEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator/DataGenerator.hpp>
+
+class XdynForMEBatchTest : public ::testing::Test
+{
+    protected:
+        XdynForMEBatchTest();
+        virtual ~XdynForMEBatchTest();
+        virtual void SetUp();
+        virtual void TearDown();
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif /* OBSERVERS_AND_API_UNIT_TESTS_INC_XDYNFORMEBATCHTEST_HPP_ */
@@ -0,0 +1,24 @@
+/*
+ * format_doubleTest.hpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#ifndef FORMAT_DOUBLETEST_HPP_
+#define FORMAT_DOUBLETEST_HPP_
+
+#include "gtest/gtest.h"
+#include <ssc/random_data_generator.hpp>
+
+class format_doubleTest : public ::testing::Test
+{
+    protected:
+        format_doubleTest();
+        virtual ~format_doubleTest(){};
+        virtual void SetUp(){};
+        virtual void TearDown(){};
+        ssc::random_data_generator::DataGenerator a;
+};
+
+#endif /* FORMAT_DOUBLETEST_HPP_ */
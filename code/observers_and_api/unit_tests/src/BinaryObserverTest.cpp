@@ -0,0 +1,62 @@
+/*
+ * BinaryObserverTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include "yaml_data.hpp"
+#include "BinaryObserver.hpp"
+#include "BinaryObserverTest.hpp"
+#include "ListOfObservers.hpp"
+#include "simulator_api.hpp"
+
+BinaryObserverTest::BinaryObserverTest() : a(ssc::random_data_generator::DataGenerator(8787))
+{
+}
+
+template <typename T> T read_binary(const std::string& contents, const size_t offset)
+{
+    T ret;
+    std::memcpy(&ret, contents.data() + offset, sizeof(T));
+    return ret;
+}
+
+TEST_F(BinaryObserverTest, example)
+{
+    const std::string filename = "BinaryObserverTest_example.bin";
+    auto sys = get_system(test_data::falling_ball_example(), 0);
+//! [BinaryObserverTest example]
+    {
+        const size_t nb_of_buffered_rows = 7; // Not a divisor of the number of rows, so the last block is partial
+        ListOfObservers observers(std::vector<ObserverPtr>(1, ObserverPtr(new BinaryObserver(filename, {"t", "z(ball)"}, nb_of_buffered_rows))));
+        ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, 0, 10, 0.1, observers);
+    }
+//! [BinaryObserverTest example]
+    std::ifstream f(filename.c_str(), std::ios::binary);
+    const std::string contents((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+    f.close();
+//! [BinaryObserverTest expected output]
+    ASSERT_EQ(std::string(XDYN_BINARY_MAGIC), std::string(contents.c_str()));
+    ASSERT_EQ(XDYN_BINARY_VERSION, read_binary<std::uint32_t>(contents, 8));
+    ASSERT_EQ(2, read_binary<std::uint32_t>(contents, 12));
+    ASSERT_EQ(101, read_binary<std::uint64_t>(contents, 16));
+    const std::uint64_t data_offset = read_binary<std::uint64_t>(contents, 24);
+    ASSERT_EQ(0, data_offset % XDYN_BINARY_ALIGNMENT);
+    ASSERT_EQ("t\nz(ball)\n", std::string(contents.c_str() + XDYN_BINARY_HEADER_SIZE));
+    ASSERT_EQ(data_offset + 101*2*sizeof(double), contents.size());
+    for (size_t i = 0 ; i < 101 ; ++i)
+    {
+        ASSERT_NEAR(0.1*(double)i, read_binary<double>(contents, data_offset + 2*i*sizeof(double)), 1E-10);
+    }
+    ASSERT_DOUBLE_EQ(12, read_binary<double>(contents, data_offset + sizeof(double)));
+//! [BinaryObserverTest expected output]
+    // Little-endian, whatever the byte order of the machine
+    ASSERT_EQ(std::string("\x01\0\0\0\x02\0\0\0\x65\0\0\0\0\0\0\0", 16), contents.substr(8, 16));
+    EXPECT_EQ(0,remove(filename.c_str()));
+}
@@ -0,0 +1,41 @@
+/*
+ * CsvObserverTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "yaml_data.hpp"
+#include "CsvObserver.hpp"
+#include "CsvObserverTest.hpp"
+#include "ListOfObservers.hpp"
+#include "simulator_api.hpp"
+
+CsvObserverTest::CsvObserverTest() : a(ssc::random_data_generator::DataGenerator(8788))
+{
+}
+
+TEST_F(CsvObserverTest, writes_one_line_per_time_step)
+{
+    const std::string filename = "CsvObserverTest_rows.csv";
+    auto sys = get_system(test_data::falling_ball_example(), 0);
+    {
+        ListOfObservers observers(std::vector<ObserverPtr>(1, ObserverPtr(new CsvObserver(filename, {"t", "z(ball)"}))));
+        ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, 0, 0.2, 0.1, observers);
+    }
+    std::ifstream f(filename.c_str());
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(f, line)) lines.push_back(line);
+    f.close();
+    ASSERT_EQ(4, lines.size());
+    ASSERT_EQ("t,z(ball)", lines[0]);
+    ASSERT_EQ("0,12", lines[1]);
+    ASSERT_EQ("0.1,", lines[2].substr(0, 4));
+    ASSERT_EQ("0.2,", lines[3].substr(0, 4));
+    EXPECT_EQ(0,remove(filename.c_str()));
+}
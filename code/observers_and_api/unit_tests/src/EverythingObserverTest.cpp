@@ -14,6 +14,10 @@
 #include "ListOfObservers.hpp"
 #include "simulator_api.hpp"
 #include "stl_data.hpp"
+#include "ControllableForceModel.hpp"
+#include "ForceModel.hpp"
+
+#include <cmath>
 
 #define EPS 1E-8
 #define _USE_MATH_DEFINE
@@ -87,3 +91,57 @@ TEST_F(EverythingObserverTest, GM)
     ASSERT_NEAR(-1000*9.81*0.5, results.back().extra_observations.at("Fz(GM,cube,NED)"), EPS);
     ASSERT_NEAR(1/(12*PI), results.back().extra_observations.at("GM(cube)"), EPS);
 }
+
+namespace
+{
+    /**  \brief Only writes its extra observation from the third time step onwards (like a distant model that is late to answer)
+      */
+    class ForceModelWithLateObservation : public ForceModel
+    {
+        public:
+            ForceModelWithLateObservation(const std::string& body_name) : ForceModel("late", body_name), nb_of_calls(0),
+                late(std::vector<std::string>{"efforts",body_name,"late","late"}, "late(" + body_name + ")")
+            {
+            }
+
+            ssc::kinematics::Wrench operator()(const BodyStates& states, const double) const
+            {
+                return ssc::kinematics::Wrench(states.G, ssc::kinematics::Vector6d::Zero());
+            }
+
+        private:
+            void extra_observations(Observer& observer) const
+            {
+                if (nb_of_calls++ >= 2) observer.write(42., late);
+            }
+
+            mutable size_t nb_of_calls;
+            DataAddressing late;
+    };
+
+    Sim get_system_with_late_observation();
+    Sim get_system_with_late_observation()
+    {
+        const Sim sys = get_system(test_data::falling_ball_example(), 0);
+        const std::vector<ListOfForces> forces(1, ListOfForces(1, ForcePtr(new ForceModelWithLateObservation("ball"))));
+        return Sim(sys.get_bodies(), forces, std::vector<ListOfControlledForces>(1), sys.get_env(), sys.state, ssc::data_source::DataSource());
+    }
+}
+
+TEST_F(EverythingObserverTest, variables_appearing_during_the_simulation_should_be_observed)
+{
+    auto sys = get_system_with_late_observation();
+    auto list_of_observers = observers();
+    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, 0, 4, 1, list_of_observers);
+    const auto results = get_results(list_of_observers);
+    ASSERT_EQ(5, results.size());
+    for (size_t i = 0 ; i < 5 ; ++i)
+    {
+        ASSERT_DOUBLE_EQ((double)i, results.at(i).t);
+        ASSERT_TRUE(results.at(i).extra_observations.find("late(ball)") != results.at(i).extra_observations.end()) << "i = " << i;
+    }
+    ASSERT_TRUE(std::isnan(results.at(0).extra_observations.at("late(ball)")));
+    ASSERT_TRUE(std::isnan(results.at(1).extra_observations.at("late(ball)")));
+    ASSERT_EQ(42, results.at(2).extra_observations.at("late(ball)"));
+    ASSERT_EQ(42, results.at(4).extra_observations.at("late(ball)"));
+}
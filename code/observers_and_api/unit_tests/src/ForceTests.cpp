@@ -21,6 +21,7 @@
 #include "stl_writer.hpp"
 #include "TriMeshTestData.hpp"
 #include "GMForceModel.hpp"
+#include "InvalidInputException.hpp"
 #include "SimulatorYamlParser.hpp"
 #include "check_input_yaml.hpp"
 #include "simulator_api.hpp"
@@ -1011,3 +1012,32 @@ TEST_F(ForceTests, bug_3239_reference_frame_is_incorrect)
     const auto tau = F(states, t);
     ASSERT_EQ("Anthineas", tau.get_frame());
 }
+
+TEST_F(ForceTests, diffraction_RAO_cache_should_blend_heading_bins_linearly)
+{
+    const YamlModel regular_waves = get_regular_wave(-3, 2, 4);
+    const std::string conf = get_diffraction_conf(0,0,0);
+    const DiffractionForceModel F = get_diffraction_force_model(regular_waves, conf, test_data::bug_3210());
+    const DiffractionForceModel F_cached = get_diffraction_force_model(regular_waves, conf + "heading tolerance for RAO cache: {value: 1, unit: deg}\n", test_data::bug_3210());
+    // The RAO of the HDB are interpolated linearly in incidence between 0° & 30°, so blending two bins inside that interval is exact
+    for (const double psi:{12.5, 12.5-360, 4.25, 25.75})
+    {
+        const auto states = get_whole_body_state_with_psi_equal_to(psi);
+        const double t = 0;
+        const auto tau = F(states, t);
+        const auto tau_cached = F_cached(states, t);
+        const double eps = 1E-9*(std::abs(tau.X()) + std::abs(tau.Y()) + std::abs(tau.Z()));
+        const double eps_torque = 1E-9*(std::abs(tau.K()) + std::abs(tau.M()) + std::abs(tau.N()));
+        ASSERT_NEAR(tau.X(), tau_cached.X(), eps) << "psi = " << psi;
+        ASSERT_NEAR(tau.Y(), tau_cached.Y(), eps) << "psi = " << psi;
+        ASSERT_NEAR(tau.Z(), tau_cached.Z(), eps) << "psi = " << psi;
+        ASSERT_NEAR(tau.K(), tau_cached.K(), eps_torque) << "psi = " << psi;
+        ASSERT_NEAR(tau.M(), tau_cached.M(), eps_torque) << "psi = " << psi;
+        ASSERT_NEAR(tau.N(), tau_cached.N(), eps_torque) << "psi = " << psi;
+    }
+}
+
+TEST_F(ForceTests, diffraction_RAO_cache_tolerance_should_be_positive)
+{
+    ASSERT_THROW(DiffractionForceModel::parse(get_diffraction_conf(0,0,0) + "heading tolerance for RAO cache: {value: -1, unit: deg}\n"), InvalidInputException);
+}
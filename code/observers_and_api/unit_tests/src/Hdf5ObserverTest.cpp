@@ -4,6 +4,7 @@
 #include "Hdf5ObserverTest.hpp"
 #include "ListOfObservers.hpp"
 #include "simulator_api.hpp"
+#include "h5_tools.hpp"
 
 Hdf5ObserverTest::Hdf5ObserverTest() : a(ssc::random_data_generator::DataGenerator(546545))
 {
@@ -47,3 +48,47 @@ TEST_F(Hdf5ObserverTest, LONG_should_be_able_to_create_an_observer_with_wave_out
         }
     }
 }
+
+TEST_F(Hdf5ObserverTest, rows_are_written_by_blocks)
+{
+    const std::string filename = "rows_are_written_by_blocks.h5";
+    auto sys = get_system(test_data::falling_ball_example(), 0);
+    {
+        const bool compress = true;
+        const bool write_table = false;
+        const size_t nb_of_buffered_rows = 7; // Not a divisor of the number of rows, so the last block is partial
+        ListOfObservers observers(std::vector<ObserverPtr>(1, ObserverPtr(new Hdf5Observer(filename, {"t", "z(ball)"}, compress, write_table, nb_of_buffered_rows))));
+        ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, 0, 10, 0.1, observers);
+    }
+    std::vector<double> t;
+    H5_Tools::read(filename, "/outputs/t", t);
+    ASSERT_EQ(101, t.size());
+    for (size_t i = 0 ; i < t.size() ; ++i)
+    {
+        ASSERT_NEAR(0.1*(double)i, t[i], 1E-10);
+    }
+    EXPECT_EQ(0,remove(filename.c_str()));
+}
+
+TEST_F(Hdf5ObserverTest, can_write_all_scalars_in_a_single_table)
+{
+    const std::string filename = "can_write_all_scalars_in_a_single_table.h5";
+    auto sys = get_system(test_data::falling_ball_example(), 0);
+    {
+        const bool compress = false;
+        const bool write_table = true;
+        ListOfObservers observers(std::vector<ObserverPtr>(1, ObserverPtr(new Hdf5Observer(filename, {"t", "z(ball)"}, compress, write_table, 512))));
+        ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, 0, 1, 0.1, observers);
+    }
+    std::vector<std::vector<double> > table;
+    H5_Tools::read(filename, "/outputs/table", table);
+    ASSERT_EQ(11, table.size());
+    for (size_t i = 0 ; i < table.size() ; ++i)
+    {
+        ASSERT_EQ(2, table[i].size());
+        ASSERT_NEAR(0.1*(double)i, table[i][0], 1E-10);
+    }
+    ASSERT_DOUBLE_EQ(12, table[0][1]);
+    ASSERT_GT(table[10][1], table[0][1]);
+    EXPECT_EQ(0,remove(filename.c_str()));
+}
@@ -1,5 +1,6 @@
 #include "Hdf5WaveObserver.hpp"
 #include "Hdf5WaveObserverTest.hpp"
+#include "h5_tools.hpp"
 
 SimHdf5WaveObserverTest::SimHdf5WaveObserverTest() : a(ssc::random_data_generator::DataGenerator(546545))
 {
@@ -72,3 +73,56 @@ TEST_F(SimHdf5WaveObserverTest, can_serialize_a_wave_field_elevation_in_time)
     EXPECT_EQ(0,remove(filename.c_str()));
 }
 
+TEST_F(SimHdf5WaveObserverTest, static_axes_are_only_written_once)
+{
+    const std::string filename("static_axes_are_only_written_once.h5");
+    const size_t nx = 4;
+    const size_t ny = 3;
+    SurfaceElevationGrid waveElevationGrid(nx, ny);
+    for (long i = 0;i<(long)nx;++i) waveElevationGrid.x(i) = (double)i;
+    for (long j = 0;j<(long)ny;++j) waveElevationGrid.y(j) = (double)j;
+    waveElevationGrid.z = foo(waveElevationGrid.x,waveElevationGrid.y);
+    Hdf5WaveObserverOptions options;
+    options.single_precision = true;
+    options.decimation = 2;
+    {
+        Hdf5WaveObserver s(filename,"WaveElevation",nx,ny,options);
+        for (size_t i = 0;i<10;++i)
+        {
+            waveElevationGrid.t = (double)i;
+            if (i==6) waveElevationGrid.x(0) = -1; // The grid moves
+            s<<waveElevationGrid;
+        }
+    }
+    std::vector<double> t, t_axes;
+    std::vector<std::vector<double> > x, y;
+    H5_Tools::read(filename, "/WaveElevation/t", t);
+    H5_Tools::read(filename, "/WaveElevation/t_axes", t_axes);
+    H5_Tools::read(filename, "/WaveElevation/x", x);
+    H5_Tools::read(filename, "/WaveElevation/y", y);
+    ASSERT_EQ(5, t.size());
+    for (size_t i = 0 ; i < t.size() ; ++i) ASSERT_DOUBLE_EQ(2*(double)i, t[i]);
+    ASSERT_EQ(2, t_axes.size());
+    ASSERT_DOUBLE_EQ(0, t_axes[0]);
+    ASSERT_DOUBLE_EQ(6, t_axes[1]);
+    ASSERT_EQ(2, x.size());
+    ASSERT_EQ(nx, x[1].size());
+    ASSERT_DOUBLE_EQ(0, x[0][0]);
+    ASSERT_DOUBLE_EQ(-1, x[1][0]);
+    ASSERT_EQ(2, y.size());
+    H5::H5File file(filename, H5F_ACC_RDONLY);
+    const H5::DataSet z = file.openDataSet("/WaveElevation/z");
+    ASSERT_EQ(4, z.getFloatType().getSize());
+    hsize_t dims[3];
+    z.getSpace().getSimpleExtentDims(dims);
+    ASSERT_EQ(nx, dims[0]);
+    ASSERT_EQ(ny, dims[1]);
+    ASSERT_EQ(5, dims[2]);
+    hsize_t chunk[3];
+    z.getCreatePlist().getChunk(3, chunk);
+    ASSERT_EQ(nx, chunk[0]);
+    ASSERT_EQ(ny, chunk[1]);
+    ASSERT_EQ(1, chunk[2]);
+    file.close();
+    EXPECT_EQ(0,remove(filename.c_str()));
+}
@@ -72,3 +72,10 @@ TEST_F(HistoryParserTest, t_should_correspond_to_last_value_in_yaml)
     const SimServerInputs s = parse_SimServerInputs(yaml, 100);
     ASSERT_DOUBLE_EQ(51.123, s.t);
 }
+
+TEST_F(HistoryParserTest, incremental_flag_is_optional)
+{
+    ASSERT_FALSE(parse_SimServerInputs(yaml, 100).incremental);
+    const std::string incremental_yaml = "{\"Dt\": 12, \"incremental\": true, \"states\": [{\"t\": 9.123 , \"x\": 1.123, \"y\": 2.123, \"z\": 3.123, \"u\": 4.123, \"v\": 5.123, \"w\": 6.123, \"p\": 7.123, \"q\": 8.123, \"r\": 9.123, \"qr\": 1, \"qi\": 0, \"qj\": 0, \"qk\": 0}]}";
+    ASSERT_TRUE(parse_SimServerInputs(incremental_yaml, 100).incremental);
+}
@@ -1,3 +1,7 @@
+#include <fstream>
+#include <string>
+#include <vector>
+
 #include "yaml_data.hpp"
 #include "parse_output.hpp"
 #include "JsonObserver.hpp"
@@ -52,3 +56,23 @@ TEST_F(JsonObserverTest, should_be_able_to_create_an_observer_with_waves)
         }
     }
 }
+
+TEST_F(JsonObserverTest, writes_one_object_per_time_step)
+{
+    const std::string filename = "JsonObserverTest_rows.json";
+    auto sys = get_system(test_data::falling_ball_example(), 0);
+    {
+        ListOfObservers observers(std::vector<ObserverPtr>(1, ObserverPtr(new JsonObserver(filename, {"t", "z(ball)"}))));
+        ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, 0, 0.2, 0.1, observers);
+    }
+    std::ifstream f(filename.c_str());
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(f, line)) lines.push_back(line);
+    f.close();
+    ASSERT_EQ(3, lines.size());
+    ASSERT_EQ("{\"t\":0,\"states\":{\"ball\":{\"z\":12}}}", lines[0]);
+    ASSERT_EQ("{\"t\":0.1,", lines[1].substr(0, 9));
+    ASSERT_EQ("{\"t\":0.2,", lines[2].substr(0, 9));
+    EXPECT_EQ(0,remove(filename.c_str()));
+}
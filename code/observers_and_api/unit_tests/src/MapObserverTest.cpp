@@ -13,6 +13,8 @@
 #include "ListOfObservers.hpp"
 #include "simulator_api.hpp"
 #include "stl_data.hpp"
+#include "ControllableForceModel.hpp"
+#include "ForceModel.hpp"
 
 #define EPS 1E-8
 #define _USE_MATH_DEFINE
@@ -35,7 +37,6 @@ void MapObserverTest::TearDown()
 {
 }
 
-ListOfObservers observe(const std::vector<std::string>& stuff_to_watch);
 ListOfObservers observe(const std::vector<std::string>& stuff_to_watch)
 {
     YamlOutput out;
@@ -107,3 +108,78 @@ TEST_F(MapObserverTest, blocked_state_force_residuals_should_appear)
     ASSERT_NEAR(0, m["My(blocked states,body 1,body 1)"].back(), 1E-6);
     ASSERT_NEAR(0, m["Mz(blocked states,body 1,body 1)"].back(), 1E-6);
 }
+
+TEST_F(MapObserverTest, each_variable_should_be_written_at_each_time_step_in_its_own_column)
+{
+    const double dt = 0.1;
+    const double tend = 1;
+    auto sys = get_system(test_data::falling_ball_example(), 0);
+    auto observers = observe({"Fz(gravity,ball,NED)","t","x(ball)","u(ball)"});
+    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, 0, tend, dt, observers);
+    auto m = get_map(observers);
+    ASSERT_EQ(4, m.size());
+    ASSERT_EQ(11, m["t"].size());
+    ASSERT_EQ(11, m["x(ball)"].size());
+    ASSERT_EQ(11, m["u(ball)"].size());
+    ASSERT_EQ(11, m["Fz(gravity,ball,NED)"].size());
+    for (size_t i = 0 ; i < 11 ; ++i)
+    {
+        ASSERT_NEAR((double)i*dt, m["t"].at(i), EPS);
+        ASSERT_NEAR(4+(double)i*dt, m["x(ball)"].at(i), EPS);
+        ASSERT_NEAR(1, m["u(ball)"].at(i), EPS);
+        ASSERT_SMALL_RELATIVE_ERROR(1E6*9.81, m["Fz(gravity,ball,NED)"].at(i), EPS);
+    }
+}
+
+namespace
+{
+    /**  \brief Writes two extra observations (built at each call) in a different order at each time step
+      */
+    class ForceModelWithShuffledObservations : public ForceModel
+    {
+        public:
+            ForceModelWithShuffledObservations(const std::string& body_name) : ForceModel("shuffled", body_name), nb_of_calls(0)
+            {
+            }
+
+            ssc::kinematics::Wrench operator()(const BodyStates& states, const double) const
+            {
+                return ssc::kinematics::Wrench(states.G, ssc::kinematics::Vector6d::Zero());
+            }
+
+        private:
+            void extra_observations(Observer& observer) const
+            {
+                // Temporaries: each DataAddressing is likely to be built at the address used by the other one at the previous step
+                if (nb_of_calls++ % 2)
+                {
+                    observer.write(1., DataAddressing(std::vector<std::string>{"a"}, "a"));
+                    observer.write(2., DataAddressing(std::vector<std::string>{"b"}, "b"));
+                }
+                else
+                {
+                    observer.write(2., DataAddressing(std::vector<std::string>{"b"}, "b"));
+                    observer.write(1., DataAddressing(std::vector<std::string>{"a"}, "a"));
+                }
+            }
+
+            mutable size_t nb_of_calls;
+    };
+}
+
+TEST_F(MapObserverTest, values_should_be_written_in_the_right_column_even_if_the_order_of_the_calls_changes)
+{
+    const Sim ball = get_system(test_data::falling_ball_example(), 0);
+    const std::vector<ListOfForces> forces(1, ListOfForces(1, ForcePtr(new ForceModelWithShuffledObservations("ball"))));
+    Sim sys(ball.get_bodies(), forces, std::vector<ListOfControlledForces>(1), ball.get_env(), ball.state, ssc::data_source::DataSource());
+    auto observers = observe({"t","a","b"});
+    ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, 0, 1, 0.1, observers);
+    auto m = get_map(observers);
+    ASSERT_EQ(11, m["a"].size());
+    ASSERT_EQ(11, m["b"].size());
+    for (size_t i = 0 ; i < 11 ; ++i)
+    {
+        ASSERT_EQ(1, m["a"].at(i)) << "i = " << i;
+        ASSERT_EQ(2, m["b"].at(i)) << "i = " << i;
+    }
+}
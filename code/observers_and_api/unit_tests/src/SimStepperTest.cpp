@@ -168,3 +168,47 @@ TEST_F(SimStepperTest, sim_update)
     ASSERT_EQ(sim.get_bodies().front()->get_states().x(), 5.0);
 }
 
+
+TEST_F(SimStepperTest, incremental_steps_only_need_the_new_states)
+{
+    const double g = 9.81;
+    const double dt = 1.0;
+    const double Dt = 5;
+    ConfBuilder builder(test_data::falling_ball_example());
+    SimStepper simstepper(builder, "euler", dt);
+    const double x0 = 4;
+    const double z0 = 12;
+    const double u0 = 1;
+    YamlSimServerInputs y;
+    y.Dt = Dt;
+    y.incremental = true;
+    y.states = std::vector<YamlState>(1, YamlState(0, x0, 0 ,z0 ,u0 ,0 ,0 ,0 ,0 ,0 ,1 ,0 ,0 ,0));
+    const std::vector<YamlState> res1 = simstepper.step(SimServerInputs(y, Dt), Dt);
+    // Only the state at t0 (the last one returned by the previous step)
+    y.states = std::vector<YamlState>(1, res1.back());
+    const std::vector<YamlState> res2 = simstepper.step(SimServerInputs(y, Dt), Dt);
+    ASSERT_EQ(6, res2.size());
+    ASSERT_NEAR(2*Dt,                   res2.back().t, EPS);
+    ASSERT_NEAR(x0+u0*2*Dt,             res2.back().x, EPS);
+    ASSERT_NEAR(z0+g*2*Dt*(2*Dt-1.)/2., res2.back().z, EPS);
+    ASSERT_NEAR(g*2*Dt,                 res2.back().w, EPS);
+}
+
+TEST_F(SimStepperTest, incremental_step_replaces_the_history_if_the_client_does_not_resume_from_the_last_step)
+{
+    const double g = 9.81;
+    const double dt = 1.0;
+    const double Dt = 5;
+    ConfBuilder builder(test_data::falling_ball_example());
+    SimStepper simstepper(builder, "euler", dt);
+    YamlSimServerInputs y;
+    y.Dt = Dt;
+    y.incremental = true;
+    y.states = std::vector<YamlState>(1, YamlState(0, 4, 0 ,12 ,1 ,0 ,0 ,0 ,0 ,0 ,1 ,0 ,0 ,0));
+    simstepper.step(SimServerInputs(y, Dt), Dt);
+    // The client starts again from t = 0 (eg. after a rollback): its history cannot be appended to ours
+    const std::vector<YamlState> res = simstepper.step(SimServerInputs(y, Dt), Dt);
+    ASSERT_NEAR(Dt,                 res.back().t, EPS);
+    ASSERT_NEAR(4+Dt,               res.back().x, EPS);
+    ASSERT_NEAR(12+g*Dt*(Dt-1.)/2., res.back().z, EPS);
+}
@@ -22,6 +22,7 @@
 #include "YamlSimulatorInput.hpp"
 #include "yaml_data.hpp"
 #include "InternalErrorException.hpp"
+#include "InvalidInputException.hpp"
 #include "SimulatorYamlParser.hpp"
 #include "stl_data.hpp"
 #include "simulator_api.hpp"
@@ -216,6 +217,35 @@ TEST_F(SimTest, should_throw_if_wave_output_mesh_does_not_exist)
     ASSERT_THROW(sys.get_waves(a.random<double>()),InternalErrorException);
 }
 
+TEST_F(SimTest, periodic_waves_should_be_periodic_over_the_wave_output_mesh)
+{
+    auto input = SimulatorYamlParser(test_data::waves()).parse();
+    boost::replace_all(input.environment[0].yaml, "energy fraction: 0.999", "energy fraction: 0.999\n       periodic: true");
+    const Sim sys = get_system(input, 0);
+    const double t = a.random<double>().between(0, 3600);
+    const ssc::kinematics::PointMatrix w = sys.get_waves(t);
+    // 5 x 2 points, 1 m apart: the wave field is periodic over 8 m along x & 2 m along y
+    std::vector<double> x, y;
+    for (int i = 0 ; i < 10 ; ++i)
+    {
+        x.push_back((double)w.m(0,i) + 8*a.random<int>().between(-3, 3));
+        y.push_back((double)w.m(1,i) + 2*a.random<int>().between(-3, 3));
+    }
+    const std::vector<double> eta = sys.get_env().w->get_and_check_wave_height(x, y, t);
+    for (int i = 0 ; i < 10 ; ++i)
+    {
+        ASSERT_NEAR((double)w.m(2,i), eta[(size_t)i], 1E-8) << "i = " << i;
+    }
+}
+
+TEST_F(SimTest, periodic_waves_need_a_wave_output_mesh_in_the_NED_frame)
+{
+    auto input = SimulatorYamlParser(test_data::waves()).parse();
+    boost::replace_all(input.environment[0].yaml, "energy fraction: 0.999", "energy fraction: 0.999\n       periodic: true");
+    boost::replace_all(input.environment[0].yaml, "frame of reference: NED", "frame of reference: foo");
+    ASSERT_THROW(get_system(input, 0), InvalidInputException);
+}
+
 TEST_F(SimTest, can_generate_wave_height_on_mesh)
 {
     const Sim sys = get_system(test_data::waves(), 0);
@@ -852,6 +882,49 @@ TEST_F(SimTest, bug_3241_blocked_dof_interpolation_problem_LONG)
     ASSERT_DOUBLE_EQ(0,m["u(dtmb)"].at(150));
 }
 
+TEST_F(SimTest, adaptive_solver_should_observe_the_falling_ball_every_dt)
+{
+    const double t0 = 0;
+    const double T = 10;
+    const double dt = 0.5;
+    const double g = 9.81;
+    auto sys = get_system(test_data::falling_ball_example(), t0);
+    auto observers = observe({"t","x(ball)","z(ball)","w(ball)"});
+    ForceStates force_states = [&sys](std::vector<double>&states, const double t){sys.force_states(states, t);};
+    adaptive_quicksolve(sys, t0, T, dt, observers, force_states, AdaptiveRKCK::Parameters());
+    auto m = get_map(observers);
+    ASSERT_EQ(21, m["t"].size());
+    ASSERT_EQ(21, m["z(ball)"].size());
+    for (size_t i = 0 ; i < 21 ; ++i)
+    {
+        const double t = (double)i*dt;
+        ASSERT_NEAR(t,             m["t"].at(i), 1E-9)       << "i=" << i;
+        ASSERT_NEAR(4+t,           m["x(ball)"].at(i), 1E-6) << "i=" << i;
+        ASSERT_NEAR(12+g*t*t/2.,   m["z(ball)"].at(i), 1E-6) << "i=" << i;
+        ASSERT_NEAR(g*t,           m["w(ball)"].at(i), 1E-6) << "i=" << i;
+    }
+}
+
+TEST_F(SimTest, adaptive_solver_should_respect_blocked_dof_LONG)
+{
+    const double t0 = 0;
+    const double T = 15;
+    const double dt = 0.1;
+    const auto yaml = test_data::bug_3241();
+    ListOfObservers observers(parse_output(yaml));
+    auto input = SimulatorYamlParser(yaml).parse();
+
+    auto sys = get_system(input,test_ship_stl,0);
+    ForceStates force_states = [&sys](std::vector<double>&states, const double t){sys.force_states(states, t);};
+    adaptive_quicksolve(sys, t0, T, dt, observers, force_states, AdaptiveRKCK::Parameters());
+    auto m = get_map(observers);
+    ASSERT_EQ(151, m["u(dtmb)"].size());
+    ASSERT_DOUBLE_EQ(1.531,m["u(dtmb)"].at(0));
+    ASSERT_DOUBLE_EQ(1,m["u(dtmb)"].at(50));
+    ASSERT_DOUBLE_EQ(1.5,m["u(dtmb)"].at(100));
+    ASSERT_DOUBLE_EQ(0,m["u(dtmb)"].at(150));
+}
+
 TEST_F(SimTest, issue_20_constant_force)
 {
     const double t0 = 0;
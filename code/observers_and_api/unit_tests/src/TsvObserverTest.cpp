@@ -0,0 +1,102 @@
+/*
+ * TsvObserverTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#include "yaml_data.hpp"
+#include "TsvObserver.hpp"
+#include "TsvObserverTest.hpp"
+#include "ListOfObservers.hpp"
+#include "simulator_api.hpp"
+
+TsvObserverTest::TsvObserverTest() : a(ssc::random_data_generator::DataGenerator(8789))
+{
+}
+
+namespace
+{
+    std::vector<std::string> get_lines(const std::string& text)
+    {
+        std::istringstream is(text);
+        std::vector<std::string> lines;
+        std::string line;
+        while (std::getline(is, line)) lines.push_back(line);
+        return lines;
+    }
+
+    // Stores everything written & the number of characters written at the last flush
+    class RecordingBuffer : public std::streambuf
+    {
+        public:
+            RecordingBuffer() : std::streambuf(), text(), flushed_size(0) {}
+            std::string text;
+            size_t flushed_size;
+
+        protected:
+            int_type overflow(int_type c)
+            {
+                if (not(traits_type::eq_int_type(c, traits_type::eof()))) text += traits_type::to_char_type(c);
+                return traits_type::not_eof(c);
+            }
+
+            std::streamsize xsputn(const char* s, std::streamsize n)
+            {
+                text.append(s, (size_t)n);
+                return n;
+            }
+
+            int sync()
+            {
+                flushed_size = text.size();
+                return 0;
+            }
+    };
+}
+
+TEST_F(TsvObserverTest, writes_one_line_per_time_step)
+{
+    const std::string filename = "TsvObserverTest_rows.tsv";
+    auto sys = get_system(test_data::falling_ball_example(), 0);
+    {
+        ListOfObservers observers(std::vector<ObserverPtr>(1, ObserverPtr(new TsvObserver(filename, {"t", "z(ball)"}))));
+        ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, 0, 0.2, 0.1, observers);
+    }
+    std::ifstream f(filename.c_str());
+    std::stringstream ss;
+    ss << f.rdbuf();
+    f.close();
+    const std::vector<std::string> lines = get_lines(ss.str());
+    ASSERT_EQ(5, lines.size());
+    ASSERT_EQ("        t   z(ball)", lines[0]);
+    ASSERT_EQ(std::string(19, '-'), lines[1]);
+    ASSERT_EQ("0.000e+00 1.200e+01", lines[2]);
+    ASSERT_EQ("1.000e-01 ", lines[3].substr(0, 10));
+    ASSERT_EQ("2.000e-01 ", lines[4].substr(0, 10));
+    EXPECT_EQ(0,remove(filename.c_str()));
+}
+
+TEST_F(TsvObserverTest, flushes_each_line_written_on_the_standard_output)
+{
+    RecordingBuffer buffer;
+    std::streambuf* const cout_buffer = std::cout.rdbuf(&buffer);
+    auto sys = get_system(test_data::falling_ball_example(), 0);
+    {
+        ListOfObservers observers(std::vector<ObserverPtr>(1, ObserverPtr(new TsvObserver("", {"t", "z(ball)"}))));
+        ssc::solver::quicksolve<ssc::solver::EulerStepper>(sys, 0, 0.2, 0.1, observers);
+        std::cout.rdbuf(cout_buffer);
+        // Nothing was left in the stream after the last time step
+        ASSERT_EQ(buffer.text.size(), buffer.flushed_size);
+    }
+    const std::vector<std::string> lines = get_lines(buffer.text);
+    ASSERT_EQ(5, lines.size());
+    ASSERT_EQ("0.000e+00 1.200e+01", lines[2]);
+}
@@ -0,0 +1,72 @@
+/*
+ * XdynForMEBatchTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <thread>
+
+#include "yaml_data.hpp"
+#include "SimServerInputs.hpp"
+#include "ThreadPool.hpp"
+#include "XdynForMEBatch.hpp"
+#include "XdynForMEBatchTest.hpp"
+
+XdynForMEBatchTest::XdynForMEBatchTest() : a(ssc::random_data_generator::DataGenerator(3214))
+{
+}
+
+XdynForMEBatchTest::~XdynForMEBatchTest()
+{
+}
+
+void XdynForMEBatchTest::SetUp()
+{
+}
+
+void XdynForMEBatchTest::TearDown()
+{
+    ThreadPool::set_nb_of_threads(std::thread::hardware_concurrency());
+}
+
+TEST_F(XdynForMEBatchTest, gives_the_same_results_as_XdynForME)
+{
+    ThreadPool::set_nb_of_threads(4);
+//! [XdynForMEBatchTest example]
+    XdynForMEBatch batch(test_data::falling_ball_example(), 3);
+    const SimServerInputs inputs = parse_SimServerInputs(test_data::complete_yaml_message_for_falling_ball(), batch.get_Tmax());
+    std::vector<std::vector<SimServerInputs> > samples;
+    for (size_t i = 0 ; i < 10 ; ++i)
+    {
+        SimServerInputs sample = inputs;
+        sample.state_at_t[3] = a.random<double>().between(-10, 10); // u
+        sample.state_at_t[5] = a.random<double>().between(-10, 10); // w
+        samples.push_back(std::vector<SimServerInputs>(1, sample));
+    }
+    const std::vector<StateType> dx_dt = batch.calculate_dx_dt(samples);
+//! [XdynForMEBatchTest example]
+    ASSERT_EQ(samples.size(), dx_dt.size());
+    ASSERT_EQ(3, batch.get_nb_of_models());
+    XdynForME xdyn_for_me(test_data::falling_ball_example());
+    for (size_t i = 0 ; i < samples.size() ; ++i)
+    {
+        const StateType expected = xdyn_for_me.calculate_dx_dt(samples[i].front());
+        ASSERT_EQ(expected.size(), dx_dt[i].size());
+        for (size_t j = 0 ; j < expected.size() ; ++j)
+        {
+            ASSERT_DOUBLE_EQ(expected[j], dx_dt[i][j]) << "sample " << i << ", state " << j;
+        }
+    }
+}
+
+TEST_F(XdynForMEBatchTest, only_builds_the_models_it_needs)
+{
+    XdynForMEBatch batch(test_data::falling_ball_example(), 8);
+    ASSERT_EQ(1, batch.get_nb_of_models());
+    const SimServerInputs inputs = parse_SimServerInputs(test_data::complete_yaml_message_for_falling_ball(), batch.get_Tmax());
+    const std::vector<std::vector<SimServerInputs> > samples(2, std::vector<SimServerInputs>(1, inputs));
+    ASSERT_EQ(2, batch.calculate_dx_dt(samples).size());
+    ASSERT_EQ(2, batch.get_nb_of_models());
+    ASSERT_TRUE(batch.calculate_dx_dt(std::vector<std::vector<SimServerInputs> >()).empty());
+}
@@ -9,6 +9,7 @@
 #include "yaml_data.hpp"
 
 
+#include "InvalidInputException.hpp"
 #include "XdynForME.hpp"
 #include "XdynForMETest.hpp"
 #define EPS 1E-8
@@ -154,3 +155,38 @@ TEST_F(XdynForMETest, complete_test_with_commands_and_delay_just_test_quaternion
     EXPECT_NEAR(dqj_dt,          dx_dt[11], EPS);
     EXPECT_NEAR(dqk_dt,          dx_dt[12], EPS);
 }
+
+TEST_F(XdynForMETest, can_compute_the_state_derivatives_of_all_bodies_in_a_single_call)
+{
+    const double g = 9.81;
+    XdynForME xdyn_for_me(test_data::two_falling_balls_example());
+    ASSERT_EQ(2, xdyn_for_me.get_nb_of_bodies());
+    const std::string ball1 =
+                "{\"Dt\": 1.0,\n"
+                "\"states\":\n"
+                "[ {\"t\": 0.0, \"x\": 0.0, \"y\": 0.0, \"z\": 0.0, \"u\": 1.0, \"v\": 0.0, \"w\": 0.0, \"p\": 0.0, \"q\": 0.0, \"r\": 0.0, \"qr\": 1.0, \"qi\": 0.0, \"qj\": 0.0, \"qk\": 0.0}\n"
+                ", {\"t\": 1.0, \"x\": 1.0, \"y\": 0.0, \"z\": 0.0, \"u\": 1.0, \"v\": 0.0, \"w\": 0.0, \"p\": 0.0, \"q\": 0.0, \"r\": 0.0, \"qr\": 1.0, \"qi\": 0.0, \"qj\": 0.0, \"qk\": 0.0}\n"
+                "],\n"
+                "\"commands\": {}}";
+    const std::string ball2 =
+                "{\"Dt\": 1.0,\n"
+                "\"states\":\n"
+                "[ {\"t\": 0.0, \"x\": 5.0, \"y\": 0.0, \"z\": 0.0, \"u\": 2.0, \"v\": 0.0, \"w\": 3.0, \"p\": 0.0, \"q\": 0.0, \"r\": 0.0, \"qr\": 1.0, \"qi\": 0.0, \"qj\": 0.0, \"qk\": 0.0}\n"
+                ", {\"t\": 1.0, \"x\": 7.0, \"y\": 0.0, \"z\": 3.0, \"u\": 2.0, \"v\": 0.0, \"w\": 3.0, \"p\": 0.0, \"q\": 0.0, \"r\": 0.0, \"qr\": 1.0, \"qi\": 0.0, \"qj\": 0.0, \"qk\": 0.0}\n"
+                "],\n"
+                "\"commands\": {}}";
+    std::vector<SimServerInputs> inputs;
+    inputs.push_back(parse_SimServerInputs(ball1, xdyn_for_me.get_Tmax()));
+    inputs.push_back(parse_SimServerInputs(ball2, xdyn_for_me.get_Tmax()));
+    const std::vector<double> dx_dt = xdyn_for_me.calculate_dx_dt(inputs);
+
+    ASSERT_EQ(26, dx_dt.size());
+    ASSERT_NEAR(1, dx_dt[0], EPS);
+    ASSERT_NEAR(0, dx_dt[2], EPS);
+    ASSERT_NEAR(g, dx_dt[5], EPS);
+    ASSERT_NEAR(2, dx_dt[13+0], EPS);
+    ASSERT_NEAR(3, dx_dt[13+2], EPS);
+    ASSERT_NEAR(g, dx_dt[13+5], EPS);
+    // The states of all bodies must be given
+    ASSERT_THROW(xdyn_for_me.calculate_dx_dt(inputs.front()), InvalidInputException);
+}
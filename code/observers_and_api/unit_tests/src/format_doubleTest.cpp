@@ -0,0 +1,93 @@
+/*
+ * format_doubleTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: cady
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+
+#include "format_double.hpp"
+#include "format_doubleTest.hpp"
+
+format_doubleTest::format_doubleTest() : a(ssc::random_data_generator::DataGenerator(12321))
+{
+}
+
+std::string format(const double val);
+std::string format(const double val)
+{
+    std::string ret;
+    append_double(ret, val);
+    return ret;
+}
+
+bool is_read_back_exactly(const double val);
+bool is_read_back_exactly(const double val)
+{
+    char buffer[FORMAT_DOUBLE_MAX_SIZE+1];
+    const size_t n = format_double(val, buffer);
+    if (n >= FORMAT_DOUBLE_MAX_SIZE) return false;
+    buffer[n] = '\0';
+    const double read = std::strtod(buffer, nullptr);
+    return std::memcmp(&read, &val, sizeof(double)) == 0; // Bit-exact (eg. 0 & -0 are different)
+}
+
+TEST_F(format_doubleTest, example)
+{
+//! [format_doubleTest example]
+    const std::string t = format(0.1);
+    const std::string z = format(-12);
+    const std::string e = format(1.5e-7);
+    const std::string big = format(6.02214076e23);
+    const std::string pi = format(3.141592653589793);
+//! [format_doubleTest example]
+//! [format_doubleTest expected output]
+    ASSERT_EQ("0.1", t);
+    ASSERT_EQ("-12", z);
+    ASSERT_EQ("1.5e-07", e);
+    ASSERT_EQ("6.02214076e+23", big);
+    ASSERT_EQ("3.141592653589793", pi);
+//! [format_doubleTest expected output]
+}
+
+TEST_F(format_doubleTest, special_values)
+{
+    ASSERT_EQ("0", format(0.));
+    ASSERT_EQ("-0", format(-0.));
+    ASSERT_EQ("inf", format(std::numeric_limits<double>::infinity()));
+    ASSERT_EQ("-inf", format(-std::numeric_limits<double>::infinity()));
+    ASSERT_EQ("nan", format(std::numeric_limits<double>::quiet_NaN()));
+    ASSERT_EQ("0.00001", format(1e-5));
+    ASSERT_EQ("1e-07", format(1e-7));
+    ASSERT_EQ("1e+21", format(1e21));
+    ASSERT_EQ("123456789012345680000", format(123456789012345678901.));
+    ASSERT_TRUE(is_read_back_exactly(std::numeric_limits<double>::max()));
+    ASSERT_TRUE(is_read_back_exactly(std::numeric_limits<double>::min()));
+    ASSERT_TRUE(is_read_back_exactly(std::numeric_limits<double>::denorm_min()));
+    ASSERT_TRUE(is_read_back_exactly(-std::numeric_limits<double>::epsilon()));
+}
+
+TEST_F(format_doubleTest, values_are_read_back_exactly)
+{
+    for (size_t i = 0 ; i < 10000 ; ++i)
+    {
+        const double val = a.random<double>().between(-1000, 1000);
+        ASSERT_TRUE(is_read_back_exactly(val)) << format(val);
+    }
+    // All exponents (including subnormal numbers)
+    std::mt19937_64 generator(1234);
+    for (size_t i = 0 ; i < 100000 ; ++i)
+    {
+        const std::uint64_t bits = generator();
+        double val;
+        std::memcpy(&val, &bits, sizeof(double));
+        if (std::isnan(val)) continue;
+        ASSERT_TRUE(is_read_back_exactly(val)) << format(val);
+    }
+}
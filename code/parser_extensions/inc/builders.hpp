@@ -47,6 +47,7 @@ class SurfaceElevationBuilder<SurfaceElevationFromWaves> : public SurfaceElevati
     private:
         SurfaceElevationBuilder();
         WaveModelPtr parse_wave_model(const YamlDiscretization& discretization, const YamlSpectra& spectrum) const;
+        void put_on_output_mesh(const std::vector<WaveModelPtr>& models, const YamlWaveOutput& output) const;
         DiscreteDirectionalWaveSpectrum parse_directional_spectrum(const YamlDiscretization& discretization, const YamlSpectra& spectrum) const;
         WaveSpectralDensityPtr parse_spectral_density(const YamlSpectra& spectrum) const;
         WaveDirectionalSpreadingPtr parse_directional_spreading(const YamlSpectra& spectrum) const;
@@ -113,6 +113,17 @@ WaveModelPtr SurfaceElevationBuilder<SurfaceElevationFromWaves>::parse_wave_mode
     return WaveModelPtr();
 }
 
+void SurfaceElevationBuilder<SurfaceElevationFromWaves>::put_on_output_mesh(const std::vector<WaveModelPtr>& models, const YamlWaveOutput& output) const
+{
+    const std::pair<size_t,size_t> n = get_wave_mesh_size(output);
+    if ((output.frame_of_reference != "NED") or (n.first*n.second == 0))
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "'periodic' is set in section wave/discretization, so the wave output mesh (section wave/output) should be defined in the NED frame, but got frame '" << output.frame_of_reference << "' & " << n.first << " x " << n.second << " points.");
+    }
+    const std::pair<double,double> d = get_wave_mesh_step_size(output);
+    for (const auto& model:models) model->put_on_regular_grid(d.first, n.first, d.second, n.second);
+}
+
 boost::optional<SurfaceElevationInterfacePtr> SurfaceElevationBuilder<SurfaceElevationFromWaves>::try_to_parse(const std::string& model, const std::string& yaml) const
 {
     boost::optional<SurfaceElevationInterfacePtr> ret;
@@ -122,6 +133,7 @@ boost::optional<SurfaceElevationInterfacePtr> SurfaceElevationBuilder<SurfaceEle
         const auto output_mesh = make_wave_mesh(input.output);
         std::vector<WaveModelPtr> models;
         for (const auto& spectrum: input.spectra) models.push_back(parse_wave_model(input.discretization, spectrum));
+        if (input.discretization.periodic) put_on_output_mesh(models, input.output);
         ret.reset(SurfaceElevationInterfacePtr(new SurfaceElevationFromWaves(models,get_wave_mesh_size(input.output),output_mesh)));
     }
     return ret;
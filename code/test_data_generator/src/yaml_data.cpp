@@ -977,6 +977,75 @@ std::string test_data::rolling_cube()
     return ss.str();
 }
 
+std::string test_data::two_falling_balls_example()
+{
+    std::stringstream ss;
+    ss << "rotations convention: [psi, theta', phi'']\n"
+       << "\n"
+       << "environmental constants:\n"
+       << "    g: {value: 9.81, unit: m/s^2}\n"
+       << "    rho: {value: 1000, unit: kg/m^3}\n"
+       << "    nu: {value: 1.18e-6, unit: m^2/s}\n"
+       << "environment models: []\n"
+       << "\n"
+       << "bodies: # All bodies have NED as parent frame\n";
+    for (const auto name : {"ball1", "ball2"})
+    {
+        ss << "  - name: " << name << "\n"
+           << "    position of body frame relative to mesh:\n"
+           << "        frame: mesh\n"
+           << "        x: {value: 0, unit: m}\n"
+           << "        y: {value: 0, unit: m}\n"
+           << "        z: {value: 0, unit: m}\n"
+           << "        phi: {value: 0, unit: rad}\n"
+           << "        theta: {value: 0, unit: rad}\n"
+           << "        psi: {value: 0, unit: rad}\n"
+           << "    initial position of body frame relative to NED:\n"
+           << "        frame: NED\n"
+           << "        x: {value: 0, unit: m}\n"
+           << "        y: {value: 0, unit: m}\n"
+           << "        z: {value: 0, unit: m}\n"
+           << "        phi: {value: 0, unit: rad}\n"
+           << "        theta: {value: 0, unit: rad}\n"
+           << "        psi: {value: 0, unit: rad}\n"
+           << "    initial velocity of body frame relative to NED:\n"
+           << "        frame: " << name << "\n"
+           << "        u: {value: 0, unit: m/s}\n"
+           << "        v: {value: 0, unit: m/s}\n"
+           << "        w: {value: 0, unit: m/s}\n"
+           << "        p: {value: 0, unit: rad/s}\n"
+           << "        q: {value: 0, unit: rad/s}\n"
+           << "        r: {value: 0, unit: rad/s}\n"
+           << "    dynamics:\n"
+           << "        hydrodynamic forces calculation point in body frame:\n"
+           << "            x: {value: 0, unit: m}\n"
+           << "            y: {value: 0, unit: m}\n"
+           << "            z: {value: 0, unit: m}\n"
+           << "        centre of inertia:\n"
+           << "            frame: " << name << "\n"
+           << "            x: {value: 0, unit: m}\n"
+           << "            y: {value: 0, unit: m}\n"
+           << "            z: {value: 0, unit: m}\n"
+           << "        rigid body inertia matrix at the center of gravity and projected in the body frame:\n"
+           << "            row 1: [1E6,0,0,0,0,0]\n"
+           << "            row 2: [0,1E6,0,0,0,0]\n"
+           << "            row 3: [0,0,1E6,0,0,0]\n"
+           << "            row 4: [0,0,0,1E6,0,0]\n"
+           << "            row 5: [0,0,0,0,1E6,0]\n"
+           << "            row 6: [0,0,0,0,0,1E6]\n"
+           << "        added mass matrix at the center of gravity and projected in the body frame:\n"
+           << "            row 1: [0,0,0,0,0,0]\n"
+           << "            row 2: [0,0,0,0,0,0]\n"
+           << "            row 3: [0,0,0,0,0,0]\n"
+           << "            row 4: [0,0,0,0,0,0]\n"
+           << "            row 5: [0,0,0,0,0,0]\n"
+           << "            row 6: [0,0,0,0,0,0]\n"
+           << "    external forces:\n"
+           << "      - model: gravity\n";
+    }
+    return ss.str();
+}
+
 std::string test_data::oscillating_cube_example()
 {
     std::stringstream ss;
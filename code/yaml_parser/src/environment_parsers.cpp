@@ -89,6 +89,7 @@ void operator >> (const YAML::Node& node, YamlDiscretization& g)
     ssc::yaml_parser::parse_uv(node["omega min"], g.omega_min);
     ssc::yaml_parser::parse_uv(node["omega max"], g.omega_max);
     node["energy fraction"] >> g.energy_fraction;
+    if (node.FindValue("periodic")) node["periodic"] >> g.periodic;
 }
 
 void operator >> (const YAML::Node& node, YamlStretching& g)
@@ -61,6 +61,14 @@ YamlSimServerInputs decode_YamlSimServerInputs(const std::string& json)
             }
         }
     }
+    if (document.HasMember("incremental"))
+    {
+        if (not(document["incremental"].IsBool()))
+        {
+            THROW(__PRETTY_FUNCTION__, ssc::json::Exception, "'incremental' should be a boolean: got " << ssc::json::print_type(document["incremental"]))
+        }
+        infos.incremental = document["incremental"].GetBool();
+    }
 
     return infos;
 }
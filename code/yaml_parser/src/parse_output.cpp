@@ -9,6 +9,7 @@
 #include "yaml.h"
 #include "InvalidInputException.hpp"
 #include "parse_address.hpp"
+#include "external_data_structures_parsers.hpp"
 #include "parse_output.hpp"
 
 void operator >> (const YAML::Node& node, YamlOutput& f);
@@ -30,6 +31,22 @@ void operator >> (const YAML::Node& node, YamlOutput& f)
     {
         *pName >> f.port;
     }
+    if(const YAML::Node *pName = node.FindValue("compression"))
+    {
+        *pName >> f.compression;
+    }
+    if(const YAML::Node *pName = node.FindValue("layout"))
+    {
+        *pName >> f.layout;
+    }
+    if(const YAML::Node *pName = node.FindValue("waves precision"))
+    {
+        *pName >> f.waves_precision;
+    }
+    if(node.FindValue("waves decimation"))
+    {
+        f.waves_decimation = try_to_parse_positive_integer(node, "waves decimation");
+    }
     node["format"]   >> f.format;
     node["data"]     >> f.data;
 }
@@ -126,8 +143,9 @@ std::string get_format(const std::string& filename)
     if (filename.substr(n-4,4)==".csv")  return "csv";
     if (filename.substr(n-4,4)==".tsv")  return "tsv";
     if (filename.substr(n-5,5)==".json") return "json";
+    if (filename.substr(n-4,4)==".bin")  return "bin";
     {
-        THROW(__PRETTY_FUNCTION__, InvalidInputException, "Could not recognize the format of specified output file '" << filename << "': expected filename extensions are .tsv, .csv, .h5, .hdf5 or .json");
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "Could not recognize the format of specified output file '" << filename << "': expected filename extensions are .tsv, .csv, .h5, .hdf5, .json or .bin");
     }
 }
 
@@ -154,6 +172,10 @@ YamlOutput build_YamlOutput_from_filename(const std::string& filename)
     {
         THROW(__PRETTY_FUNCTION__, InvalidInputException, "Need to specify an input filename for HDF5 export from command line");
     }
+    else if (filename=="bin")
+    {
+        THROW(__PRETTY_FUNCTION__, InvalidInputException, "Need to specify an input filename for binary export from command line");
+    }
     else if (boost::algorithm::starts_with(filename,"ws") or
              boost::algorithm::starts_with(filename,"wss"))
     {
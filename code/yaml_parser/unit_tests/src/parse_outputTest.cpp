@@ -44,6 +44,32 @@ TEST_F(parse_outputTest, can_parse_outputs)
     ASSERT_EQ("waves", res.at(1).data.at(3));
 }
 
+TEST_F(parse_outputTest, can_parse_hdf5_storage_options)
+{
+    ASSERT_EQ("none", parse_output(test_data::full_example()).at(1).compression);
+    ASSERT_EQ("columns", parse_output(test_data::full_example()).at(1).layout);
+    const std::string yaml = "output:\n"
+                             "   - format: hdf5\n"
+                             "     filename: out.h5\n"
+                             "     compression: deflate\n"
+                             "     layout: table\n"
+                             "     data: [t]\n";
+    const auto res = parse_output(yaml);
+    ASSERT_EQ(1, res.size());
+    ASSERT_EQ("deflate", res.at(0).compression);
+    ASSERT_EQ("table", res.at(0).layout);
+    ASSERT_EQ("double", res.at(0).waves_precision);
+    ASSERT_EQ(1, res.at(0).waves_decimation);
+    const std::string yaml_with_waves = "output:\n"
+                                        "   - format: hdf5\n"
+                                        "     filename: out.h5\n"
+                                        "     waves precision: float\n"
+                                        "     waves decimation: 10\n"
+                                        "     data: [t, waves]\n";
+    ASSERT_EQ("float", parse_output(yaml_with_waves).at(0).waves_precision);
+    ASSERT_EQ(10, parse_output(yaml_with_waves).at(0).waves_decimation);
+}
+
 TEST_F(parse_outputTest, should_work_even_if_string_is_empty)
 {
     parse_output("");
@@ -88,3 +114,10 @@ TEST_F(parse_outputTest, format_is_CSV_if_extension_is_csv)
     ASSERT_EQ("blabla.csv", res.filename);
     ASSERT_EQ("csv", res.format);
 }
+
+TEST_F(parse_outputTest, format_is_binary_if_extension_is_bin)
+{
+    const YamlOutput res = generate_default_outputter_with_all_states_in_it(test_data::full_example(), "blabla.bin");
+    ASSERT_EQ("blabla.bin", res.filename);
+    ASSERT_EQ("bin", res.format);
+}
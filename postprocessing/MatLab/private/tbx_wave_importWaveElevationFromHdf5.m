@@ -49,6 +49,13 @@ t = h5read(hdf5File,[hdf5Group 't']);
 x = h5read(hdf5File,[hdf5Group 'x'])';
 y = h5read(hdf5File,[hdf5Group 'y'])';
 Z = permute(h5read(hdf5File,[hdf5Group 'z']),[3 2 1]);
+if isInDataset('t_axes',datasets)
+    % x & y only contain one row per position of the grid: one row per instant is rebuilt
+    tAxes = h5read(hdf5File,[hdf5Group 't_axes']);
+    idx = arrayfun(@(ti) find(tAxes<=ti,1,'last'), t);
+    x = x(idx,:);
+    y = y(idx,:);
+end
 
 wavesElevation.t = t;
 wavesElevation.x = x;
@@ -0,0 +1,52 @@
+# -*- coding: utf-8 -*-
+#
+# Reads the binary outputs of xdyn (files with extension .bin) without
+# copying them: the file is memory-mapped & each column is a view of it.
+#
+# Usage: python readBinary.py results.bin
+#
+# In a script:
+#   from readBinary import readBinary
+#   R = readBinary('results.bin')
+#   R['t'], R['z(ball)']          # numpy arrays (views of the file)
+#   pd.DataFrame(R)               # if a pandas DataFrame (copy) is needed
+import argparse
+import os
+import struct
+import numpy as np
+
+MAGIC = b'XDYNBIN\0'
+HEADER_SIZE = 32
+
+def readBinaryHeader(filename):
+    """Returns the names of the columns & the offset (in bytes) of the first row"""
+    with open(filename, 'rb') as f:
+        header = f.read(HEADER_SIZE)
+        if header[:8] != MAGIC:
+            raise Exception(filename + ' is not a binary output file of xdyn')
+        version, nbOfColumns, _, dataOffset = struct.unpack('<IIQQ', header[8:])
+        if version != 1:
+            raise Exception('Unsupported version of the binary format: ' + str(version))
+        names = f.read(dataOffset - HEADER_SIZE).decode('utf-8').split('\n')[:nbOfColumns]
+    return names, dataOffset
+
+def readBinary(filename):
+    """Returns a read-only numpy record array mapped on the file, with one field per column.
+    The number of rows is computed from the size of the file, so files of simulations
+    that are still running (or were interrupted) can also be read."""
+    names, dataOffset = readBinaryHeader(filename)
+    dtype = np.dtype({'names': names, 'formats': ['<f8'] * len(names)})
+    nbOfRows = (os.path.getsize(filename) - dataOffset) // dtype.itemsize if dtype.itemsize else 0
+    return np.memmap(filename, dtype = dtype, mode = 'r', offset = dataOffset, shape = (nbOfRows,))
+
+def main():
+    parser = argparse.ArgumentParser(description = 'Prints the content of a binary output file of xdyn')
+    parser.add_argument('filename', help = 'Binary output file (.bin)')
+    args = parser.parse_args()
+    R = readBinary(args.filename)
+    print('\t'.join(R.dtype.names))
+    for row in R:
+        print('\t'.join(repr(float(v)) for v in row))
+
+if __name__ == "__main__":
+    main()